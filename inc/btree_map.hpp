@@ -0,0 +1,458 @@
+#pragma once
+
+#include <memory>
+#include <stdexcept>
+
+#include "./map.hpp"
+#include "./utils/algorithm.hpp"
+#include "./utils/btree.hpp"
+#include "./utils/functional.hpp"
+#include "./utils/iterator.hpp"
+#include "./utils/utility.hpp"
+
+#ifndef nullptr
+#define nullptr NULL
+#endif
+
+namespace ft
+{
+
+    /* ------------------------------ btree_map ----------------------------- */
+
+    /*
+    ** Not part of any C++ standard.
+    ** A map with the interface of ft::map, stored in an ft::btree: elements
+    ** are packed into leaves of about 256 bytes, so a lookup touches a few
+    ** cache lines per level of a shallow tree and iterating reads memory in
+    ** order instead of chasing a pointer per element.
+    ** Differences to ft::map:
+    ** - inserting and erasing move elements within and between leaves, so
+    **   they invalidate all iterators, pointers and references
+    ** - key_type has to be copy constructible, internal nodes keep copies
+    */
+
+    template < typename Key,                                                    // btree_map::key_type
+               typename T,                                                      // btree_map::mapped_type
+               typename Compare = ft::less<Key>,                                // btree_map::key_compare
+               typename Alloc = std::allocator<ft::pair<const Key, T> > >       // btree_map::allocator_type
+    class btree_map
+    {
+    public:
+        typedef Key                                                             key_type;
+        typedef T                                                               mapped_type;
+        typedef Compare                                                         key_compare;
+        typedef Alloc                                                           allocator_type;
+        typedef ft::pair<const key_type, mapped_type>                           value_type;
+        typedef typename allocator_type::reference                              reference;
+        typedef typename allocator_type::const_reference                        const_reference;
+        typedef typename allocator_type::pointer                                pointer;
+        typedef typename allocator_type::const_pointer                          const_pointer;
+        typedef typename allocator_type::size_type                              size_type;
+        typedef typename allocator_type::difference_type                        difference_type;
+
+        class value_compare : public ft::binary_function<value_type, value_type, bool>
+        {
+
+            friend class btree_map;
+
+        protected:
+            key_compare comp;
+
+            value_compare( key_compare c ) : comp( c ) {}
+
+        public:
+            bool operator()( const value_type& x, const value_type& y ) const
+            {
+                return comp( x.first, y.first );
+            }
+
+        }; // value_compare
+
+    private:
+        typedef ft::btree<value_type, key_compare, allocator_type, ft::select1st<value_type> >    base;
+
+        base    tree;
+
+    public:
+        typedef map_iterator<typename base::iterator>                           iterator;
+        typedef map_const_iterator<typename base::const_iterator>               const_iterator;
+        typedef ft::reverse_iterator<iterator>                                  reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator>                            const_reverse_iterator;
+
+        // Constructors / Destructor / Assignment
+        explicit btree_map( const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() ); // default constructor (empty container)
+        template <typename InputIterator>
+            btree_map( InputIterator first, InputIterator last, const key_compare& comp = key_compare(),
+                    const allocator_type& alloc = allocator_type() ); // range constructor
+        btree_map( const btree_map& src ); // copy constructor
+        ~btree_map(); // destructor
+
+        btree_map& operator=( const btree_map& other ); // assignment operator
+
+        // Iterators:
+        iterator begin();
+        const_iterator begin() const;
+        iterator end();
+        const_iterator end() const;
+        reverse_iterator rbegin();
+        const_reverse_iterator rbegin() const;
+        reverse_iterator rend();
+        const_reverse_iterator rend() const;
+
+        // Capacity:
+        bool empty() const;
+        size_type size() const;
+        size_type max_size() const;
+
+        // Element access:
+        mapped_type& operator[]( const key_type& k );
+        mapped_type& at( const key_type& k );
+        const mapped_type& at( const key_type& k ) const;
+
+        // Modifiers:
+        ft::pair<iterator,bool> insert( const value_type& val ); // single element
+        iterator insert( iterator position, const value_type& val ); // with hint
+        template <typename InputIterator>
+            void insert( InputIterator first, InputIterator last ); // range
+        ft::pair<iterator,bool> try_insert( const key_type& k, const mapped_type& obj ); // insert( make_pair( k, obj ) ) without building the pair for an existing key
+        ft::pair<iterator,bool> insert_or_assign( const key_type& k, const mapped_type& obj ); // assigns obj, if k already exists
+        void erase( iterator position ); // iterator
+        size_type erase( const key_type& k ); // key
+        void erase( iterator first, iterator last ); // range
+        void swap( btree_map& x );
+        void clear();
+
+        // Observers:
+        key_compare key_comp() const;
+        value_compare value_comp() const;
+
+        // Operations:
+        iterator find( const key_type& k );
+        const_iterator find( const key_type& k ) const;
+        size_type count( const key_type& k ) const;
+        iterator lower_bound( const key_type& k );
+        const_iterator lower_bound( const key_type& k ) const;
+        iterator upper_bound( const key_type& k );
+        const_iterator upper_bound( const key_type& k ) const;
+        ft::pair<const_iterator,const_iterator> equal_range( const key_type& k ) const;
+        ft::pair<iterator,iterator> equal_range( const key_type& k );
+
+        // Allocator:
+        allocator_type get_allocator() const;
+
+    }; // btree_map
+
+    /* btree_map member functions */
+    /* public */
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    btree_map<Key,T,Compare,Alloc>::btree_map( const key_compare& comp, const allocator_type& alloc ) // default constructor (empty container)
+    : tree( comp, alloc ) {}
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    template <typename InputIterator>
+    btree_map<Key,T,Compare,Alloc>::btree_map( InputIterator first, InputIterator last, const key_compare& comp,
+    const allocator_type& alloc ) // range constructor
+    : tree( comp, alloc )
+    {
+        this->insert( first, last );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    btree_map<Key,T,Compare,Alloc>::btree_map( const btree_map& src ) // copy constructor
+    : tree( src.tree ) {}
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    btree_map<Key,T,Compare,Alloc>::~btree_map() {} // destructor
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    btree_map<Key,T,Compare,Alloc>& btree_map<Key,T,Compare,Alloc>::operator=( const btree_map& other ) // assignment operator
+    {
+        if ( this != &other )
+        {
+            this->tree = other.tree;
+        }
+        return ( *this );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename btree_map<Key,T,Compare,Alloc>::iterator btree_map<Key,T,Compare,Alloc>::begin()
+    {
+        return ( this->tree.begin() );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename btree_map<Key,T,Compare,Alloc>::const_iterator btree_map<Key,T,Compare,Alloc>::begin() const
+    {
+        return ( this->tree.begin() );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename btree_map<Key,T,Compare,Alloc>::iterator btree_map<Key,T,Compare,Alloc>::end()
+    {
+        return ( this->tree.end() );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename btree_map<Key,T,Compare,Alloc>::const_iterator btree_map<Key,T,Compare,Alloc>::end() const
+    {
+        return ( this->tree.end() );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename btree_map<Key,T,Compare,Alloc>::reverse_iterator btree_map<Key,T,Compare,Alloc>::rbegin()
+    {
+        return ( reverse_iterator( this->end() ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename btree_map<Key,T,Compare,Alloc>::const_reverse_iterator btree_map<Key,T,Compare,Alloc>::rbegin() const
+    {
+        return ( const_reverse_iterator( this->end() ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename btree_map<Key,T,Compare,Alloc>::reverse_iterator btree_map<Key,T,Compare,Alloc>::rend()
+    {
+        return ( reverse_iterator( this->begin() ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename btree_map<Key,T,Compare,Alloc>::const_reverse_iterator btree_map<Key,T,Compare,Alloc>::rend() const
+    {
+        return ( const_reverse_iterator( this->begin() ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    bool btree_map<Key,T,Compare,Alloc>::empty() const
+    {
+        return ( this->tree.size() == 0 );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename btree_map<Key,T,Compare,Alloc>::size_type btree_map<Key,T,Compare,Alloc>::size() const
+    {
+        return ( this->tree.size() );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename btree_map<Key,T,Compare,Alloc>::size_type btree_map<Key,T,Compare,Alloc>::max_size() const
+    {
+        return ( this->tree.max_size() );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename btree_map<Key,T,Compare,Alloc>::mapped_type& btree_map<Key,T,Compare,Alloc>::operator[]( const key_type& k )
+    {
+        iterator position = this->tree.insert_key( k, ft::map_default_value<key_type, mapped_type>( k ) ).first;
+        return ( ( *( position ) ).second );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename btree_map<Key,T,Compare,Alloc>::mapped_type& btree_map<Key,T,Compare,Alloc>::at( const key_type& k )
+    {
+        iterator position = this->find( k );
+
+        if ( position.base() == this->tree.end() )
+            throw std::out_of_range( "ft::btree_map" );
+        return ( ( *( position ) ).second );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    const typename btree_map<Key,T,Compare,Alloc>::mapped_type& btree_map<Key,T,Compare,Alloc>::at( const key_type& k ) const
+    {
+        const_iterator position = this->find( k );
+
+        if ( position.base() == this->tree.end() )
+            throw std::out_of_range( "ft::btree_map" );
+        return ( ( *( position ) ).second );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    ft::pair<typename btree_map<Key,T,Compare,Alloc>::iterator,bool> btree_map<Key,T,Compare,Alloc>::insert( const value_type& val ) // single element
+    {
+        return ( this->tree.insert( val ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename btree_map<Key,T,Compare,Alloc>::iterator btree_map<Key,T,Compare,Alloc>::insert( iterator position, const value_type& val ) // with hint
+    {
+        typename base::iterator x = position.base();
+
+        return ( this->tree.insert( x, val ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    template <typename InputIterator>
+    void btree_map<Key,T,Compare,Alloc>::insert( InputIterator first, InputIterator last ) // range
+    {
+        this->tree.insert( first, last );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    ft::pair<typename btree_map<Key,T,Compare,Alloc>::iterator,bool> btree_map<Key,T,Compare,Alloc>::try_insert( const key_type& k, const mapped_type& obj )
+    {
+        return ( this->tree.insert_key( k, ft::map_key_value<key_type, mapped_type>( k, obj ) ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    ft::pair<typename btree_map<Key,T,Compare,Alloc>::iterator,bool> btree_map<Key,T,Compare,Alloc>::insert_or_assign( const key_type& k, const mapped_type& obj )
+    {
+        ft::pair<iterator,bool> result = this->tree.insert_key( k, ft::map_key_value<key_type, mapped_type>( k, obj ) );
+
+        if ( !( result.second ) )
+            result.first->second = obj;
+        return ( result );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    void btree_map<Key,T,Compare,Alloc>::erase( iterator position ) // iterator
+    {
+        this->tree.erase( position.base() );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename btree_map<Key,T,Compare,Alloc>::size_type btree_map<Key,T,Compare,Alloc>::erase( const key_type& k ) // key
+    {
+        return ( this->tree.erase( k ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    void btree_map<Key,T,Compare,Alloc>::erase( iterator first, iterator last ) // range
+    {
+        this->tree.erase( first.base(), last.base() );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    void btree_map<Key,T,Compare,Alloc>::swap( btree_map& x )
+    {
+        this->tree.swap( x.tree );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    void btree_map<Key,T,Compare,Alloc>::clear()
+    {
+        this->tree.clear();
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename btree_map<Key,T,Compare,Alloc>::key_compare btree_map<Key,T,Compare,Alloc>::key_comp() const
+    {
+        return ( this->tree.key_comp() );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename btree_map<Key,T,Compare,Alloc>::value_compare btree_map<Key,T,Compare,Alloc>::value_comp() const
+    {
+        return ( value_compare( this->tree.key_comp() ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename btree_map<Key,T,Compare,Alloc>::iterator btree_map<Key,T,Compare,Alloc>::find( const key_type& k )
+    {
+        return ( this->tree.find( k ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename btree_map<Key,T,Compare,Alloc>::const_iterator btree_map<Key,T,Compare,Alloc>::find( const key_type& k ) const
+    {
+        return ( this->tree.find( k ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename btree_map<Key,T,Compare,Alloc>::size_type btree_map<Key,T,Compare,Alloc>::count( const key_type& k ) const
+    {
+        return ( this->tree.count( k ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename btree_map<Key,T,Compare,Alloc>::iterator btree_map<Key,T,Compare,Alloc>::lower_bound( const key_type& k )
+    {
+        return ( this->tree.lower_bound( k ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename btree_map<Key,T,Compare,Alloc>::const_iterator btree_map<Key,T,Compare,Alloc>::lower_bound( const key_type& k ) const
+    {
+        return ( this->tree.lower_bound( k ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename btree_map<Key,T,Compare,Alloc>::iterator btree_map<Key,T,Compare,Alloc>::upper_bound( const key_type& k )
+    {
+        return ( this->tree.upper_bound( k ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename btree_map<Key,T,Compare,Alloc>::const_iterator btree_map<Key,T,Compare,Alloc>::upper_bound( const key_type& k ) const
+    {
+        return ( this->tree.upper_bound( k ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    ft::pair<typename btree_map<Key,T,Compare,Alloc>::const_iterator,
+            typename btree_map<Key,T,Compare,Alloc>::const_iterator>
+            btree_map<Key,T,Compare,Alloc>::equal_range( const key_type& k ) const
+    {
+        return ( this->tree.equal_range( k ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    ft::pair<typename btree_map<Key,T,Compare,Alloc>::iterator,
+            typename btree_map<Key,T,Compare,Alloc>::iterator>
+            btree_map<Key,T,Compare,Alloc>::equal_range( const key_type& k )
+    {
+        return ( this->tree.equal_range( k ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename btree_map<Key,T,Compare,Alloc>::allocator_type btree_map<Key,T,Compare,Alloc>::get_allocator() const
+    {
+        return ( this->tree.get_allocator() );
+    }
+
+    /* btree_map non-member functions */
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    inline bool operator==( const ft::btree_map<Key,T,Compare,Alloc>& lhs, const ft::btree_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return ( lhs.size() == rhs.size() && ft::equal( lhs.begin(), lhs.end(), rhs.begin() ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    inline bool operator!=( const ft::btree_map<Key,T,Compare,Alloc>& lhs, const ft::btree_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return ( !( lhs == rhs ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    inline bool operator<( const ft::btree_map<Key,T,Compare,Alloc>& lhs, const ft::btree_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return ( ft::lexicographical_compare( lhs.begin(), lhs.end(), rhs.begin(), rhs.end() ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    inline bool operator<=( const ft::btree_map<Key,T,Compare,Alloc>& lhs, const ft::btree_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return ( !( rhs < lhs ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    inline bool operator>( const ft::btree_map<Key,T,Compare,Alloc>& lhs, const ft::btree_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return ( rhs < lhs );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    inline bool operator>=( const ft::btree_map<Key,T,Compare,Alloc>& lhs, const ft::btree_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return ( !( lhs < rhs ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    void swap( ft::btree_map<Key,T,Compare,Alloc>& lhs, ft::btree_map<Key,T,Compare,Alloc>& rhs )
+    {
+        lhs.swap( rhs );
+    }
+
+} // namespace ft
@@ -0,0 +1,471 @@
+#pragma once
+
+#include <memory>
+#include <stdexcept>
+
+#include "./utils/algorithm.hpp"
+#include "./utils/flat_tree.hpp"
+#include "./utils/functional.hpp"
+#include "./utils/iterator.hpp"
+#include "./utils/utility.hpp"
+
+#ifndef nullptr
+#define nullptr NULL
+#endif
+
+namespace ft
+{
+
+    /* ------------------------------ flat_map ------------------------------ */
+
+    /*
+    ** Not part of any C++ standard.
+    ** A map with the interface of ft::map, stored in an ft::flat_tree: one
+    ** sorted ft::vector, searched by bisection and iterated like an array.
+    ** Meant for tables, which are built in batches by insert( first, last )
+    ** and then mostly read.
+    ** Differences to ft::map:
+    ** - value_type is ft::pair<Key, T> (not const Key), so elements can be
+    **   moved by assignment; a key must not be changed through an iterator
+    ** - iterators are random access, and like for ft::vector, inserting and
+    **   erasing invalidate iterators, pointers and references
+    ** - inserting or erasing a single element is linear in size()
+    */
+
+    template < typename Key,                                                    // flat_map::key_type
+               typename T,                                                      // flat_map::mapped_type
+               typename Compare = ft::less<Key>,                                // flat_map::key_compare
+               typename Alloc = std::allocator<ft::pair<Key, T> > >             // flat_map::allocator_type
+    class flat_map
+    {
+    public:
+        typedef Key                                                             key_type;
+        typedef T                                                               mapped_type;
+        typedef Compare                                                         key_compare;
+        typedef Alloc                                                           allocator_type;
+        typedef ft::pair<key_type, mapped_type>                                 value_type;
+        typedef typename allocator_type::reference                              reference;
+        typedef typename allocator_type::const_reference                        const_reference;
+        typedef typename allocator_type::pointer                                pointer;
+        typedef typename allocator_type::const_pointer                          const_pointer;
+        typedef typename allocator_type::size_type                              size_type;
+        typedef typename allocator_type::difference_type                        difference_type;
+
+        class value_compare : public ft::binary_function<value_type, value_type, bool>
+        {
+
+            friend class flat_map;
+
+        protected:
+            key_compare comp;
+
+            value_compare( key_compare c ) : comp( c ) {}
+
+        public:
+            bool operator()( const value_type& x, const value_type& y ) const
+            {
+                return comp( x.first, y.first );
+            }
+
+        }; // value_compare
+
+    private:
+        typedef ft::flat_tree<value_type, key_compare, allocator_type, ft::select1st<value_type> >    base;
+
+        base    tree;
+
+    public:
+        typedef typename base::iterator                                         iterator;
+        typedef typename base::const_iterator                                   const_iterator;
+        typedef typename base::reverse_iterator                                 reverse_iterator;
+        typedef typename base::const_reverse_iterator                           const_reverse_iterator;
+
+        // Constructors / Destructor / Assignment
+        explicit flat_map( const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() ); // default constructor (empty container)
+        template <typename InputIterator>
+            flat_map( InputIterator first, InputIterator last, const key_compare& comp = key_compare(),
+                    const allocator_type& alloc = allocator_type() ); // range constructor
+        flat_map( const flat_map& src ); // copy constructor
+        ~flat_map(); // destructor
+
+        flat_map& operator=( const flat_map& other ); // assignment operator
+
+        // Iterators:
+        iterator begin();
+        const_iterator begin() const;
+        iterator end();
+        const_iterator end() const;
+        reverse_iterator rbegin();
+        const_reverse_iterator rbegin() const;
+        reverse_iterator rend();
+        const_reverse_iterator rend() const;
+
+        // Capacity:
+        bool empty() const;
+        size_type size() const;
+        size_type max_size() const;
+        size_type capacity() const; // elements, which fit without growing the vector
+        void reserve( size_type n );
+
+        // Element access:
+        mapped_type& operator[]( const key_type& k );
+        mapped_type& at( const key_type& k );
+        const mapped_type& at( const key_type& k ) const;
+
+        // Modifiers:
+        ft::pair<iterator,bool> insert( const value_type& val ); // single element
+        iterator insert( iterator position, const value_type& val ); // with hint
+        template <typename InputIterator>
+            void insert( InputIterator first, InputIterator last ); // range: append, sort, merge
+        ft::pair<iterator,bool> try_insert( const key_type& k, const mapped_type& obj ); // insert( make_pair( k, obj ) ) without building the pair for an existing key
+        ft::pair<iterator,bool> insert_or_assign( const key_type& k, const mapped_type& obj ); // assigns obj, if k already exists
+        void erase( iterator position ); // iterator
+        size_type erase( const key_type& k ); // key
+        void erase( iterator first, iterator last ); // range
+        void swap( flat_map& x );
+        void clear(); // keeps the capacity
+
+        // Observers:
+        key_compare key_comp() const;
+        value_compare value_comp() const;
+
+        // Operations:
+        iterator find( const key_type& k );
+        const_iterator find( const key_type& k ) const;
+        size_type count( const key_type& k ) const;
+        iterator lower_bound( const key_type& k );
+        const_iterator lower_bound( const key_type& k ) const;
+        iterator upper_bound( const key_type& k );
+        const_iterator upper_bound( const key_type& k ) const;
+        ft::pair<const_iterator,const_iterator> equal_range( const key_type& k ) const;
+        ft::pair<iterator,iterator> equal_range( const key_type& k );
+
+        // Allocator:
+        allocator_type get_allocator() const;
+
+    }; // flat_map
+
+    /* flat_map member functions */
+    /* public */
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    flat_map<Key,T,Compare,Alloc>::flat_map( const key_compare& comp, const allocator_type& alloc ) // default constructor (empty container)
+    : tree( comp, alloc ) {}
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    template <typename InputIterator>
+    flat_map<Key,T,Compare,Alloc>::flat_map( InputIterator first, InputIterator last, const key_compare& comp,
+    const allocator_type& alloc ) // range constructor
+    : tree( comp, alloc )
+    {
+        this->insert( first, last );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    flat_map<Key,T,Compare,Alloc>::flat_map( const flat_map& src ) // copy constructor
+    : tree( src.tree ) {}
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    flat_map<Key,T,Compare,Alloc>::~flat_map() {} // destructor
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    flat_map<Key,T,Compare,Alloc>& flat_map<Key,T,Compare,Alloc>::operator=( const flat_map& other ) // assignment operator
+    {
+        if ( this != &other )
+        {
+            this->tree = other.tree;
+        }
+        return ( *this );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key,T,Compare,Alloc>::iterator flat_map<Key,T,Compare,Alloc>::begin()
+    {
+        return ( this->tree.begin() );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key,T,Compare,Alloc>::const_iterator flat_map<Key,T,Compare,Alloc>::begin() const
+    {
+        return ( this->tree.begin() );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key,T,Compare,Alloc>::iterator flat_map<Key,T,Compare,Alloc>::end()
+    {
+        return ( this->tree.end() );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key,T,Compare,Alloc>::const_iterator flat_map<Key,T,Compare,Alloc>::end() const
+    {
+        return ( this->tree.end() );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key,T,Compare,Alloc>::reverse_iterator flat_map<Key,T,Compare,Alloc>::rbegin()
+    {
+        return ( this->tree.rbegin() );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key,T,Compare,Alloc>::const_reverse_iterator flat_map<Key,T,Compare,Alloc>::rbegin() const
+    {
+        return ( this->tree.rbegin() );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key,T,Compare,Alloc>::reverse_iterator flat_map<Key,T,Compare,Alloc>::rend()
+    {
+        return ( this->tree.rend() );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key,T,Compare,Alloc>::const_reverse_iterator flat_map<Key,T,Compare,Alloc>::rend() const
+    {
+        return ( this->tree.rend() );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    bool flat_map<Key,T,Compare,Alloc>::empty() const
+    {
+        return ( this->tree.size() == 0 );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key,T,Compare,Alloc>::size_type flat_map<Key,T,Compare,Alloc>::size() const
+    {
+        return ( this->tree.size() );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key,T,Compare,Alloc>::size_type flat_map<Key,T,Compare,Alloc>::max_size() const
+    {
+        return ( this->tree.max_size() );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key,T,Compare,Alloc>::size_type flat_map<Key,T,Compare,Alloc>::capacity() const
+    {
+        return ( this->tree.capacity() );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    void flat_map<Key,T,Compare,Alloc>::reserve( size_type n )
+    {
+        this->tree.reserve( n );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key,T,Compare,Alloc>::mapped_type& flat_map<Key,T,Compare,Alloc>::operator[]( const key_type& k )
+    {
+        iterator position = this->tree.insert_key( k, ft::map_default_value<key_type, mapped_type, value_type>( k ) ).first;
+        return ( ( *( position ) ).second );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key,T,Compare,Alloc>::mapped_type& flat_map<Key,T,Compare,Alloc>::at( const key_type& k )
+    {
+        iterator position = this->find( k );
+
+        if ( position == this->end() )
+            throw std::out_of_range( "ft::flat_map" );
+        return ( ( *( position ) ).second );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    const typename flat_map<Key,T,Compare,Alloc>::mapped_type& flat_map<Key,T,Compare,Alloc>::at( const key_type& k ) const
+    {
+        const_iterator position = this->find( k );
+
+        if ( position == this->end() )
+            throw std::out_of_range( "ft::flat_map" );
+        return ( ( *( position ) ).second );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    ft::pair<typename flat_map<Key,T,Compare,Alloc>::iterator,bool> flat_map<Key,T,Compare,Alloc>::insert( const value_type& val ) // single element
+    {
+        return ( this->tree.insert( val ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key,T,Compare,Alloc>::iterator flat_map<Key,T,Compare,Alloc>::insert( iterator position, const value_type& val ) // with hint
+    {
+        return ( this->tree.insert( position, val ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    template <typename InputIterator>
+    void flat_map<Key,T,Compare,Alloc>::insert( InputIterator first, InputIterator last ) // range
+    {
+        this->tree.insert( first, last );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    ft::pair<typename flat_map<Key,T,Compare,Alloc>::iterator,bool> flat_map<Key,T,Compare,Alloc>::try_insert( const key_type& k, const mapped_type& obj )
+    {
+        return ( this->tree.insert_key( k, ft::map_key_value<key_type, mapped_type, value_type>( k, obj ) ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    ft::pair<typename flat_map<Key,T,Compare,Alloc>::iterator,bool> flat_map<Key,T,Compare,Alloc>::insert_or_assign( const key_type& k, const mapped_type& obj )
+    {
+        ft::pair<iterator,bool> result = this->tree.insert_key( k, ft::map_key_value<key_type, mapped_type, value_type>( k, obj ) );
+
+        if ( !( result.second ) )
+            result.first->second = obj;
+        return ( result );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    void flat_map<Key,T,Compare,Alloc>::erase( iterator position ) // iterator
+    {
+        this->tree.erase( position );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key,T,Compare,Alloc>::size_type flat_map<Key,T,Compare,Alloc>::erase( const key_type& k ) // key
+    {
+        return ( this->tree.erase( k ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    void flat_map<Key,T,Compare,Alloc>::erase( iterator first, iterator last ) // range
+    {
+        this->tree.erase( first, last );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    void flat_map<Key,T,Compare,Alloc>::swap( flat_map& x )
+    {
+        this->tree.swap( x.tree );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    void flat_map<Key,T,Compare,Alloc>::clear()
+    {
+        this->tree.clear();
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key,T,Compare,Alloc>::key_compare flat_map<Key,T,Compare,Alloc>::key_comp() const
+    {
+        return ( this->tree.key_comp() );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key,T,Compare,Alloc>::value_compare flat_map<Key,T,Compare,Alloc>::value_comp() const
+    {
+        return ( value_compare( this->tree.key_comp() ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key,T,Compare,Alloc>::iterator flat_map<Key,T,Compare,Alloc>::find( const key_type& k )
+    {
+        return ( this->tree.find( k ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key,T,Compare,Alloc>::const_iterator flat_map<Key,T,Compare,Alloc>::find( const key_type& k ) const
+    {
+        return ( this->tree.find( k ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key,T,Compare,Alloc>::size_type flat_map<Key,T,Compare,Alloc>::count( const key_type& k ) const
+    {
+        return ( this->tree.count( k ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key,T,Compare,Alloc>::iterator flat_map<Key,T,Compare,Alloc>::lower_bound( const key_type& k )
+    {
+        return ( this->tree.lower_bound( k ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key,T,Compare,Alloc>::const_iterator flat_map<Key,T,Compare,Alloc>::lower_bound( const key_type& k ) const
+    {
+        return ( this->tree.lower_bound( k ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key,T,Compare,Alloc>::iterator flat_map<Key,T,Compare,Alloc>::upper_bound( const key_type& k )
+    {
+        return ( this->tree.upper_bound( k ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key,T,Compare,Alloc>::const_iterator flat_map<Key,T,Compare,Alloc>::upper_bound( const key_type& k ) const
+    {
+        return ( this->tree.upper_bound( k ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    ft::pair<typename flat_map<Key,T,Compare,Alloc>::const_iterator,
+            typename flat_map<Key,T,Compare,Alloc>::const_iterator>
+            flat_map<Key,T,Compare,Alloc>::equal_range( const key_type& k ) const
+    {
+        return ( this->tree.equal_range( k ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    ft::pair<typename flat_map<Key,T,Compare,Alloc>::iterator,
+            typename flat_map<Key,T,Compare,Alloc>::iterator>
+            flat_map<Key,T,Compare,Alloc>::equal_range( const key_type& k )
+    {
+        return ( this->tree.equal_range( k ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key,T,Compare,Alloc>::allocator_type flat_map<Key,T,Compare,Alloc>::get_allocator() const
+    {
+        return ( this->tree.get_allocator() );
+    }
+
+    /* flat_map non-member functions */
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    inline bool operator==( const ft::flat_map<Key,T,Compare,Alloc>& lhs, const ft::flat_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return ( lhs.size() == rhs.size() && ft::equal( lhs.begin(), lhs.end(), rhs.begin() ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    inline bool operator!=( const ft::flat_map<Key,T,Compare,Alloc>& lhs, const ft::flat_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return ( !( lhs == rhs ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    inline bool operator<( const ft::flat_map<Key,T,Compare,Alloc>& lhs, const ft::flat_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return ( ft::lexicographical_compare( lhs.begin(), lhs.end(), rhs.begin(), rhs.end() ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    inline bool operator<=( const ft::flat_map<Key,T,Compare,Alloc>& lhs, const ft::flat_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return ( !( rhs < lhs ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    inline bool operator>( const ft::flat_map<Key,T,Compare,Alloc>& lhs, const ft::flat_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return ( rhs < lhs );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    inline bool operator>=( const ft::flat_map<Key,T,Compare,Alloc>& lhs, const ft::flat_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return ( !( lhs < rhs ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    void swap( ft::flat_map<Key,T,Compare,Alloc>& lhs, ft::flat_map<Key,T,Compare,Alloc>& rhs )
+    {
+        lhs.swap( rhs );
+    }
+
+} // namespace ft
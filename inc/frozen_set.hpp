@@ -0,0 +1,424 @@
+#pragma once
+
+#include <memory>
+
+#include "./vector.hpp"
+#include "./utils/algorithm.hpp"
+#include "./utils/eytzinger.hpp"
+#include "./utils/functional.hpp"
+#include "./utils/iterator.hpp"
+#include "./utils/type_traits.hpp"
+#include "./utils/utility.hpp"
+
+#ifndef nullptr
+#define nullptr NULL
+#endif
+
+namespace ft
+{
+
+    /* ----------------------------- frozen_set ----------------------------- */
+
+    /*
+    ** Not part of any C++ standard.
+    ** An immutable set with the lookups of ft::set, stored as one ft::vector
+    ** in Eytzinger order (see eytzinger.hpp). Built in O(n) from an ft::set
+    ** (set::freeze()) or from a range, which has to be sorted by Compare and
+    ** free of duplicates.
+    ** A search descends by index arithmetic alone: every level computes the
+    ** next position from one comparison, without a data dependent branch,
+    ** and prefetches the cache line of the descendants a few levels below.
+    ** Iterators are constant bidirectional iterators in sorted order, and
+    ** stay valid as long as the frozen_set lives.
+    ** value_type has to be copy assignable.
+    */
+
+    template < typename T,                                                      // frozen_set::key_type/value_type
+               typename Compare = less<T>,                                      // frozen_set::key_compare/value_compare
+               typename Alloc = std::allocator<T> >                             // frozen_set::allocator_type
+    class frozen_set
+    {
+    public:
+        typedef T                                                               key_type;
+        typedef T                                                               value_type;
+        typedef Compare                                                         key_compare;
+        typedef Compare                                                         value_compare;
+        typedef Alloc                                                           allocator_type;
+        typedef typename allocator_type::reference                              reference;
+        typedef typename allocator_type::const_reference                        const_reference;
+        typedef typename allocator_type::pointer                                pointer;
+        typedef typename allocator_type::const_pointer                          const_pointer;
+        typedef typename allocator_type::size_type                              size_type;
+        typedef typename allocator_type::difference_type                        difference_type;
+        typedef ft::eytzinger_iterator<value_type>                              iterator;
+        typedef ft::eytzinger_iterator<value_type>                              const_iterator;
+        typedef ft::reverse_iterator<iterator>                                  reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator>                            const_reverse_iterator;
+
+    private:
+        template <typename, typename, typename>
+            friend class set; // set::freeze() passes its size
+
+        typedef ft::vector<value_type, allocator_type>                          value_vector;
+        typedef typename ft::is_trivially_default_constructible<value_type>::type  _default_init_is_noop;
+
+        // a prefetch reaches the descendants this many times deeper: the ones in the same cache line
+        static const size_type  _prefetch_stride = ( sizeof( value_type ) <= 4 ) ? 16
+                                                    : ( sizeof( value_type ) <= 8 ) ? 8
+                                                    : ( sizeof( value_type ) <= 16 ) ? 4 : 2;
+
+        value_vector    _values; // position k of the tree at index k - 1
+        key_compare     _compare;
+
+    public:
+        // Constructors / Destructor / Assignment
+        explicit frozen_set( const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() ); // default constructor (empty container)
+        template <typename InputIterator>
+            frozen_set( InputIterator first, InputIterator last, const key_compare& comp = key_compare(),
+                    const allocator_type& alloc = allocator_type() ); // range constructor: sorted, no duplicates
+        frozen_set( const frozen_set& src ); // copy constructor
+        ~frozen_set(); // destructor
+
+        frozen_set& operator=( const frozen_set& other ); // assignment operator
+
+        // Iterators:
+        iterator begin() const;
+        iterator end() const;
+        reverse_iterator rbegin() const;
+        reverse_iterator rend() const;
+
+        // Capacity:
+        bool empty() const;
+        size_type size() const;
+        size_type max_size() const;
+
+        // Modifiers:
+        void swap( frozen_set& x );
+
+        // Observers:
+        key_compare key_comp() const;
+        value_compare value_comp() const;
+
+        // Operations:
+        iterator find( const value_type& val ) const;
+        size_type count( const value_type& val ) const;
+        iterator lower_bound( const value_type& val ) const;
+        iterator upper_bound( const value_type& val ) const;
+        ft::pair<iterator,iterator> equal_range( const value_type& val ) const;
+
+        // Allocator:
+        allocator_type get_allocator() const;
+
+    private:
+        template <typename InputIterator>
+            void _build( InputIterator first, InputIterator last, ft::input_iterator_tag );
+        template <typename ForwardIterator>
+            void _build( ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag );
+        template <typename ForwardIterator>
+            void _build_sorted( ForwardIterator first, size_type n );
+        void _allocate( size_type n, const value_type& val, ft::true_type );
+        void _allocate( size_type n, const value_type& val, ft::false_type );
+        iterator _make_iter( size_type position ) const;
+        size_type _lower_bound_position( const value_type& val ) const;
+        size_type _upper_bound_position( const value_type& val ) const;
+
+    }; // frozen_set
+
+    template <typename T, typename Compare, typename Alloc>
+    const typename frozen_set<T,Compare,Alloc>::size_type frozen_set<T,Compare,Alloc>::_prefetch_stride;
+
+    /* frozen_set member functions */
+    /* public */
+
+    template <typename T, typename Compare, typename Alloc>
+    frozen_set<T,Compare,Alloc>::frozen_set( const key_compare& comp, const allocator_type& alloc ) // default constructor (empty container)
+    : _values( alloc ), _compare( comp ) {}
+
+    template <typename T, typename Compare, typename Alloc>
+    template <typename InputIterator>
+    frozen_set<T,Compare,Alloc>::frozen_set( InputIterator first, InputIterator last, const key_compare& comp,
+    const allocator_type& alloc ) // range constructor
+    : _values( alloc ), _compare( comp )
+    {
+        this->_build( first, last, typename ft::iterator_traits<InputIterator>::iterator_category() );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    frozen_set<T,Compare,Alloc>::frozen_set( const frozen_set& src ) // copy constructor
+    : _values( src._values ), _compare( src._compare ) {}
+
+    template <typename T, typename Compare, typename Alloc>
+    frozen_set<T,Compare,Alloc>::~frozen_set() {} // destructor
+
+    template <typename T, typename Compare, typename Alloc>
+    frozen_set<T,Compare,Alloc>& frozen_set<T,Compare,Alloc>::operator=( const frozen_set& other ) // assignment operator
+    {
+        if ( this != &other )
+        {
+            this->_values = other._values;
+            this->_compare = other._compare;
+        }
+        return ( *this );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    typename frozen_set<T,Compare,Alloc>::iterator frozen_set<T,Compare,Alloc>::begin() const
+    {
+        return ( this->_make_iter( ft::eytzinger_first( this->_values.size() ) ) );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    typename frozen_set<T,Compare,Alloc>::iterator frozen_set<T,Compare,Alloc>::end() const
+    {
+        return ( this->_make_iter( 0 ) );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    typename frozen_set<T,Compare,Alloc>::reverse_iterator frozen_set<T,Compare,Alloc>::rbegin() const
+    {
+        return ( reverse_iterator( this->end() ) );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    typename frozen_set<T,Compare,Alloc>::reverse_iterator frozen_set<T,Compare,Alloc>::rend() const
+    {
+        return ( reverse_iterator( this->begin() ) );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    bool frozen_set<T,Compare,Alloc>::empty() const
+    {
+        return ( this->_values.size() == 0 );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    typename frozen_set<T,Compare,Alloc>::size_type frozen_set<T,Compare,Alloc>::size() const
+    {
+        return ( this->_values.size() );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    typename frozen_set<T,Compare,Alloc>::size_type frozen_set<T,Compare,Alloc>::max_size() const
+    {
+        return ( this->_values.max_size() );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    void frozen_set<T,Compare,Alloc>::swap( frozen_set& x )
+    {
+        this->_values.swap( x._values );
+        ft::swap( this->_compare, x._compare );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    typename frozen_set<T,Compare,Alloc>::key_compare frozen_set<T,Compare,Alloc>::key_comp() const
+    {
+        return ( this->_compare );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    typename frozen_set<T,Compare,Alloc>::value_compare frozen_set<T,Compare,Alloc>::value_comp() const
+    {
+        return ( this->_compare );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    typename frozen_set<T,Compare,Alloc>::iterator frozen_set<T,Compare,Alloc>::find( const value_type& val ) const
+    {
+        size_type   position = this->_lower_bound_position( val );
+
+        if ( position == 0 || this->_compare( val, this->_values[position - 1] ) )
+            return ( this->end() );
+        return ( this->_make_iter( position ) );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    typename frozen_set<T,Compare,Alloc>::size_type frozen_set<T,Compare,Alloc>::count( const value_type& val ) const
+    {
+        return ( ( this->find( val ) == this->end() ) ? 0 : 1 );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    typename frozen_set<T,Compare,Alloc>::iterator frozen_set<T,Compare,Alloc>::lower_bound( const value_type& val ) const
+    {
+        return ( this->_make_iter( this->_lower_bound_position( val ) ) );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    typename frozen_set<T,Compare,Alloc>::iterator frozen_set<T,Compare,Alloc>::upper_bound( const value_type& val ) const
+    {
+        return ( this->_make_iter( this->_upper_bound_position( val ) ) );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    ft::pair<typename frozen_set<T,Compare,Alloc>::iterator,
+            typename frozen_set<T,Compare,Alloc>::iterator>
+            frozen_set<T,Compare,Alloc>::equal_range( const value_type& val ) const
+    {
+        iterator    first = this->lower_bound( val );
+        iterator    last = first;
+
+        if ( last != this->end() && !( this->_compare( val, *( last ) ) ) )
+            ++last;
+        return ( ft::make_pair( first, last ) );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    typename frozen_set<T,Compare,Alloc>::allocator_type frozen_set<T,Compare,Alloc>::get_allocator() const
+    {
+        return ( this->_values.get_allocator() );
+    }
+
+    /* private */
+
+    // A single pass range can not be counted up front: it is copied first.
+    template <typename T, typename Compare, typename Alloc>
+    template <typename InputIterator>
+    void frozen_set<T,Compare,Alloc>::_build( InputIterator first, InputIterator last, ft::input_iterator_tag )
+    {
+        value_vector    sorted( first, last, this->_values.get_allocator() );
+
+        this->_build( sorted.begin(), sorted.end(), ft::forward_iterator_tag() );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    template <typename ForwardIterator>
+    void frozen_set<T,Compare,Alloc>::_build( ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag )
+    {
+        this->_build_sorted( first, ft::distance( first, last ) );
+    }
+
+    // Walks the positions in order, while the n elements from first are read in order: O(n).
+    template <typename T, typename Compare, typename Alloc>
+    template <typename ForwardIterator>
+    void frozen_set<T,Compare,Alloc>::_build_sorted( ForwardIterator first, size_type n )
+    {
+        size_type   position = ft::eytzinger_first( n );
+
+        if ( n == 0 )
+            return ;
+        this->_allocate( n, *first, _default_init_is_noop() );
+        for ( size_type i = 0; i < n; ++i, ++first )
+        {
+            this->_values[position - 1] = *first;
+            position = ft::eytzinger_next( position, n );
+        }
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    void frozen_set<T,Compare,Alloc>::_allocate( size_type n, __attribute__( ( unused ) ) const value_type& val, ft::true_type )
+    {
+        this->_values.resize_default_init( n );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    void frozen_set<T,Compare,Alloc>::_allocate( size_type n, const value_type& val, ft::false_type )
+    {
+        this->_values.assign( n, val );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    inline typename frozen_set<T,Compare,Alloc>::iterator frozen_set<T,Compare,Alloc>::_make_iter( size_type position ) const
+    {
+        if ( this->_values.size() == 0 )
+            return ( iterator() );
+        return ( iterator( &( this->_values[0] ), this->_values.size(), position ) );
+    }
+
+    /*
+    ** Goes right, while the element is less than val, and left otherwise. The
+    ** position, where the descent falls off the tree, encodes the path: the
+    ** last left turn was at the node, whose position remains after shifting
+    ** out the trailing right turns (ones) and that left turn (a zero).
+    ** Each level prefetches the descendants _prefetch_stride times deeper,
+    ** which sit side by side; the last element caps the address. The
+    ** prefetch stays in the loop: GCC drops calls to a function, which does
+    ** nothing but prefetch.
+    */
+    template <typename T, typename Compare, typename Alloc>
+    typename frozen_set<T,Compare,Alloc>::size_type frozen_set<T,Compare,Alloc>::_lower_bound_position( const value_type& val ) const
+    {
+        const size_type n = this->_values.size();
+        size_type       position = 1;
+
+        if ( n == 0 )
+            return ( 0 );
+
+        const value_type*   data = &( this->_values[0] );
+
+        while ( position <= n )
+        {
+            size_type   ahead = position * _prefetch_stride;
+
+            __builtin_prefetch( static_cast<const void*>( data + ( ( ahead < n ) ? ahead : n - 1 ) ) );
+            position = 2 * position + this->_compare( data[position - 1], val );
+        }
+        return ( position >> ( __builtin_ctzl( static_cast<unsigned long>( ~position ) ) + 1 ) );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    typename frozen_set<T,Compare,Alloc>::size_type frozen_set<T,Compare,Alloc>::_upper_bound_position( const value_type& val ) const
+    {
+        const size_type n = this->_values.size();
+        size_type       position = 1;
+
+        if ( n == 0 )
+            return ( 0 );
+
+        const value_type*   data = &( this->_values[0] );
+
+        while ( position <= n )
+        {
+            size_type   ahead = position * _prefetch_stride;
+
+            __builtin_prefetch( static_cast<const void*>( data + ( ( ahead < n ) ? ahead : n - 1 ) ) );
+            position = 2 * position + !( this->_compare( val, data[position - 1] ) );
+        }
+        return ( position >> ( __builtin_ctzl( static_cast<unsigned long>( ~position ) ) + 1 ) );
+    }
+
+    /* frozen_set non-member functions */
+
+    template <typename T, typename Compare, typename Alloc>
+    inline bool operator==( const ft::frozen_set<T,Compare,Alloc>& lhs, const ft::frozen_set<T,Compare,Alloc>& rhs )
+    {
+        return ( lhs.size() == rhs.size() && ft::equal( lhs.begin(), lhs.end(), rhs.begin() ) );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    inline bool operator!=( const ft::frozen_set<T,Compare,Alloc>& lhs, const ft::frozen_set<T,Compare,Alloc>& rhs )
+    {
+        return ( !( lhs == rhs ) );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    inline bool operator<( const ft::frozen_set<T,Compare,Alloc>& lhs, const ft::frozen_set<T,Compare,Alloc>& rhs )
+    {
+        return ( ft::lexicographical_compare( lhs.begin(), lhs.end(), rhs.begin(), rhs.end() ) );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    inline bool operator<=( const ft::frozen_set<T,Compare,Alloc>& lhs, const ft::frozen_set<T,Compare,Alloc>& rhs )
+    {
+        return ( !( rhs < lhs ) );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    inline bool operator>( const ft::frozen_set<T,Compare,Alloc>& lhs, const ft::frozen_set<T,Compare,Alloc>& rhs )
+    {
+        return ( rhs < lhs );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    inline bool operator>=( const ft::frozen_set<T,Compare,Alloc>& lhs, const ft::frozen_set<T,Compare,Alloc>& rhs )
+    {
+        return ( !( lhs < rhs ) );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    void swap( ft::frozen_set<T,Compare,Alloc>& lhs, ft::frozen_set<T,Compare,Alloc>& rhs )
+    {
+        lhs.swap( rhs );
+    }
+
+} // namespace ft
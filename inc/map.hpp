@@ -6,6 +6,7 @@
 #include "./utils/algorithm.hpp"
 #include "./utils/functional.hpp"
 #include "./utils/iterator.hpp"
+#include "./utils/memory.hpp"
 #include "./utils/tree.hpp"
 #include "./utils/type_traits.hpp"
 #include "./utils/utility.hpp"
@@ -261,6 +262,19 @@ namespace ft
         return ( !( lhs == rhs ) );
     }
 
+    // O(log n) for a ranked map (see ft::ranked), by the distance of the tree iterators
+    template <typename TreeIterator>
+    inline typename map_iterator<TreeIterator>::difference_type distance( map_iterator<TreeIterator> first, map_iterator<TreeIterator> last )
+    {
+        return ( ft::distance( first.base(), last.base() ) );
+    }
+
+    template <typename TreeIterator>
+    inline typename map_const_iterator<TreeIterator>::difference_type distance( map_const_iterator<TreeIterator> first, map_const_iterator<TreeIterator> last )
+    {
+        return ( ft::distance( first.base(), last.base() ) );
+    }
+
 
     /* --------------------------------- map -------------------------------- */
 
@@ -332,7 +346,7 @@ namespace ft
 
 
     private:
-        typedef ft::red_black_tree<value_type, value_compare, allocator_type>   base;
+        typedef ft::red_black_tree<value_type, key_compare, allocator_type, ft::select1st<value_type> >  base;
 
         base    tree;
 
@@ -349,6 +363,9 @@ namespace ft
         template <typename InputIterator>
             map( InputIterator first, InputIterator last, const key_compare& comp = key_compare(),
                     const allocator_type& alloc = allocator_type() ); // range constructor
+        template <typename InputIterator>
+            map( ft::sorted_unique_t, InputIterator first, InputIterator last, const key_compare& comp = key_compare(),
+                    const allocator_type& alloc = allocator_type() ); // extension: range constructor, [first, last) sorted and unique
         map( const map& src ); // copy constructor
         ~map(); // destructor
 
@@ -379,11 +396,16 @@ namespace ft
         iterator insert( iterator position, const value_type& val ); // with hint
         template <typename InputIterator>
             void insert( InputIterator first, InputIterator last ); // range
+        template <typename InputIterator>
+            void insert( ft::sorted_unique_t, InputIterator first, InputIterator last ); // extension: range, [first, last) sorted and unique
+        ft::pair<iterator,bool> try_insert( const key_type& k, const mapped_type& obj ); // extension: insert( make_pair( k, obj ) ) without building the pair for an existing key
+        ft::pair<iterator,bool> insert_or_assign( const key_type& k, const mapped_type& obj ); // extension: assigns obj, if k already exists
         void erase( iterator position ); // iterator
         size_type erase( const key_type& k ); // key
         void erase( iterator first, iterator last ); // range
         void swap( map& x );
         void clear();
+        map extract_range( iterator first, iterator last ); // extension: moves [first, last) into a new map in O(log n) (+ O(last - first), if not ranked)
 
         // Observers:
         key_compare key_comp() const;
@@ -399,6 +421,19 @@ namespace ft
         const_iterator upper_bound( const key_type& k ) const;
         ft::pair<const_iterator,const_iterator> equal_range( const key_type& k ) const;
         ft::pair<iterator,iterator> equal_range( const key_type& k );
+        ft::pair<iterator,iterator> bounds( const key_type& lo, const key_type& hi ); // extension: [lower_bound( lo ), upper_bound( hi )) in one descent
+        ft::pair<const_iterator,const_iterator> bounds( const key_type& lo, const key_type& hi ) const; // extension
+        template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type find( const K& k ); // extension: heterogeneous lookup
+        template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, const_iterator>::type find( const K& k ) const; // extension: heterogeneous lookup
+        template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type lower_bound( const K& k ); // extension: heterogeneous lookup
+        template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, const_iterator>::type lower_bound( const K& k ) const; // extension: heterogeneous lookup
+        iterator nth( size_type n ); // extension: n-th element in key order, end() if n >= size(). Needs a ranked key_compare (see ft::ranked)
+        const_iterator nth( size_type n ) const; // extension
+        size_type rank( const key_type& k ) const; // extension: number of elements with a key less than k. Needs a ranked key_compare
 
         // Allocator:
         allocator_type get_allocator() const;
@@ -413,17 +448,26 @@ namespace ft
 
     template <typename Key, typename T, typename Compare, typename Alloc>
     map<Key,T,Compare,Alloc>::map( const key_compare& comp, const allocator_type& alloc ) // default constructor (empty container)
-    : tree( value_compare( comp ), alloc ) {}
+    : tree( comp, alloc ) {}
 
     template <typename Key, typename T, typename Compare, typename Alloc>
     template <typename InputIterator>
     map<Key,T,Compare,Alloc>::map( InputIterator first, InputIterator last, const key_compare& comp,
     const allocator_type& alloc ) // range constructor
-    : tree( value_compare( comp ), alloc )
+    : tree( comp, alloc )
     {
         this->insert( first, last );
     }
 
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    template <typename InputIterator>
+    map<Key,T,Compare,Alloc>::map( ft::sorted_unique_t, InputIterator first, InputIterator last, const key_compare& comp,
+    const allocator_type& alloc ) // extension: range constructor, [first, last) sorted and unique
+    : tree( comp, alloc )
+    {
+        this->insert( ft::sorted_unique, first, last );
+    }
+
     template <typename Key, typename T, typename Compare, typename Alloc>
     map<Key,T,Compare,Alloc>::map( const map& src ) // copy constructor
     : tree( src.tree ) {}
@@ -515,10 +559,11 @@ namespace ft
     // A similar member function, map::at, has the same behavior when an element with the key exists, but throws an exception when it does not.
     // A call to this function is equivalent to:
     // (*((this->insert(make_pair(k,mapped_type()))).first)).second
+    // Here the tree is only descended once, the pair is only built, if k is missing.
     template <typename Key, typename T, typename Compare, typename Alloc>
     typename map<Key,T,Compare,Alloc>::mapped_type& map<Key,T,Compare,Alloc>::operator[]( const key_type& k )
     {
-        iterator position = this->insert( ft::make_pair( k, mapped_type() ) ).first;
+        iterator position = this->tree.insert_key( k, ft::map_default_value<key_type, mapped_type>( k ) ).first;
         return ( ( *( position ) ).second );
     }
 
@@ -564,6 +609,35 @@ namespace ft
         this->tree.insert( first, last );
     }
 
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    template <typename InputIterator>
+    void map<Key,T,Compare,Alloc>::insert( ft::sorted_unique_t, InputIterator first, InputIterator last ) // extension: range, [first, last) sorted and unique
+    {
+        this->tree.insert( ft::sorted_unique, first, last );
+    }
+
+    // Not part of the C++98 standard (compare try_emplace of C++17).
+    // Inserts ( k, obj ), if k is missing. Otherwise nothing is built or copied,
+    // the iterator points to the existing element.
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    ft::pair<typename map<Key,T,Compare,Alloc>::iterator,bool> map<Key,T,Compare,Alloc>::try_insert( const key_type& k, const mapped_type& obj )
+    {
+        return ( this->tree.insert_key( k, ft::map_key_value<key_type, mapped_type>( k, obj ) ) );
+    }
+
+    // Not part of the C++98 standard (compare C++17).
+    // Inserts ( k, obj ), if k is missing, otherwise assigns obj to the mapped value of k.
+    // The bool is true for an insertion, false for an assignment.
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    ft::pair<typename map<Key,T,Compare,Alloc>::iterator,bool> map<Key,T,Compare,Alloc>::insert_or_assign( const key_type& k, const mapped_type& obj )
+    {
+        ft::pair<iterator,bool> result = this->tree.insert_key( k, ft::map_key_value<key_type, mapped_type>( k, obj ) );
+
+        if ( !( result.second ) )
+            result.first->second = obj;
+        return ( result );
+    }
+
     template <typename Key, typename T, typename Compare, typename Alloc>
     void map<Key,T,Compare,Alloc>::erase( iterator position ) // iterator
     {
@@ -573,7 +647,7 @@ namespace ft
     template <typename Key, typename T, typename Compare, typename Alloc>
     typename map<Key,T,Compare,Alloc>::size_type map<Key,T,Compare,Alloc>::erase( const key_type& k ) // key
     {
-        return ( this->tree.erase( ft::make_pair( k, mapped_type() ) ) );
+        return ( this->tree.erase( k ) );
     }
 
     template <typename Key, typename T, typename Compare, typename Alloc>
@@ -582,6 +656,15 @@ namespace ft
         this->tree.erase( first.base(), last.base() );
     }
 
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    map<Key,T,Compare,Alloc> map<Key,T,Compare,Alloc>::extract_range( iterator first, iterator last )
+    {
+        map extracted( this->key_comp(), this->get_allocator() );
+
+        this->tree.extract_range( first.base(), last.base(), extracted.tree );
+        return ( extracted );
+    }
+
     template <typename Key, typename T, typename Compare, typename Alloc>
     void map<Key,T,Compare,Alloc>::swap( map& x )
     {
@@ -597,55 +680,55 @@ namespace ft
     template <typename Key, typename T, typename Compare, typename Alloc>
     typename map<Key,T,Compare,Alloc>::key_compare map<Key,T,Compare,Alloc>::key_comp() const
     {
-        return ( key_compare() );
+        return ( this->tree.key_comp() );
     }
 
     template <typename Key, typename T, typename Compare, typename Alloc>
     typename map<Key,T,Compare,Alloc>::value_compare map<Key,T,Compare,Alloc>::value_comp() const
     {
-        return ( this->tree.value_comp() );
+        return ( value_compare( this->tree.key_comp() ) );
     }
 
     template <typename Key, typename T, typename Compare, typename Alloc>
     typename map<Key,T,Compare,Alloc>::iterator map<Key,T,Compare,Alloc>::find( const key_type& k )
     {
-        return ( this->tree.find( ft::make_pair( k, mapped_type() ) ) );
+        return ( this->tree.find( k ) );
     }
 
     template <typename Key, typename T, typename Compare, typename Alloc>
     typename map<Key,T,Compare,Alloc>::const_iterator map<Key,T,Compare,Alloc>::find( const key_type& k ) const
     {
-        return ( this->tree.find( ft::make_pair( k, mapped_type() ) ) );
+        return ( this->tree.find( k ) );
     }
 
     template <typename Key, typename T, typename Compare, typename Alloc>
     typename map<Key,T,Compare,Alloc>::size_type map<Key,T,Compare,Alloc>::count( const key_type& k ) const
     {
-        return ( this->tree.count( ft::make_pair( k, mapped_type() ) ) );
+        return ( this->tree.count( k ) );
     }
     
     template <typename Key, typename T, typename Compare, typename Alloc>
     typename map<Key,T,Compare,Alloc>::iterator map<Key,T,Compare,Alloc>::lower_bound( const key_type& k )
     {
-        return ( this->tree.lower_bound( ft::make_pair( k, mapped_type() ) ) );
+        return ( this->tree.lower_bound( k ) );
     }
     
     template <typename Key, typename T, typename Compare, typename Alloc>
     typename map<Key,T,Compare,Alloc>::const_iterator map<Key,T,Compare,Alloc>::lower_bound( const key_type& k ) const
     {
-        return ( this->tree.lower_bound( ft::make_pair( k, mapped_type() ) ) );
+        return ( this->tree.lower_bound( k ) );
     }
     
     template <typename Key, typename T, typename Compare, typename Alloc>
     typename map<Key,T,Compare,Alloc>::iterator map<Key,T,Compare,Alloc>::upper_bound( const key_type& k )
     {
-        return ( this->tree.upper_bound( ft::make_pair( k, mapped_type() ) ) );
+        return ( this->tree.upper_bound( k ) );
     }
     
     template <typename Key, typename T, typename Compare, typename Alloc>
     typename map<Key,T,Compare,Alloc>::const_iterator map<Key,T,Compare,Alloc>::upper_bound( const key_type& k ) const
     {
-        return ( this->tree.upper_bound( ft::make_pair( k, mapped_type() ) ) );
+        return ( this->tree.upper_bound( k ) );
     }
     
     template <typename Key, typename T, typename Compare, typename Alloc>
@@ -653,7 +736,7 @@ namespace ft
             typename map<Key,T,Compare,Alloc>::const_iterator> 
             map<Key,T,Compare,Alloc>::equal_range( const key_type& k ) const
     {
-        return ( this->tree.equal_range( ft::make_pair( k, mapped_type() ) ) );
+        return ( this->tree.equal_range( k ) );
     }
     
     template <typename Key, typename T, typename Compare, typename Alloc>
@@ -661,7 +744,79 @@ namespace ft
             typename map<Key,T,Compare,Alloc>::iterator> 
             map<Key,T,Compare,Alloc>::equal_range( const key_type& k )
     {
-        return ( this->tree.equal_range( ft::make_pair( k, mapped_type() ) ) );
+        return ( this->tree.equal_range( k ) );
+    }
+
+    // Not part of any C++ standard.
+    // The elements with a key in [lo, hi], found with a single descent that
+    // only forks at the first node inside the interval. Empty, if hi < lo.
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    ft::pair<typename map<Key,T,Compare,Alloc>::iterator,
+            typename map<Key,T,Compare,Alloc>::iterator>
+            map<Key,T,Compare,Alloc>::bounds( const key_type& lo, const key_type& hi )
+    {
+        return ( this->tree.bounds( lo, hi ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    ft::pair<typename map<Key,T,Compare,Alloc>::const_iterator,
+            typename map<Key,T,Compare,Alloc>::const_iterator>
+            map<Key,T,Compare,Alloc>::bounds( const key_type& lo, const key_type& hi ) const
+    {
+        return ( this->tree.bounds( lo, hi ) );
+    }
+
+    // Not part of the C++98 standard (compare C++14).
+    // Only available, if key_compare is transparent (e.g. ft::less<void>):
+    // k is compared with the keys directly, no key_type is constructed from it.
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    template <typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename map<Key,T,Compare,Alloc>::iterator>::type
+    map<Key,T,Compare,Alloc>::find( const K& k )
+    {
+        return ( this->tree.find( k ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    template <typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename map<Key,T,Compare,Alloc>::const_iterator>::type
+    map<Key,T,Compare,Alloc>::find( const K& k ) const
+    {
+        return ( this->tree.find( k ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    template <typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename map<Key,T,Compare,Alloc>::iterator>::type
+    map<Key,T,Compare,Alloc>::lower_bound( const K& k )
+    {
+        return ( this->tree.lower_bound( k ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    template <typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename map<Key,T,Compare,Alloc>::const_iterator>::type
+    map<Key,T,Compare,Alloc>::lower_bound( const K& k ) const
+    {
+        return ( this->tree.lower_bound( k ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename map<Key,T,Compare,Alloc>::iterator map<Key,T,Compare,Alloc>::nth( size_type n )
+    {
+        return ( this->tree.nth( n ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename map<Key,T,Compare,Alloc>::const_iterator map<Key,T,Compare,Alloc>::nth( size_type n ) const
+    {
+        return ( this->tree.nth( n ) );
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    typename map<Key,T,Compare,Alloc>::size_type map<Key,T,Compare,Alloc>::rank( const key_type& k ) const
+    {
+        return ( this->tree.rank( k ) );
     }
 
     template <typename Key, typename T, typename Compare, typename Alloc>
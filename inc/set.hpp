@@ -3,9 +3,11 @@
 #include <memory>
 #include <stdexcept>
 
+#include "./frozen_set.hpp"
 #include "./utils/algorithm.hpp"
 #include "./utils/functional.hpp"
 #include "./utils/iterator.hpp"
+#include "./utils/memory.hpp"
 #include "./utils/tree.hpp"
 #include "./utils/type_traits.hpp"
 #include "./utils/utility.hpp"
@@ -49,7 +51,7 @@ namespace ft
         typedef typename allocator_type::difference_type                        difference_type;
 
     private:
-        typedef ft::red_black_tree<value_type, value_compare, allocator_type>   base;
+        typedef ft::red_black_tree<value_type, key_compare, allocator_type>     base;
 
         base    tree;
 
@@ -65,6 +67,9 @@ namespace ft
         template <typename InputIterator>
             set( InputIterator first, InputIterator last, const key_compare& comp = key_compare(),
                     const allocator_type& alloc = allocator_type() ); // range constructor
+        template <typename InputIterator>
+            set( ft::sorted_unique_t, InputIterator first, InputIterator last, const key_compare& comp = key_compare(),
+                    const allocator_type& alloc = allocator_type() ); // extension: range constructor, [first, last) sorted and unique
         set( const set& src ); // copy constructor
         ~set(); // destructor
 
@@ -90,11 +95,17 @@ namespace ft
         iterator insert( iterator position, const value_type& val ); // with hint
         template <typename InputIterator>
             void insert( InputIterator first, InputIterator last ); // range
+        template <typename InputIterator>
+            void insert( ft::sorted_unique_t, InputIterator first, InputIterator last ); // extension: range, [first, last) sorted and unique
         void erase( iterator position ); // iterator
         size_type erase( const value_type& val ); // key
         void erase( iterator first, iterator last ); // range
         void swap( set& x );
         void clear();
+        set extract_range( iterator first, iterator last ); // extension: moves [first, last) into a new set in O(log n) (+ O(last - first), if not ranked)
+        void set_union( const set& x ); // extension: inserts the elements of x, O(m log(n / m + 1)) with m = x.size()
+        void set_intersection( const set& x ); // extension: erases the elements not in x, O(m log(n / m + 1))
+        void set_difference( const set& x ); // extension: erases the elements in x, O(m log(n / m + 1))
 
         // Observers:
         key_compare key_comp() const;
@@ -106,6 +117,14 @@ namespace ft
         iterator lower_bound( const value_type& val ) const;
         iterator upper_bound( const value_type& val ) const;
         ft::pair<iterator,iterator> equal_range( const value_type& val ) const;
+        ft::pair<iterator,iterator> bounds( const value_type& lo, const value_type& hi ) const; // extension: [lower_bound( lo ), upper_bound( hi )) in one descent
+        template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type find( const K& k ) const; // extension: heterogeneous lookup
+        template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type lower_bound( const K& k ) const; // extension: heterogeneous lookup
+        iterator nth( size_type n ) const; // extension: n-th element in order, end() if n >= size(). Needs a ranked key_compare (see ft::ranked)
+        size_type rank( const value_type& val ) const; // extension: number of elements less than val. Needs a ranked key_compare
+        ft::frozen_set<T,Compare,Alloc> freeze() const; // extension: a copy for lookups only, in Eytzinger order. O(n)
 
         // Allocator:
         allocator_type get_allocator() const;
@@ -131,6 +150,15 @@ namespace ft
         this->insert( first, last );
     }
 
+    template <typename T, typename Compare, typename Alloc>
+    template <typename InputIterator>
+    set<T,Compare,Alloc>::set( ft::sorted_unique_t, InputIterator first, InputIterator last, const key_compare& comp,
+    const allocator_type& alloc ) // extension: range constructor, [first, last) sorted and unique
+    : tree( comp, alloc )
+    {
+        this->insert( ft::sorted_unique, first, last );
+    }
+
     template <typename T, typename Compare, typename Alloc>
     set<T,Compare,Alloc>::set( const set& src ) // copy constructor
     : tree( src.tree ) {}
@@ -221,9 +249,9 @@ namespace ft
     }
 
     template <typename T, typename Compare, typename Alloc>
-    typename set<T,Compare,Alloc>::iterator set<T,Compare,Alloc>::insert(__attribute__((unused)) iterator position, const value_type& val ) // with hint
+    typename set<T,Compare,Alloc>::iterator set<T,Compare,Alloc>::insert( iterator position, const value_type& val ) // with hint
     {
-        return ( this->tree.insert( val ).first );
+        return ( this->tree.insert( position, val ) );
     }
 
     template <typename T, typename Compare, typename Alloc>
@@ -233,6 +261,13 @@ namespace ft
         this->tree.insert( first, last );
     }
 
+    template <typename T, typename Compare, typename Alloc>
+    template <typename InputIterator>
+    void set<T,Compare,Alloc>::insert( ft::sorted_unique_t, InputIterator first, InputIterator last ) // extension: range, [first, last) sorted and unique
+    {
+        this->tree.insert( ft::sorted_unique, first, last );
+    }
+
     template <typename T, typename Compare, typename Alloc>
     void set<T,Compare,Alloc>::erase( iterator position ) // iterator
     {
@@ -248,8 +283,34 @@ namespace ft
     template <typename T, typename Compare, typename Alloc>
     void set<T,Compare,Alloc>::erase( iterator first, iterator last ) // range
     {
-        while ( first != last )
-        this->tree.erase( *( first++ ) );
+        this->tree.erase( first, last );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    set<T,Compare,Alloc> set<T,Compare,Alloc>::extract_range( iterator first, iterator last )
+    {
+        set extracted( this->key_comp(), this->get_allocator() );
+
+        this->tree.extract_range( first, last, extracted.tree );
+        return ( extracted );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    void set<T,Compare,Alloc>::set_union( const set& x )
+    {
+        this->tree.set_union( x.tree );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    void set<T,Compare,Alloc>::set_intersection( const set& x )
+    {
+        this->tree.set_intersection( x.tree );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    void set<T,Compare,Alloc>::set_difference( const set& x )
+    {
+        this->tree.set_difference( x.tree );
     }
 
     template <typename T, typename Compare, typename Alloc>
@@ -267,13 +328,13 @@ namespace ft
     template <typename T, typename Compare, typename Alloc>
     typename set<T,Compare,Alloc>::key_compare set<T,Compare,Alloc>::key_comp() const
     {
-        return ( key_compare() );
+        return ( this->tree.key_comp() );
     }
 
     template <typename T, typename Compare, typename Alloc>
     typename set<T,Compare,Alloc>::value_compare set<T,Compare,Alloc>::value_comp() const
     {
-        return ( this->tree.value_comp() );
+        return ( this->tree.key_comp() );
     }
 
     template <typename T, typename Compare, typename Alloc>
@@ -308,6 +369,58 @@ namespace ft
         return ( this->tree.equal_range( val ) );
     }
 
+    // Not part of any C++ standard.
+    // The elements in [lo, hi], found with a single descent that only forks
+    // at the first node inside the interval. Empty, if hi < lo.
+    template <typename T, typename Compare, typename Alloc>
+    ft::pair<typename set<T,Compare,Alloc>::iterator,
+            typename set<T,Compare,Alloc>::iterator>
+            set<T,Compare,Alloc>::bounds( const value_type& lo, const value_type& hi ) const
+    {
+        return ( this->tree.bounds( lo, hi ) );
+    }
+
+    // Not part of the C++98 standard (compare C++14).
+    // Only available, if key_compare is transparent (e.g. ft::less<void>):
+    // k is compared with the elements directly, no value_type is constructed from it.
+    template <typename T, typename Compare, typename Alloc>
+    template <typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename set<T,Compare,Alloc>::iterator>::type
+    set<T,Compare,Alloc>::find( const K& k ) const
+    {
+        return ( this->tree.find( k ) );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    template <typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename set<T,Compare,Alloc>::iterator>::type
+    set<T,Compare,Alloc>::lower_bound( const K& k ) const
+    {
+        return ( this->tree.lower_bound( k ) );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    typename set<T,Compare,Alloc>::iterator set<T,Compare,Alloc>::nth( size_type n ) const
+    {
+        return ( this->tree.nth( n ) );
+    }
+
+    template <typename T, typename Compare, typename Alloc>
+    typename set<T,Compare,Alloc>::size_type set<T,Compare,Alloc>::rank( const value_type& val ) const
+    {
+        return ( this->tree.rank( val ) );
+    }
+
+    // A single in-order walk of the tree, which places every element.
+    template <typename T, typename Compare, typename Alloc>
+    ft::frozen_set<T,Compare,Alloc> set<T,Compare,Alloc>::freeze() const
+    {
+        ft::frozen_set<T,Compare,Alloc>     frozen( this->key_comp(), this->get_allocator() );
+
+        frozen._build_sorted( this->begin(), this->size() );
+        return ( frozen );
+    }
+
     template <typename T, typename Compare, typename Alloc>
     typename set<T,Compare,Alloc>::allocator_type set<T,Compare,Alloc>::get_allocator() const
     {
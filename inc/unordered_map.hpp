@@ -0,0 +1,415 @@
+#pragma once
+
+#include <memory>
+#include <stdexcept>
+
+#include "./utils/functional.hpp"
+#include "./utils/hash_table.hpp"
+#include "./utils/iterator.hpp"
+#include "./utils/utility.hpp"
+
+#ifndef nullptr
+#define nullptr NULL
+#endif
+
+namespace ft
+{
+
+    /* ---------------------------- unordered_map --------------------------- */
+
+    /*
+    ** Not part of the C++98 standard (compare std::unordered_map of C++11).
+    ** A map without an order, stored in an ft::hash_table: the elements live
+    ** in the slots of one ft::vector, and a lookup probes a few groups of
+    ** control bytes instead of descending a tree. Meant for point lookups:
+    ** find(), count(), at() and operator[] take expected constant time.
+    ** Differences to ft::map:
+    ** - iterators are forward iterators, and the order of the elements is
+    **   unspecified; inserting may rehash, which invalidates all iterators,
+    **   but pointers and references stay valid until a rehash
+    ** - keys need a Hash (ft::hash covers the built-in types and
+    **   std::string) and a KeyEqual instead of a Compare
+    ** - reserve(), rehash() and max_load_factor() control the number of slots
+    */
+
+    template < typename Key,                                                    // unordered_map::key_type
+               typename T,                                                      // unordered_map::mapped_type
+               typename Hash = ft::hash<Key>,                                   // unordered_map::hasher
+               typename KeyEqual = ft::equal_to<Key>,                           // unordered_map::key_equal
+               typename Alloc = std::allocator<ft::pair<const Key, T> > >       // unordered_map::allocator_type
+    class unordered_map
+    {
+    public:
+        typedef Key                                                             key_type;
+        typedef T                                                               mapped_type;
+        typedef ft::pair<const key_type, mapped_type>                           value_type;
+        typedef Hash                                                            hasher;
+        typedef KeyEqual                                                        key_equal;
+        typedef Alloc                                                           allocator_type;
+        typedef typename allocator_type::reference                              reference;
+        typedef typename allocator_type::const_reference                        const_reference;
+        typedef typename allocator_type::pointer                                pointer;
+        typedef typename allocator_type::const_pointer                          const_pointer;
+        typedef typename allocator_type::size_type                              size_type;
+        typedef typename allocator_type::difference_type                        difference_type;
+
+    private:
+        typedef ft::hash_table<value_type, hasher, key_equal, allocator_type, ft::select1st<value_type> >  base;
+
+        base    table;
+
+
+    public:
+        typedef typename base::iterator                                         iterator;
+        typedef typename base::const_iterator                                   const_iterator;
+
+        // Constructors / Destructor / Assignment
+        explicit unordered_map( size_type n = 0, const hasher& hf = hasher(), const key_equal& eql = key_equal(),
+                const allocator_type& alloc = allocator_type() ); // default constructor (empty container)
+        template <typename InputIterator>
+            unordered_map( InputIterator first, InputIterator last, size_type n = 0, const hasher& hf = hasher(),
+                    const key_equal& eql = key_equal(), const allocator_type& alloc = allocator_type() ); // range constructor
+        unordered_map( const unordered_map& src ); // copy constructor
+        ~unordered_map(); // destructor
+
+        unordered_map& operator=( const unordered_map& other ); // assignment operator
+
+        // Iterators:
+        iterator begin();
+        const_iterator begin() const;
+        iterator end();
+        const_iterator end() const;
+
+        // Capacity:
+        bool empty() const;
+        size_type size() const;
+        size_type max_size() const;
+
+        // Element access:
+        mapped_type& operator[]( const key_type& k );
+        mapped_type& at( const key_type& k );
+        const mapped_type& at( const key_type& k ) const;
+
+        // Modifiers:
+        ft::pair<iterator,bool> insert( const value_type& val ); // single element
+        iterator insert( iterator position, const value_type& val ); // with hint (ignored)
+        template <typename InputIterator>
+            void insert( InputIterator first, InputIterator last ); // range
+        ft::pair<iterator,bool> try_insert( const key_type& k, const mapped_type& obj ); // insert( make_pair( k, obj ) ) without building the pair for an existing key
+        ft::pair<iterator,bool> insert_or_assign( const key_type& k, const mapped_type& obj ); // assigns obj, if k already exists
+        void erase( iterator position ); // iterator
+        size_type erase( const key_type& k ); // key
+        void erase( iterator first, iterator last ); // range
+        void swap( unordered_map& x );
+        void clear(); // keeps the slots
+
+        // Operations:
+        iterator find( const key_type& k );
+        const_iterator find( const key_type& k ) const;
+        size_type count( const key_type& k ) const;
+        ft::pair<iterator,iterator> equal_range( const key_type& k );
+        ft::pair<const_iterator,const_iterator> equal_range( const key_type& k ) const;
+
+        // Hash policy:
+        size_type bucket_count() const; // the number of slots
+        float load_factor() const;
+        float max_load_factor() const;
+        void max_load_factor( float ml ); // at most 1, the default is 0.875
+        void rehash( size_type n );
+        void reserve( size_type n ); // room for n elements without a rehash
+
+        // Observers:
+        hasher hash_function() const;
+        key_equal key_eq() const;
+        allocator_type get_allocator() const;
+
+    }; // unordered_map
+
+    /* unordered_map member functions */
+    /* public */
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    unordered_map<Key,T,Hash,KeyEqual,Alloc>::unordered_map( size_type n, const hasher& hf, const key_equal& eql, const allocator_type& alloc ) // default constructor (empty container)
+    : table( n, hf, eql, alloc ) {}
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    template <typename InputIterator>
+    unordered_map<Key,T,Hash,KeyEqual,Alloc>::unordered_map( InputIterator first, InputIterator last, size_type n, const hasher& hf,
+    const key_equal& eql, const allocator_type& alloc ) // range constructor
+    : table( n, hf, eql, alloc )
+    {
+        this->insert( first, last );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    unordered_map<Key,T,Hash,KeyEqual,Alloc>::unordered_map( const unordered_map& src ) // copy constructor
+    : table( src.table ) {}
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    unordered_map<Key,T,Hash,KeyEqual,Alloc>::~unordered_map() {} // destructor
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    unordered_map<Key,T,Hash,KeyEqual,Alloc>& unordered_map<Key,T,Hash,KeyEqual,Alloc>::operator=( const unordered_map& other ) // assignment operator
+    {
+        if ( this != &other )
+        {
+            this->table = other.table;
+        }
+        return ( *this );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key,T,Hash,KeyEqual,Alloc>::iterator unordered_map<Key,T,Hash,KeyEqual,Alloc>::begin()
+    {
+        return ( this->table.begin() );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key,T,Hash,KeyEqual,Alloc>::const_iterator unordered_map<Key,T,Hash,KeyEqual,Alloc>::begin() const
+    {
+        return ( this->table.begin() );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key,T,Hash,KeyEqual,Alloc>::iterator unordered_map<Key,T,Hash,KeyEqual,Alloc>::end()
+    {
+        return ( this->table.end() );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key,T,Hash,KeyEqual,Alloc>::const_iterator unordered_map<Key,T,Hash,KeyEqual,Alloc>::end() const
+    {
+        return ( this->table.end() );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    bool unordered_map<Key,T,Hash,KeyEqual,Alloc>::empty() const
+    {
+        return ( this->table.size() == 0 );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key,T,Hash,KeyEqual,Alloc>::size_type unordered_map<Key,T,Hash,KeyEqual,Alloc>::size() const
+    {
+        return ( this->table.size() );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key,T,Hash,KeyEqual,Alloc>::size_type unordered_map<Key,T,Hash,KeyEqual,Alloc>::max_size() const
+    {
+        return ( this->table.max_size() );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key,T,Hash,KeyEqual,Alloc>::mapped_type& unordered_map<Key,T,Hash,KeyEqual,Alloc>::operator[]( const key_type& k )
+    {
+        iterator position = this->table.insert_key( k, ft::map_default_value<key_type, mapped_type>( k ) ).first;
+        return ( ( *( position ) ).second );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key,T,Hash,KeyEqual,Alloc>::mapped_type& unordered_map<Key,T,Hash,KeyEqual,Alloc>::at( const key_type& k )
+    {
+        iterator position = this->find( k );
+
+        if ( position == this->end() )
+            throw std::out_of_range( "ft::unordered_map" );
+        return ( ( *( position ) ).second );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    const typename unordered_map<Key,T,Hash,KeyEqual,Alloc>::mapped_type& unordered_map<Key,T,Hash,KeyEqual,Alloc>::at( const key_type& k ) const
+    {
+        const_iterator position = this->find( k );
+
+        if ( position == this->end() )
+            throw std::out_of_range( "ft::unordered_map" );
+        return ( ( *( position ) ).second );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    ft::pair<typename unordered_map<Key,T,Hash,KeyEqual,Alloc>::iterator,bool> unordered_map<Key,T,Hash,KeyEqual,Alloc>::insert( const value_type& val ) // single element
+    {
+        return ( this->table.insert( val ) );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key,T,Hash,KeyEqual,Alloc>::iterator unordered_map<Key,T,Hash,KeyEqual,Alloc>::insert( __attribute__( ( unused ) ) iterator position, const value_type& val ) // with hint
+    {
+        return ( this->table.insert( val ).first );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    template <typename InputIterator>
+    void unordered_map<Key,T,Hash,KeyEqual,Alloc>::insert( InputIterator first, InputIterator last ) // range
+    {
+        this->table.insert( first, last );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    ft::pair<typename unordered_map<Key,T,Hash,KeyEqual,Alloc>::iterator,bool> unordered_map<Key,T,Hash,KeyEqual,Alloc>::try_insert( const key_type& k, const mapped_type& obj )
+    {
+        return ( this->table.insert_key( k, ft::map_key_value<key_type, mapped_type>( k, obj ) ) );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    ft::pair<typename unordered_map<Key,T,Hash,KeyEqual,Alloc>::iterator,bool> unordered_map<Key,T,Hash,KeyEqual,Alloc>::insert_or_assign( const key_type& k, const mapped_type& obj )
+    {
+        ft::pair<iterator,bool> result = this->table.insert_key( k, ft::map_key_value<key_type, mapped_type>( k, obj ) );
+
+        if ( !( result.second ) )
+            result.first->second = obj;
+        return ( result );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    void unordered_map<Key,T,Hash,KeyEqual,Alloc>::erase( iterator position ) // iterator
+    {
+        this->table.erase( position );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key,T,Hash,KeyEqual,Alloc>::size_type unordered_map<Key,T,Hash,KeyEqual,Alloc>::erase( const key_type& k ) // key
+    {
+        return ( this->table.erase( k ) );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    void unordered_map<Key,T,Hash,KeyEqual,Alloc>::erase( iterator first, iterator last ) // range
+    {
+        this->table.erase( first, last );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    void unordered_map<Key,T,Hash,KeyEqual,Alloc>::swap( unordered_map& x )
+    {
+        this->table.swap( x.table );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    void unordered_map<Key,T,Hash,KeyEqual,Alloc>::clear()
+    {
+        this->table.clear();
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key,T,Hash,KeyEqual,Alloc>::iterator unordered_map<Key,T,Hash,KeyEqual,Alloc>::find( const key_type& k )
+    {
+        return ( this->table.find( k ) );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key,T,Hash,KeyEqual,Alloc>::const_iterator unordered_map<Key,T,Hash,KeyEqual,Alloc>::find( const key_type& k ) const
+    {
+        return ( this->table.find( k ) );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key,T,Hash,KeyEqual,Alloc>::size_type unordered_map<Key,T,Hash,KeyEqual,Alloc>::count( const key_type& k ) const
+    {
+        return ( this->table.count( k ) );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    ft::pair<typename unordered_map<Key,T,Hash,KeyEqual,Alloc>::iterator,
+            typename unordered_map<Key,T,Hash,KeyEqual,Alloc>::iterator>
+            unordered_map<Key,T,Hash,KeyEqual,Alloc>::equal_range( const key_type& k )
+    {
+        return ( this->table.equal_range( k ) );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    ft::pair<typename unordered_map<Key,T,Hash,KeyEqual,Alloc>::const_iterator,
+            typename unordered_map<Key,T,Hash,KeyEqual,Alloc>::const_iterator>
+            unordered_map<Key,T,Hash,KeyEqual,Alloc>::equal_range( const key_type& k ) const
+    {
+        return ( this->table.equal_range( k ) );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key,T,Hash,KeyEqual,Alloc>::size_type unordered_map<Key,T,Hash,KeyEqual,Alloc>::bucket_count() const
+    {
+        return ( this->table.bucket_count() );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    float unordered_map<Key,T,Hash,KeyEqual,Alloc>::load_factor() const
+    {
+        return ( this->table.load_factor() );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    float unordered_map<Key,T,Hash,KeyEqual,Alloc>::max_load_factor() const
+    {
+        return ( this->table.max_load_factor() );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    void unordered_map<Key,T,Hash,KeyEqual,Alloc>::max_load_factor( float ml )
+    {
+        this->table.max_load_factor( ml );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    void unordered_map<Key,T,Hash,KeyEqual,Alloc>::rehash( size_type n )
+    {
+        this->table.rehash( n );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    void unordered_map<Key,T,Hash,KeyEqual,Alloc>::reserve( size_type n )
+    {
+        this->table.reserve( n );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key,T,Hash,KeyEqual,Alloc>::hasher unordered_map<Key,T,Hash,KeyEqual,Alloc>::hash_function() const
+    {
+        return ( this->table.hash_function() );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key,T,Hash,KeyEqual,Alloc>::key_equal unordered_map<Key,T,Hash,KeyEqual,Alloc>::key_eq() const
+    {
+        return ( this->table.key_eq() );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key,T,Hash,KeyEqual,Alloc>::allocator_type unordered_map<Key,T,Hash,KeyEqual,Alloc>::get_allocator() const
+    {
+        return ( this->table.get_allocator() );
+    }
+
+    /* unordered_map non-member functions */
+
+    // Equal, if both hold the same elements, in whatever order.
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    bool operator==( const ft::unordered_map<Key,T,Hash,KeyEqual,Alloc>& lhs, const ft::unordered_map<Key,T,Hash,KeyEqual,Alloc>& rhs )
+    {
+        typedef typename ft::unordered_map<Key,T,Hash,KeyEqual,Alloc>::const_iterator    const_iterator;
+
+        if ( lhs.size() != rhs.size() )
+            return ( false );
+        for ( const_iterator it = lhs.begin(); it != lhs.end(); ++it )
+        {
+            const_iterator  other = rhs.find( it->first );
+
+            if ( other == rhs.end() || !( *( other ) == *( it ) ) )
+                return ( false );
+        }
+        return ( true );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    inline bool operator!=( const ft::unordered_map<Key,T,Hash,KeyEqual,Alloc>& lhs, const ft::unordered_map<Key,T,Hash,KeyEqual,Alloc>& rhs )
+    {
+        return ( !( lhs == rhs ) );
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    void swap( ft::unordered_map<Key,T,Hash,KeyEqual,Alloc>& lhs, ft::unordered_map<Key,T,Hash,KeyEqual,Alloc>& rhs )
+    {
+        lhs.swap( rhs );
+    }
+
+} // namespace ft
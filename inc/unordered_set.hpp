@@ -0,0 +1,322 @@
+#pragma once
+
+#include <memory>
+
+#include "./utils/functional.hpp"
+#include "./utils/hash_table.hpp"
+#include "./utils/iterator.hpp"
+#include "./utils/utility.hpp"
+
+#ifndef nullptr
+#define nullptr NULL
+#endif
+
+namespace ft
+{
+
+    /* ---------------------------- unordered_set --------------------------- */
+
+    /*
+    ** Not part of the C++98 standard (compare std::unordered_set of C++11).
+    ** A set without an order, stored in an ft::hash_table (see unordered_map
+    ** for the differences to the tree based containers).
+    ** Iterators are constant forward iterators.
+    */
+
+    template < typename T,                                                      // unordered_set::key_type/value_type
+               typename Hash = ft::hash<T>,                                     // unordered_set::hasher
+               typename KeyEqual = ft::equal_to<T>,                             // unordered_set::key_equal
+               typename Alloc = std::allocator<T> >                             // unordered_set::allocator_type
+    class unordered_set
+    {
+    public:
+        typedef T                                                               key_type;
+        typedef T                                                               value_type;
+        typedef Hash                                                            hasher;
+        typedef KeyEqual                                                        key_equal;
+        typedef Alloc                                                           allocator_type;
+        typedef typename allocator_type::reference                              reference;
+        typedef typename allocator_type::const_reference                        const_reference;
+        typedef typename allocator_type::pointer                                pointer;
+        typedef typename allocator_type::const_pointer                          const_pointer;
+        typedef typename allocator_type::size_type                              size_type;
+        typedef typename allocator_type::difference_type                        difference_type;
+
+    private:
+        typedef ft::hash_table<value_type, hasher, key_equal, allocator_type>  base;
+
+        base    table;
+
+    public:
+        typedef typename base::const_iterator                                   iterator;
+        typedef typename base::const_iterator                                   const_iterator;
+
+    public:
+        // Constructors / Destructor / Assignment
+        explicit unordered_set( size_type n = 0, const hasher& hf = hasher(), const key_equal& eql = key_equal(),
+                const allocator_type& alloc = allocator_type() ); // default constructor (empty container)
+        template <typename InputIterator>
+            unordered_set( InputIterator first, InputIterator last, size_type n = 0, const hasher& hf = hasher(),
+                    const key_equal& eql = key_equal(), const allocator_type& alloc = allocator_type() ); // range constructor
+        unordered_set( const unordered_set& src ); // copy constructor
+        ~unordered_set(); // destructor
+
+        unordered_set& operator=( const unordered_set& other ); // assignment operator
+
+        // Iterators:
+        iterator begin() const;
+        iterator end() const;
+
+        // Capacity:
+        bool empty() const;
+        size_type size() const;
+        size_type max_size() const;
+
+        // Modifiers:
+        ft::pair<iterator,bool> insert( const value_type& val ); // single element
+        iterator insert( iterator position, const value_type& val ); // with hint (ignored)
+        template <typename InputIterator>
+            void insert( InputIterator first, InputIterator last ); // range
+        void erase( iterator position ); // iterator
+        size_type erase( const value_type& val ); // key
+        void erase( iterator first, iterator last ); // range
+        void swap( unordered_set& x );
+        void clear(); // keeps the slots
+
+        // Operations:
+        iterator find( const value_type& val ) const;
+        size_type count( const value_type& val ) const;
+        ft::pair<iterator,iterator> equal_range( const value_type& val ) const;
+
+        // Hash policy:
+        size_type bucket_count() const; // the number of slots
+        float load_factor() const;
+        float max_load_factor() const;
+        void max_load_factor( float ml ); // at most 1, the default is 0.875
+        void rehash( size_type n );
+        void reserve( size_type n ); // room for n elements without a rehash
+
+        // Observers:
+        hasher hash_function() const;
+        key_equal key_eq() const;
+        allocator_type get_allocator() const;
+
+    }; // unordered_set
+
+    /* unordered_set member functions */
+    /* public */
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    unordered_set<T,Hash,KeyEqual,Alloc>::unordered_set( size_type n, const hasher& hf, const key_equal& eql, const allocator_type& alloc ) // default constructor (empty container)
+    : table( n, hf, eql, alloc ) {}
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    template <typename InputIterator>
+    unordered_set<T,Hash,KeyEqual,Alloc>::unordered_set( InputIterator first, InputIterator last, size_type n, const hasher& hf,
+    const key_equal& eql, const allocator_type& alloc ) // range constructor
+    : table( n, hf, eql, alloc )
+    {
+        this->insert( first, last );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    unordered_set<T,Hash,KeyEqual,Alloc>::unordered_set( const unordered_set& src ) // copy constructor
+    : table( src.table ) {}
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    unordered_set<T,Hash,KeyEqual,Alloc>::~unordered_set() {} // destructor
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    unordered_set<T,Hash,KeyEqual,Alloc>& unordered_set<T,Hash,KeyEqual,Alloc>::operator=( const unordered_set& other ) // assignment operator
+    {
+        if ( this != &other )
+        {
+            this->table = other.table;
+        }
+        return ( *this );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_set<T,Hash,KeyEqual,Alloc>::iterator unordered_set<T,Hash,KeyEqual,Alloc>::begin() const
+    {
+        return ( this->table.begin() );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_set<T,Hash,KeyEqual,Alloc>::iterator unordered_set<T,Hash,KeyEqual,Alloc>::end() const
+    {
+        return ( this->table.end() );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    bool unordered_set<T,Hash,KeyEqual,Alloc>::empty() const
+    {
+        return ( this->table.size() == 0 );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_set<T,Hash,KeyEqual,Alloc>::size_type unordered_set<T,Hash,KeyEqual,Alloc>::size() const
+    {
+        return ( this->table.size() );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_set<T,Hash,KeyEqual,Alloc>::size_type unordered_set<T,Hash,KeyEqual,Alloc>::max_size() const
+    {
+        return ( this->table.max_size() );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    ft::pair<typename unordered_set<T,Hash,KeyEqual,Alloc>::iterator,bool> unordered_set<T,Hash,KeyEqual,Alloc>::insert( const value_type& val ) // single element
+    {
+        return ( this->table.insert( val ) );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_set<T,Hash,KeyEqual,Alloc>::iterator unordered_set<T,Hash,KeyEqual,Alloc>::insert( __attribute__( ( unused ) ) iterator position, const value_type& val ) // with hint
+    {
+        return ( this->table.insert( val ).first );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    template <typename InputIterator>
+    void unordered_set<T,Hash,KeyEqual,Alloc>::insert( InputIterator first, InputIterator last ) // range
+    {
+        this->table.insert( first, last );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    void unordered_set<T,Hash,KeyEqual,Alloc>::erase( iterator position ) // iterator
+    {
+        this->table.erase( position );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_set<T,Hash,KeyEqual,Alloc>::size_type unordered_set<T,Hash,KeyEqual,Alloc>::erase( const value_type& val ) // key
+    {
+        return ( this->table.erase( val ) );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    void unordered_set<T,Hash,KeyEqual,Alloc>::erase( iterator first, iterator last ) // range
+    {
+        this->table.erase( first, last );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    void unordered_set<T,Hash,KeyEqual,Alloc>::swap( unordered_set& x )
+    {
+        this->table.swap( x.table );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    void unordered_set<T,Hash,KeyEqual,Alloc>::clear()
+    {
+        this->table.clear();
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_set<T,Hash,KeyEqual,Alloc>::iterator unordered_set<T,Hash,KeyEqual,Alloc>::find( const value_type& val ) const
+    {
+        return ( this->table.find( val ) );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_set<T,Hash,KeyEqual,Alloc>::size_type unordered_set<T,Hash,KeyEqual,Alloc>::count( const value_type& val ) const
+    {
+        return ( this->table.count( val ) );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    ft::pair<typename unordered_set<T,Hash,KeyEqual,Alloc>::iterator,
+            typename unordered_set<T,Hash,KeyEqual,Alloc>::iterator>
+            unordered_set<T,Hash,KeyEqual,Alloc>::equal_range( const value_type& val ) const
+    {
+        return ( this->table.equal_range( val ) );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_set<T,Hash,KeyEqual,Alloc>::size_type unordered_set<T,Hash,KeyEqual,Alloc>::bucket_count() const
+    {
+        return ( this->table.bucket_count() );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    float unordered_set<T,Hash,KeyEqual,Alloc>::load_factor() const
+    {
+        return ( this->table.load_factor() );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    float unordered_set<T,Hash,KeyEqual,Alloc>::max_load_factor() const
+    {
+        return ( this->table.max_load_factor() );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    void unordered_set<T,Hash,KeyEqual,Alloc>::max_load_factor( float ml )
+    {
+        this->table.max_load_factor( ml );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    void unordered_set<T,Hash,KeyEqual,Alloc>::rehash( size_type n )
+    {
+        this->table.rehash( n );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    void unordered_set<T,Hash,KeyEqual,Alloc>::reserve( size_type n )
+    {
+        this->table.reserve( n );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_set<T,Hash,KeyEqual,Alloc>::hasher unordered_set<T,Hash,KeyEqual,Alloc>::hash_function() const
+    {
+        return ( this->table.hash_function() );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_set<T,Hash,KeyEqual,Alloc>::key_equal unordered_set<T,Hash,KeyEqual,Alloc>::key_eq() const
+    {
+        return ( this->table.key_eq() );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_set<T,Hash,KeyEqual,Alloc>::allocator_type unordered_set<T,Hash,KeyEqual,Alloc>::get_allocator() const
+    {
+        return ( this->table.get_allocator() );
+    }
+
+    /* unordered_set non-member functions */
+
+    // Equal, if both hold the same elements, in whatever order.
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    bool operator==( const ft::unordered_set<T,Hash,KeyEqual,Alloc>& lhs, const ft::unordered_set<T,Hash,KeyEqual,Alloc>& rhs )
+    {
+        typedef typename ft::unordered_set<T,Hash,KeyEqual,Alloc>::const_iterator    const_iterator;
+
+        if ( lhs.size() != rhs.size() )
+            return ( false );
+        for ( const_iterator it = lhs.begin(); it != lhs.end(); ++it )
+        {
+            if ( rhs.find( *( it ) ) == rhs.end() )
+                return ( false );
+        }
+        return ( true );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    inline bool operator!=( const ft::unordered_set<T,Hash,KeyEqual,Alloc>& lhs, const ft::unordered_set<T,Hash,KeyEqual,Alloc>& rhs )
+    {
+        return ( !( lhs == rhs ) );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc>
+    void swap( ft::unordered_set<T,Hash,KeyEqual,Alloc>& lhs, ft::unordered_set<T,Hash,KeyEqual,Alloc>& rhs )
+    {
+        lhs.swap( rhs );
+    }
+
+} // namespace ft
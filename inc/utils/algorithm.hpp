@@ -114,4 +114,42 @@ namespace   ft
         return result;
     }
 
+
+    /* ----------------------------- copy_backward -------------------------- */
+
+    /*
+    ** (https://cplusplus.com/reference/algorithm/copy_backward/)
+    ** Copies the elements in the range [first,last) starting from the end into the range terminating at result.
+    ** The function returns an iterator to the first element in the destination range.
+    ** The resulting range has the elements in the exact same order as [first,last).
+    ** The ranges shall not overlap in such a way that result points to an element in the range (first,last].
+    */
+
+    template<class BidirectionalIterator1, class BidirectionalIterator2>
+    BidirectionalIterator2 copy_backward( BidirectionalIterator1 first, BidirectionalIterator1 last,
+                                            BidirectionalIterator2 result )
+    {
+        while ( last != first )
+            *( --result ) = *( --last );
+        return result;
+    }
+
+
+    /* --------------------------------- fill ------------------------------- */
+
+    /*
+    ** (https://cplusplus.com/reference/algorithm/fill/)
+    ** Assigns val to all the elements in the range [first,last).
+    */
+
+    template <class ForwardIterator, class T>
+    void fill( ForwardIterator first, ForwardIterator last, const T& val )
+    {
+        while ( first != last )
+        {
+            *first = val;
+            ++first;
+        }
+    }
+
 } // namespace  ft
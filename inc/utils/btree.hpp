@@ -0,0 +1,1427 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+
+#include "./iterator.hpp"
+#include "./functional.hpp"
+#include "./type_traits.hpp"
+#include "./utility.hpp"
+
+#ifndef nullptr
+#define nullptr NULL
+#endif
+
+namespace ft
+{
+
+    /* ----------------------------- btree nodes ---------------------------- */
+
+    /*
+    ** The nodes of a btree (a B+ tree): every element lives in a leaf, and
+    ** the leaves are linked to their neighbours, so iterating never climbs
+    ** the tree. Internal nodes only hold copies of keys, which route a search
+    ** to the right child. Both kinds start with btree_node_base, so a parent
+    ** or child link is a btree_node_base* and _leaf tells what it points to.
+    **
+    ** Slots are raw storage: only the first _count of them hold constructed
+    ** objects. The unions keep them aligned like pool_allocator's chunks.
+    */
+
+    const std::size_t   btree_node_bytes = 256; // four cache lines of 64 bytes
+
+    struct btree_node_base
+    {
+        btree_node_base*    _parent; // nullptr for the root
+        unsigned short      _position; // index in the _children of _parent
+        unsigned short      _count; // elements of a leaf, keys of an internal node
+        bool                _leaf;
+    }; // btree_node_base
+
+    template <typename T, std::size_t Slots>
+    struct btree_leaf : public btree_node_base
+    {
+        union _storage
+        {
+            char            bytes[sizeof( T ) * Slots];
+            long double     _align_ld;
+            long            _align_l;
+            void*           _align_p;
+        };
+
+        btree_leaf*     _prev; // nullptr for the left-most leaf
+        btree_leaf*     _next; // nullptr for the right-most leaf
+        _storage        _values;
+
+        T* values();
+        const T* values() const;
+    }; // btree_leaf
+
+    // _children[i] holds the keys less than _keys[i], _children[i + 1] the ones not less.
+    template <typename Key, std::size_t Slots>
+    struct btree_internal : public btree_node_base
+    {
+        union _storage
+        {
+            char            bytes[sizeof( Key ) * ( Slots - 1 )];
+            long double     _align_ld;
+            long            _align_l;
+            void*           _align_p;
+        };
+
+        btree_node_base*    _children[Slots];
+        _storage            _keys;
+
+        Key* keys();
+        const Key* keys() const;
+    }; // btree_internal
+
+    /* btree node member functions */
+
+    template <typename T, std::size_t Slots>
+    inline T* btree_leaf<T, Slots>::values()
+    {
+        return ( reinterpret_cast<T*>( this->_values.bytes ) );
+    }
+
+    template <typename T, std::size_t Slots>
+    inline const T* btree_leaf<T, Slots>::values() const
+    {
+        return ( reinterpret_cast<const T*>( this->_values.bytes ) );
+    }
+
+    template <typename Key, std::size_t Slots>
+    inline Key* btree_internal<Key, Slots>::keys()
+    {
+        return ( reinterpret_cast<Key*>( this->_keys.bytes ) );
+    }
+
+    template <typename Key, std::size_t Slots>
+    inline const Key* btree_internal<Key, Slots>::keys() const
+    {
+        return ( reinterpret_cast<const Key*>( this->_keys.bytes ) );
+    }
+
+    /*
+    ** Fan-out: as many slots as fit into btree_node_bytes next to the node's
+    ** links, but at least 4, so a split or a merge always leaves both halves
+    ** with elements. A leaf of ints holds 56 of them, an internal node with
+    ** int keys has 20 children.
+    */
+
+    template <typename T>
+    struct btree_leaf_slots
+    {
+        static const std::size_t    _header = sizeof( btree_node_base ) + 2 * sizeof( void* );
+        static const std::size_t    _fit = ( btree_node_bytes > _header ) ? ( btree_node_bytes - _header ) / sizeof( T ) : 0;
+        static const std::size_t    value = ( _fit > 4 ) ? _fit : 4;
+    };
+
+    template <typename Key>
+    struct btree_internal_slots
+    {
+        static const std::size_t    _fit = ( btree_node_bytes - sizeof( btree_node_base ) + sizeof( Key ) ) / ( sizeof( Key ) + sizeof( void* ) );
+        static const std::size_t    value = ( _fit > 4 ) ? _fit : 4;
+    };
+
+
+    /* ---------------------------- BTree Iterator -------------------------- */
+
+    /*
+    ** A bidirectional_iterator: a leaf and a slot in it. end() is the slot
+    ** behind the last element of the right-most leaf (or no leaf at all, if
+    ** the tree is empty), any other iterator points to an element.
+    */
+
+    template <typename T, std::size_t Slots>
+    class btree_iterator
+    {
+
+    public:
+        typedef bidirectional_iterator_tag          iterator_category;
+        typedef T                                   value_type;
+        typedef ptrdiff_t                           difference_type;
+        typedef T*                                  pointer;
+        typedef T&                                  reference;
+        typedef btree_leaf<T, Slots>*               leaf_ptr;
+
+    private:
+        leaf_ptr        _leaf;
+        std::size_t     _index;
+
+    public:
+        btree_iterator();
+        btree_iterator( leaf_ptr leaf, std::size_t index );
+        btree_iterator( const btree_iterator& other );
+        ~btree_iterator();
+
+        btree_iterator& operator=( const btree_iterator& src );
+
+        leaf_ptr base() const;
+        std::size_t index() const;
+        reference operator*() const;
+        pointer operator->() const;
+        btree_iterator& operator++();
+        btree_iterator  operator++(int);
+        btree_iterator& operator--();
+        btree_iterator  operator--(int);
+
+    }; // btree_iterator
+
+    /* btree_iterator member functions */
+
+    template <typename T, std::size_t Slots>
+    btree_iterator<T, Slots>::btree_iterator() : _leaf( nullptr ), _index( 0 ) {}
+
+    template <typename T, std::size_t Slots>
+    btree_iterator<T, Slots>::btree_iterator( leaf_ptr leaf, std::size_t index ) : _leaf( leaf ), _index( index ) {}
+
+    template <typename T, std::size_t Slots>
+    btree_iterator<T, Slots>::btree_iterator( const btree_iterator& other ) : _leaf( other._leaf ), _index( other._index ) {}
+
+    template <typename T, std::size_t Slots>
+    btree_iterator<T, Slots>::~btree_iterator() {}
+
+    template <typename T, std::size_t Slots>
+    btree_iterator<T, Slots>& btree_iterator<T, Slots>::operator=( const btree_iterator& src )
+    {
+        this->_leaf = src._leaf;
+        this->_index = src._index;
+        return ( *( this ) );
+    }
+
+    template <typename T, std::size_t Slots>
+    typename btree_iterator<T, Slots>::leaf_ptr btree_iterator<T, Slots>::base() const
+    {
+        return ( this->_leaf );
+    }
+
+    template <typename T, std::size_t Slots>
+    std::size_t btree_iterator<T, Slots>::index() const
+    {
+        return ( this->_index );
+    }
+
+    template <typename T, std::size_t Slots>
+    typename btree_iterator<T, Slots>::reference btree_iterator<T, Slots>::operator*() const
+    {
+        return ( this->_leaf->values()[this->_index] );
+    }
+
+    template <typename T, std::size_t Slots>
+    typename btree_iterator<T, Slots>::pointer btree_iterator<T, Slots>::operator->() const
+    {
+        return ( this->_leaf->values() + this->_index );
+    }
+
+    // Stays behind the last element of the right-most leaf: that is end().
+    template <typename T, std::size_t Slots>
+    btree_iterator<T, Slots>& btree_iterator<T, Slots>::operator++()
+    {
+        if ( ++( this->_index ) == this->_leaf->_count && this->_leaf->_next != nullptr )
+        {
+            this->_leaf = this->_leaf->_next;
+            this->_index = 0;
+        }
+        return ( *( this ) );
+    }
+
+    template <typename T, std::size_t Slots>
+    btree_iterator<T, Slots>  btree_iterator<T, Slots>::operator++( int )
+    {
+        btree_iterator  it = *( this );
+
+        ++( *( this ) );
+        return ( it );
+    }
+
+    template <typename T, std::size_t Slots>
+    btree_iterator<T, Slots>& btree_iterator<T, Slots>::operator--()
+    {
+        if ( this->_index == 0 )
+        {
+            this->_leaf = this->_leaf->_prev;
+            this->_index = this->_leaf->_count;
+        }
+        --( this->_index );
+        return ( *( this ) );
+    }
+
+    template <typename T, std::size_t Slots>
+    btree_iterator<T, Slots>  btree_iterator<T, Slots>::operator--( int )
+    {
+        btree_iterator  it = *( this );
+
+        --( *( this ) );
+        return ( it );
+    }
+
+    /* btree_iterator non-member functions */
+
+    template <typename T, std::size_t Slots>
+    inline bool operator==( const btree_iterator<T, Slots>& lhs, const btree_iterator<T, Slots>& rhs )
+    {
+        return ( lhs.base() == rhs.base() && lhs.index() == rhs.index() );
+    }
+
+    template <typename T, std::size_t Slots>
+    inline bool operator!=( const btree_iterator<T, Slots>& lhs, const btree_iterator<T, Slots>& rhs )
+    {
+        return ( !( lhs == rhs ) );
+    }
+
+
+    /* ------------------------- BTree Const Iterator ----------------------- */
+
+    template <typename T, std::size_t Slots>
+    class btree_const_iterator
+    {
+
+    public:
+        typedef bidirectional_iterator_tag          iterator_category;
+        typedef T                                   value_type;
+        typedef ptrdiff_t                           difference_type;
+        typedef const T*                            pointer;
+        typedef const T&                            reference;
+        typedef const btree_leaf<T, Slots>*         leaf_ptr;
+
+    public: // needs to be public for 'map_const_iterator( map_iterator<typename TreeIterator::non_const_iterator> other )'
+        typedef btree_iterator<T, Slots>            non_const_iterator;
+
+    private:
+        leaf_ptr        _leaf;
+        std::size_t     _index;
+
+    public:
+        btree_const_iterator();
+        btree_const_iterator( leaf_ptr leaf, std::size_t index );
+        btree_const_iterator( const btree_const_iterator& other );
+        btree_const_iterator( const non_const_iterator& other );
+        ~btree_const_iterator();
+
+        btree_const_iterator& operator=( const btree_const_iterator& src );
+
+        leaf_ptr base() const;
+        std::size_t index() const;
+        reference operator*() const;
+        pointer operator->() const;
+        btree_const_iterator& operator++();
+        btree_const_iterator  operator++(int);
+        btree_const_iterator& operator--();
+        btree_const_iterator  operator--(int);
+
+    }; // btree_const_iterator
+
+    /* btree_const_iterator member functions */
+
+    template <typename T, std::size_t Slots>
+    btree_const_iterator<T, Slots>::btree_const_iterator() : _leaf( nullptr ), _index( 0 ) {}
+
+    template <typename T, std::size_t Slots>
+    btree_const_iterator<T, Slots>::btree_const_iterator( leaf_ptr leaf, std::size_t index ) : _leaf( leaf ), _index( index ) {}
+
+    template <typename T, std::size_t Slots>
+    btree_const_iterator<T, Slots>::btree_const_iterator( const btree_const_iterator& other ) : _leaf( other._leaf ), _index( other._index ) {}
+
+    template <typename T, std::size_t Slots>
+    btree_const_iterator<T, Slots>::btree_const_iterator( const non_const_iterator& other ) : _leaf( other.base() ), _index( other.index() ) {}
+
+    template <typename T, std::size_t Slots>
+    btree_const_iterator<T, Slots>::~btree_const_iterator() {}
+
+    template <typename T, std::size_t Slots>
+    btree_const_iterator<T, Slots>& btree_const_iterator<T, Slots>::operator=( const btree_const_iterator& src )
+    {
+        this->_leaf = src._leaf;
+        this->_index = src._index;
+        return ( *( this ) );
+    }
+
+    template <typename T, std::size_t Slots>
+    typename btree_const_iterator<T, Slots>::leaf_ptr btree_const_iterator<T, Slots>::base() const
+    {
+        return ( this->_leaf );
+    }
+
+    template <typename T, std::size_t Slots>
+    std::size_t btree_const_iterator<T, Slots>::index() const
+    {
+        return ( this->_index );
+    }
+
+    template <typename T, std::size_t Slots>
+    typename btree_const_iterator<T, Slots>::reference btree_const_iterator<T, Slots>::operator*() const
+    {
+        return ( this->_leaf->values()[this->_index] );
+    }
+
+    template <typename T, std::size_t Slots>
+    typename btree_const_iterator<T, Slots>::pointer btree_const_iterator<T, Slots>::operator->() const
+    {
+        return ( this->_leaf->values() + this->_index );
+    }
+
+    template <typename T, std::size_t Slots>
+    btree_const_iterator<T, Slots>& btree_const_iterator<T, Slots>::operator++()
+    {
+        if ( ++( this->_index ) == this->_leaf->_count && this->_leaf->_next != nullptr )
+        {
+            this->_leaf = this->_leaf->_next;
+            this->_index = 0;
+        }
+        return ( *( this ) );
+    }
+
+    template <typename T, std::size_t Slots>
+    btree_const_iterator<T, Slots>  btree_const_iterator<T, Slots>::operator++( int )
+    {
+        btree_const_iterator    it = *( this );
+
+        ++( *( this ) );
+        return ( it );
+    }
+
+    template <typename T, std::size_t Slots>
+    btree_const_iterator<T, Slots>& btree_const_iterator<T, Slots>::operator--()
+    {
+        if ( this->_index == 0 )
+        {
+            this->_leaf = this->_leaf->_prev;
+            this->_index = this->_leaf->_count;
+        }
+        --( this->_index );
+        return ( *( this ) );
+    }
+
+    template <typename T, std::size_t Slots>
+    btree_const_iterator<T, Slots>  btree_const_iterator<T, Slots>::operator--( int )
+    {
+        btree_const_iterator    it = *( this );
+
+        --( *( this ) );
+        return ( it );
+    }
+
+    /* btree_const_iterator non-member functions */
+
+    template <typename T, std::size_t Slots>
+    inline bool operator==( const btree_const_iterator<T, Slots>& lhs, const btree_const_iterator<T, Slots>& rhs )
+    {
+        return ( lhs.base() == rhs.base() && lhs.index() == rhs.index() );
+    }
+
+    template <typename T, std::size_t Slots>
+    inline bool operator!=( const btree_const_iterator<T, Slots>& lhs, const btree_const_iterator<T, Slots>& rhs )
+    {
+        return ( !( lhs == rhs ) );
+    }
+
+    template <typename T, std::size_t Slots>
+    inline bool operator==( const btree_iterator<T, Slots>& lhs, const btree_const_iterator<T, Slots>& rhs )
+    {
+        return ( lhs.base() == rhs.base() && lhs.index() == rhs.index() );
+    }
+
+    template <typename T, std::size_t Slots>
+    inline bool operator!=( const btree_iterator<T, Slots>& lhs, const btree_const_iterator<T, Slots>& rhs )
+    {
+        return ( !( lhs == rhs ) );
+    }
+
+    template <typename T, std::size_t Slots>
+    inline bool operator==( const btree_const_iterator<T, Slots>& lhs, const btree_iterator<T, Slots>& rhs )
+    {
+        return ( lhs.base() == rhs.base() && lhs.index() == rhs.index() );
+    }
+
+    template <typename T, std::size_t Slots>
+    inline bool operator!=( const btree_const_iterator<T, Slots>& lhs, const btree_iterator<T, Slots>& rhs )
+    {
+        return ( !( lhs == rhs ) );
+    }
+
+
+    /* -------------------------------- BTree ------------------------------- */
+
+    /*
+    ** An ordered container of unique keys with the interface of
+    ** red_black_tree, stored as a B+ tree of nodes of about btree_node_bytes:
+    ** a lookup touches a handful of nodes instead of one per level of a
+    ** binary tree, and elements are packed in arrays, so iterating walks
+    ** memory in order, one leaf after the other.
+    **
+    ** All leaves are on the same level. A node that is not the root stays at
+    ** least half full, except for the right-most leaf: appending to the
+    ** right-most leaf leaves the full one as it is, so sorted input fills
+    ** every leaf completely.
+    **
+    ** Elements are moved between and within leaves, so inserting and erasing
+    ** invalidate all iterators, pointers and references into the tree.
+    */
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue = ft::identity<T> >
+    class btree
+    {
+
+    public:
+        typedef T                                                           value_type;
+        typedef typename KeyOfValue::result_type                            key_type;
+        typedef Compare                                                     key_compare;
+        typedef Allocator                                                   allocator_type;
+        typedef typename allocator_type::size_type                          size_type;
+        typedef typename allocator_type::difference_type                    difference_type;
+        typedef typename allocator_type::reference                          reference;
+        typedef typename allocator_type::const_reference                    const_reference;
+        typedef typename allocator_type::pointer                            pointer;
+        typedef typename allocator_type::const_pointer                      const_pointer;
+        typedef ft::btree_iterator<value_type, btree_leaf_slots<T>::value>          iterator;
+        typedef ft::btree_const_iterator<value_type, btree_leaf_slots<T>::value>    const_iterator;
+        typedef ft::reverse_iterator<iterator>                              reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator>                        const_reverse_iterator;
+
+    private:
+        typedef typename ft::remove_cv<key_type>::type                      separator_type; // the key copies in internal nodes
+        typedef ft::btree_leaf<T, btree_leaf_slots<T>::value>               leaf_type;
+        typedef ft::btree_internal<separator_type, btree_internal_slots<separator_type>::value>   internal_type;
+        typedef typename Allocator::template rebind<leaf_type>::other       leaf_allocator_type;
+        typedef typename Allocator::template rebind<internal_type>::other   internal_allocator_type;
+        typedef typename Allocator::template rebind<separator_type>::other  separator_allocator_type;
+        typedef typename ft::is_trivially_relocatable<value_type>::type     _relocatable_values;
+        typedef typename ft::is_trivially_relocatable<separator_type>::type _relocatable_keys;
+
+        static const size_type  _leaf_slots = btree_leaf_slots<T>::value;
+        static const size_type  _max_keys = btree_internal_slots<separator_type>::value - 1;
+        static const size_type  _min_values = _leaf_slots / 2; // of a leaf, that is not the root
+        static const size_type  _min_keys = _max_keys / 2; // of an internal node, that is not the root
+
+        btree_node_base*            _root; // nullptr, if empty
+        leaf_type*                  _first_leaf;
+        leaf_type*                  _last_leaf;
+        key_compare                 _compare;
+        allocator_type              _allocator;
+        leaf_allocator_type         _leaf_allocator;
+        internal_allocator_type     _internal_allocator;
+        separator_allocator_type    _separator_allocator;
+        size_type                   _size;
+
+    public:
+        // Constructors / Destructor / Assignment
+        explicit btree( const key_compare& comp = Compare(), const allocator_type& alloc = Allocator() );
+        btree( const btree& other );
+        ~btree();
+
+        btree& operator=( const btree& other );
+
+        // Iterators:
+        iterator begin();
+        const_iterator begin() const;
+        iterator end();
+        const_iterator end() const;
+        reverse_iterator rbegin();
+        const_reverse_iterator rbegin() const;
+        reverse_iterator rend();
+        const_reverse_iterator rend() const;
+
+        // Capacity
+        size_type size() const;
+        size_type max_size() const;
+
+        // Modifiers:
+        ft::pair<iterator,bool> insert( const value_type& value); // single element
+        iterator insert( const_iterator position, const value_type& value); // with hint
+        template <typename InputIterator>
+            void insert( InputIterator first, InputIterator last ); // range
+        template <typename ValueFactory>
+            ft::pair<iterator,bool> insert_key( const key_type& key, const ValueFactory& make_value ); // make_value() is only called, if key is missing
+        void erase( const_iterator position ); // iterator
+        size_type erase( const key_type& key ); // key
+        void erase( const_iterator first, const_iterator last ); // range
+        void swap( btree& x );
+        void clear();
+
+        // Operations:
+        iterator find( const key_type& key );
+        const_iterator find( const key_type& key ) const;
+        size_type count( const key_type& key ) const;
+        iterator lower_bound( const key_type& key );
+        const_iterator lower_bound( const key_type& key ) const;
+        iterator upper_bound( const key_type& key );
+        const_iterator upper_bound( const key_type& key ) const;
+        ft::pair<iterator,iterator> equal_range( const key_type& key );
+        ft::pair<const_iterator,const_iterator> equal_range( const key_type& key ) const;
+
+        // Allocator / Compare:
+        allocator_type get_allocator() const;
+        key_compare key_comp() const;
+
+    private:
+        static const key_type& _key( const value_type& value ); // KeyOfValue()( value )
+        static leaf_type* _leaf( btree_node_base* node );
+        static internal_type* _internal( btree_node_base* node );
+        iterator _make_iter( leaf_type* leaf, size_type index ) const; // the first slot of the next leaf instead of the one behind a leaf
+        const leaf_type* _find_leaf( const key_type& key ) const; // the leaf, which key belongs into
+        size_type _leaf_lower_bound( const leaf_type* leaf, const key_type& key ) const;
+        size_type _leaf_upper_bound( const leaf_type* leaf, const key_type& key ) const;
+        bool _find_insert_position( const key_type& key, leaf_type*& leaf, size_type& index ) const; // true, if key is at leaf[index]
+        iterator _insert_at( leaf_type* leaf, size_type index, const value_type& value );
+        void _insert_child( btree_node_base* left, const separator_type& key, btree_node_base* right ); // links right behind left, splits full parents
+        void _insert_into( internal_type* node, size_type position, const separator_type& key, btree_node_base* child );
+        iterator _erase_at( leaf_type* leaf, size_type index ); // returns the element behind the erased one
+        void _rebalance_leaf( leaf_type*& leaf, size_type& index ); // keeps leaf[index] pointing to the same element
+        void _rebalance_internal( internal_type* node );
+        void _close_gap( internal_type* node, size_type position ); // drops the (raw) key at position and the child behind it
+        void _adopt( internal_type* node, size_type first, size_type last ); // sets parent and position of the children [first, last)
+        void _append_all( const btree& other );
+        leaf_type* _create_leaf();
+        internal_type* _create_internal();
+        void _destroy_node( btree_node_base* node );
+        template <typename U, typename UAllocator>
+            static void _relocate( UAllocator& alloc, U* first, U* last, U* dest, ft::true_type ); // bitwise: one memmove
+        template <typename U, typename UAllocator>
+            static void _relocate( UAllocator& alloc, U* first, U* last, U* dest, ft::false_type ); // copy construct + destroy
+
+    }; // btree
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    const typename btree<T, Compare, Allocator, KeyOfValue>::size_type btree<T, Compare, Allocator, KeyOfValue>::_leaf_slots;
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    const typename btree<T, Compare, Allocator, KeyOfValue>::size_type btree<T, Compare, Allocator, KeyOfValue>::_max_keys;
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    const typename btree<T, Compare, Allocator, KeyOfValue>::size_type btree<T, Compare, Allocator, KeyOfValue>::_min_values;
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    const typename btree<T, Compare, Allocator, KeyOfValue>::size_type btree<T, Compare, Allocator, KeyOfValue>::_min_keys;
+
+    /* btree member functions */
+    /* public */
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    btree<T, Compare, Allocator, KeyOfValue>::btree( const key_compare& comp, const allocator_type& alloc )
+    : _root( nullptr ), _first_leaf( nullptr ), _last_leaf( nullptr ), _compare( comp ), _allocator( alloc ),
+      _leaf_allocator( alloc ), _internal_allocator( alloc ), _separator_allocator( alloc ), _size( 0 ) {}
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    btree<T, Compare, Allocator, KeyOfValue>::btree( const btree& src )
+    : _root( nullptr ), _first_leaf( nullptr ), _last_leaf( nullptr ), _compare( src._compare ), _allocator( src._allocator ),
+      _leaf_allocator( src._leaf_allocator ), _internal_allocator( src._internal_allocator ), _separator_allocator( src._separator_allocator ), _size( 0 )
+    {
+        this->_append_all( src );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    btree<T, Compare, Allocator, KeyOfValue>::~btree()
+    {
+        this->clear();
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    btree<T, Compare, Allocator, KeyOfValue>& btree<T, Compare, Allocator, KeyOfValue>::operator=( const btree& other )
+    {
+        if ( this != &other )
+        {
+            this->clear();
+            this->_compare = other._compare;
+            this->_append_all( other );
+        }
+        return ( *( this ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename btree<T, Compare, Allocator, KeyOfValue>::iterator btree<T, Compare, Allocator, KeyOfValue>::begin()
+    {
+        return ( iterator( this->_first_leaf, 0 ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename btree<T, Compare, Allocator, KeyOfValue>::const_iterator btree<T, Compare, Allocator, KeyOfValue>::begin() const
+    {
+        return ( const_iterator( this->_first_leaf, 0 ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename btree<T, Compare, Allocator, KeyOfValue>::iterator btree<T, Compare, Allocator, KeyOfValue>::end()
+    {
+        if ( this->_last_leaf == nullptr )
+            return ( iterator() );
+        return ( iterator( this->_last_leaf, this->_last_leaf->_count ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename btree<T, Compare, Allocator, KeyOfValue>::const_iterator btree<T, Compare, Allocator, KeyOfValue>::end() const
+    {
+        if ( this->_last_leaf == nullptr )
+            return ( const_iterator() );
+        return ( const_iterator( this->_last_leaf, this->_last_leaf->_count ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename btree<T, Compare, Allocator, KeyOfValue>::reverse_iterator btree<T, Compare, Allocator, KeyOfValue>::rbegin()
+    {
+        return ( reverse_iterator( this->end() ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename btree<T, Compare, Allocator, KeyOfValue>::const_reverse_iterator btree<T, Compare, Allocator, KeyOfValue>::rbegin() const
+    {
+        return ( const_reverse_iterator( this->end() ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename btree<T, Compare, Allocator, KeyOfValue>::reverse_iterator btree<T, Compare, Allocator, KeyOfValue>::rend()
+    {
+        return ( reverse_iterator( this->begin() ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename btree<T, Compare, Allocator, KeyOfValue>::const_reverse_iterator btree<T, Compare, Allocator, KeyOfValue>::rend() const
+    {
+        return ( const_reverse_iterator( this->begin() ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename btree<T, Compare, Allocator, KeyOfValue>::size_type btree<T, Compare, Allocator, KeyOfValue>::size() const
+    {
+        return ( this->_size );
+    }
+
+    // sizeof( leaf_type ) exceeds _leaf_slots elements, so this cannot overflow.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename btree<T, Compare, Allocator, KeyOfValue>::size_type btree<T, Compare, Allocator, KeyOfValue>::max_size() const
+    {
+        return ( this->_leaf_allocator.max_size() * _leaf_slots );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    ft::pair<typename btree<T, Compare, Allocator, KeyOfValue>::iterator, bool> btree<T, Compare, Allocator, KeyOfValue>::insert( const value_type& value )
+    {
+        leaf_type*  leaf;
+        size_type   index;
+
+        if ( this->_find_insert_position( _key( value ), leaf, index ) )
+            return ( ft::make_pair( iterator( leaf, index ), false ) );
+        return ( ft::make_pair( this->_insert_at( leaf, index, value ), true ) );
+    }
+
+    // Without a search, if value belongs directly before position within
+    // the same leaf, or behind the last element; otherwise a full insert.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename btree<T, Compare, Allocator, KeyOfValue>::iterator btree<T, Compare, Allocator, KeyOfValue>::insert( const_iterator position, const value_type& value )
+    {
+        leaf_type*  leaf = const_cast<leaf_type*>( position.base() );
+        size_type   index = position.index();
+
+        if ( leaf != nullptr && index > 0
+                && this->_compare( _key( leaf->values()[index - 1] ), _key( value ) )
+                && ( ( index == leaf->_count ) ? leaf->_next == nullptr : this->_compare( _key( value ), _key( leaf->values()[index] ) ) ) )
+            return ( this->_insert_at( leaf, index, value ) );
+        return ( this->insert( value ).first );
+    }
+
+    // Sorted input takes the append path of insert(): one comparison per element.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    template <typename InputIterator>
+    void btree<T, Compare, Allocator, KeyOfValue>::insert( InputIterator first, InputIterator last )
+    {
+        for ( ; first != last; ++first )
+            this->insert( *( first ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    template <typename ValueFactory>
+    ft::pair<typename btree<T, Compare, Allocator, KeyOfValue>::iterator, bool> btree<T, Compare, Allocator, KeyOfValue>::insert_key( const key_type& key, const ValueFactory& make_value )
+    {
+        leaf_type*  leaf;
+        size_type   index;
+
+        if ( this->_find_insert_position( key, leaf, index ) )
+            return ( ft::make_pair( iterator( leaf, index ), false ) );
+        return ( ft::make_pair( this->_insert_at( leaf, index, make_value() ), true ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void btree<T, Compare, Allocator, KeyOfValue>::erase( const_iterator position )
+    {
+        if ( position.base() == nullptr || position.index() == position.base()->_count ) // end()
+            return ;
+        this->_erase_at( const_cast<leaf_type*>( position.base() ), position.index() );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename btree<T, Compare, Allocator, KeyOfValue>::size_type btree<T, Compare, Allocator, KeyOfValue>::erase( const key_type& key )
+    {
+        const_iterator  position = this->find( key );
+
+        if ( position == this->end() )
+            return ( 0 );
+        this->_erase_at( const_cast<leaf_type*>( position.base() ), position.index() );
+        return ( 1 );
+    }
+
+    // Erasing moves the following elements, so the range is counted first
+    // and then erased from the position, that each erase returns.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void btree<T, Compare, Allocator, KeyOfValue>::erase( const_iterator first, const_iterator last )
+    {
+        if ( first == this->begin() && last == this->end() )
+        {
+            this->clear();
+            return ;
+        }
+
+        size_type   n = static_cast<size_type>( ft::distance( first, last ) );
+        iterator    position( const_cast<leaf_type*>( first.base() ), first.index() );
+
+        for ( ; n > 0; --n )
+            position = this->_erase_at( position.base(), position.index() );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void btree<T, Compare, Allocator, KeyOfValue>::swap( btree& x )
+    {
+        if ( this != &x )
+        {
+            ft::swap( this->_root, x._root );
+            ft::swap( this->_first_leaf, x._first_leaf );
+            ft::swap( this->_last_leaf, x._last_leaf );
+            ft::swap( this->_compare, x._compare );
+            ft::swap( this->_allocator, x._allocator );
+            ft::swap( this->_leaf_allocator, x._leaf_allocator );
+            ft::swap( this->_internal_allocator, x._internal_allocator );
+            ft::swap( this->_separator_allocator, x._separator_allocator );
+            ft::swap( this->_size, x._size );
+        }
+    }
+
+    // Post-order without a stack: a node's parent and position say, which
+    // sibling comes next; the parent follows its last child.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void btree<T, Compare, Allocator, KeyOfValue>::clear()
+    {
+        btree_node_base*    node = this->_root;
+
+        if ( node == nullptr )
+            return ;
+        while ( !( node->_leaf ) )
+            node = _internal( node )->_children[0];
+        while ( node != nullptr )
+        {
+            btree_node_base*    parent = node->_parent;
+            size_type           position = node->_position;
+
+            this->_destroy_node( node );
+            if ( parent == nullptr )
+                node = nullptr;
+            else if ( position < parent->_count )
+            {
+                node = _internal( parent )->_children[position + 1];
+                while ( !( node->_leaf ) )
+                    node = _internal( node )->_children[0];
+            }
+            else
+                node = parent;
+        }
+        this->_root = nullptr;
+        this->_first_leaf = nullptr;
+        this->_last_leaf = nullptr;
+        this->_size = 0;
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename btree<T, Compare, Allocator, KeyOfValue>::iterator btree<T, Compare, Allocator, KeyOfValue>::find( const key_type& key )
+    {
+        iterator    position = this->lower_bound( key );
+
+        if ( position == this->end() || this->_compare( key, _key( *( position ) ) ) )
+            return ( this->end() );
+        return ( position );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename btree<T, Compare, Allocator, KeyOfValue>::const_iterator btree<T, Compare, Allocator, KeyOfValue>::find( const key_type& key ) const
+    {
+        const_iterator  position = this->lower_bound( key );
+
+        if ( position == this->end() || this->_compare( key, _key( *( position ) ) ) )
+            return ( this->end() );
+        return ( position );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename btree<T, Compare, Allocator, KeyOfValue>::size_type btree<T, Compare, Allocator, KeyOfValue>::count( const key_type& key ) const
+    {
+        return ( ( this->find( key ) == this->end() ) ? 0 : 1 );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename btree<T, Compare, Allocator, KeyOfValue>::iterator btree<T, Compare, Allocator, KeyOfValue>::lower_bound( const key_type& key )
+    {
+        leaf_type*  leaf = const_cast<leaf_type*>( this->_find_leaf( key ) );
+
+        if ( leaf == nullptr )
+            return ( this->end() );
+        return ( this->_make_iter( leaf, this->_leaf_lower_bound( leaf, key ) ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename btree<T, Compare, Allocator, KeyOfValue>::const_iterator btree<T, Compare, Allocator, KeyOfValue>::lower_bound( const key_type& key ) const
+    {
+        leaf_type*  leaf = const_cast<leaf_type*>( this->_find_leaf( key ) );
+
+        if ( leaf == nullptr )
+            return ( this->end() );
+        return ( this->_make_iter( leaf, this->_leaf_lower_bound( leaf, key ) ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename btree<T, Compare, Allocator, KeyOfValue>::iterator btree<T, Compare, Allocator, KeyOfValue>::upper_bound( const key_type& key )
+    {
+        leaf_type*  leaf = const_cast<leaf_type*>( this->_find_leaf( key ) );
+
+        if ( leaf == nullptr )
+            return ( this->end() );
+        return ( this->_make_iter( leaf, this->_leaf_upper_bound( leaf, key ) ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename btree<T, Compare, Allocator, KeyOfValue>::const_iterator btree<T, Compare, Allocator, KeyOfValue>::upper_bound( const key_type& key ) const
+    {
+        leaf_type*  leaf = const_cast<leaf_type*>( this->_find_leaf( key ) );
+
+        if ( leaf == nullptr )
+            return ( this->end() );
+        return ( this->_make_iter( leaf, this->_leaf_upper_bound( leaf, key ) ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    ft::pair<typename btree<T, Compare, Allocator, KeyOfValue>::iterator,
+            typename btree<T, Compare, Allocator, KeyOfValue>::iterator> btree<T, Compare, Allocator, KeyOfValue>::equal_range( const key_type& key )
+    {
+        iterator    first = this->lower_bound( key );
+        iterator    last = first;
+
+        if ( first != this->end() && !( this->_compare( key, _key( *( first ) ) ) ) )
+            ++last;
+        return ( ft::make_pair( first, last ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    ft::pair<typename btree<T, Compare, Allocator, KeyOfValue>::const_iterator,
+            typename btree<T, Compare, Allocator, KeyOfValue>::const_iterator> btree<T, Compare, Allocator, KeyOfValue>::equal_range( const key_type& key ) const
+    {
+        const_iterator  first = this->lower_bound( key );
+        const_iterator  last = first;
+
+        if ( first != this->end() && !( this->_compare( key, _key( *( first ) ) ) ) )
+            ++last;
+        return ( ft::make_pair( first, last ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename btree<T, Compare, Allocator, KeyOfValue>::allocator_type btree<T, Compare, Allocator, KeyOfValue>::get_allocator() const
+    {
+        return ( this->_allocator );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename btree<T, Compare, Allocator, KeyOfValue>::key_compare btree<T, Compare, Allocator, KeyOfValue>::key_comp() const
+    {
+        return ( this->_compare );
+    }
+
+    /* private */
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    inline const typename btree<T, Compare, Allocator, KeyOfValue>::key_type& btree<T, Compare, Allocator, KeyOfValue>::_key( const value_type& value )
+    {
+        return ( KeyOfValue()( value ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    inline typename btree<T, Compare, Allocator, KeyOfValue>::leaf_type* btree<T, Compare, Allocator, KeyOfValue>::_leaf( btree_node_base* node )
+    {
+        return ( static_cast<leaf_type*>( node ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    inline typename btree<T, Compare, Allocator, KeyOfValue>::internal_type* btree<T, Compare, Allocator, KeyOfValue>::_internal( btree_node_base* node )
+    {
+        return ( static_cast<internal_type*>( node ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    inline typename btree<T, Compare, Allocator, KeyOfValue>::iterator btree<T, Compare, Allocator, KeyOfValue>::_make_iter( leaf_type* leaf, size_type index ) const
+    {
+        if ( index == leaf->_count && leaf->_next != nullptr )
+            return ( iterator( leaf->_next, 0 ) );
+        return ( iterator( leaf, index ) );
+    }
+
+    // Elements of a child are less than the key behind it, so the search
+    // goes into the child before the first key greater than key. An element
+    // not less than key may then still be the first of the next leaf.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    const typename btree<T, Compare, Allocator, KeyOfValue>::leaf_type* btree<T, Compare, Allocator, KeyOfValue>::_find_leaf( const key_type& key ) const
+    {
+        btree_node_base*    node = this->_root;
+
+        if ( node == nullptr )
+            return ( nullptr );
+        while ( !( node->_leaf ) )
+        {
+            const internal_type*    internal = _internal( node );
+            size_type               low = 0;
+            size_type               high = internal->_count;
+
+            while ( low < high )
+            {
+                size_type   middle = ( low + high ) / 2;
+
+                if ( this->_compare( key, internal->keys()[middle] ) )
+                    high = middle;
+                else
+                    low = middle + 1;
+            }
+            node = internal->_children[low];
+        }
+        return ( _leaf( node ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename btree<T, Compare, Allocator, KeyOfValue>::size_type btree<T, Compare, Allocator, KeyOfValue>::_leaf_lower_bound( const leaf_type* leaf, const key_type& key ) const
+    {
+        size_type   low = 0;
+        size_type   high = leaf->_count;
+
+        while ( low < high )
+        {
+            size_type   middle = ( low + high ) / 2;
+
+            if ( this->_compare( _key( leaf->values()[middle] ), key ) )
+                low = middle + 1;
+            else
+                high = middle;
+        }
+        return ( low );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename btree<T, Compare, Allocator, KeyOfValue>::size_type btree<T, Compare, Allocator, KeyOfValue>::_leaf_upper_bound( const leaf_type* leaf, const key_type& key ) const
+    {
+        size_type   low = 0;
+        size_type   high = leaf->_count;
+
+        while ( low < high )
+        {
+            size_type   middle = ( low + high ) / 2;
+
+            if ( this->_compare( key, _key( leaf->values()[middle] ) ) )
+                high = middle;
+            else
+                low = middle + 1;
+        }
+        return ( low );
+    }
+
+    // A key greater than the last element is appended to the right-most leaf
+    // after one comparison. Elements equal to key are never in the next leaf:
+    // the search only descends left of keys greater than key.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    bool btree<T, Compare, Allocator, KeyOfValue>::_find_insert_position( const key_type& key, leaf_type*& leaf, size_type& index ) const
+    {
+        if ( this->_root == nullptr )
+        {
+            leaf = nullptr;
+            index = 0;
+            return ( false );
+        }
+        if ( this->_compare( _key( this->_last_leaf->values()[this->_last_leaf->_count - 1] ), key ) )
+        {
+            leaf = this->_last_leaf;
+            index = leaf->_count;
+            return ( false );
+        }
+        leaf = const_cast<leaf_type*>( this->_find_leaf( key ) );
+        index = this->_leaf_lower_bound( leaf, key );
+        return ( index < leaf->_count && !( this->_compare( key, _key( leaf->values()[index] ) ) ) );
+    }
+
+    // A full leaf is split in halves first; when appending to the right-most
+    // leaf, the new leaf only receives value. The new leaf's first key then
+    // becomes the separator in the parent, once value is in place.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename btree<T, Compare, Allocator, KeyOfValue>::iterator btree<T, Compare, Allocator, KeyOfValue>::_insert_at( leaf_type* leaf, size_type index, const value_type& value )
+    {
+        leaf_type*  right = nullptr;
+
+        if ( leaf == nullptr ) // empty tree
+        {
+            leaf = this->_create_leaf();
+            this->_root = leaf;
+            this->_first_leaf = leaf;
+            this->_last_leaf = leaf;
+        }
+        else if ( leaf->_count == _leaf_slots )
+        {
+            size_type   middle = ( index == _leaf_slots && leaf->_next == nullptr ) ? _leaf_slots : _leaf_slots / 2;
+
+            right = this->_create_leaf();
+            _relocate( this->_allocator, leaf->values() + middle, leaf->values() + leaf->_count, right->values(), _relocatable_values() );
+            right->_count = static_cast<unsigned short>( leaf->_count - middle );
+            leaf->_count = static_cast<unsigned short>( middle );
+            right->_prev = leaf;
+            right->_next = leaf->_next;
+            if ( leaf->_next != nullptr )
+                leaf->_next->_prev = right;
+            else
+                this->_last_leaf = right;
+            leaf->_next = right;
+            if ( index > middle || middle == _leaf_slots )
+            {
+                index -= middle;
+                leaf = right;
+            }
+        }
+        _relocate( this->_allocator, leaf->values() + index, leaf->values() + leaf->_count, leaf->values() + index + 1, _relocatable_values() );
+        this->_allocator.construct( leaf->values() + index, value );
+        ++( leaf->_count );
+        ++( this->_size );
+        if ( right != nullptr )
+            this->_insert_child( right->_prev, _key( right->values()[0] ), right );
+        return ( iterator( leaf, index ) );
+    }
+
+    // A full parent moves its upper half of keys and children into a new
+    // sibling; the key between the halves moves up a level (recursion is
+    // bounded by the height of the tree). Either half keeps at least
+    // _min_keys keys.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void btree<T, Compare, Allocator, KeyOfValue>::_insert_child( btree_node_base* left, const separator_type& key, btree_node_base* right )
+    {
+        internal_type*  node = _internal( left->_parent );
+
+        if ( node == nullptr ) // left is the root
+        {
+            node = this->_create_internal();
+            this->_separator_allocator.construct( node->keys(), key );
+            node->_children[0] = left;
+            node->_children[1] = right;
+            node->_count = 1;
+            this->_adopt( node, 0, 2 );
+            this->_root = node;
+            return ;
+        }
+
+        size_type   position = left->_position;
+
+        if ( node->_count < _max_keys )
+        {
+            this->_insert_into( node, position, key, right );
+            return ;
+        }
+
+        size_type       middle = ( _max_keys + 1 ) / 2;
+        internal_type*  sibling = this->_create_internal();
+        separator_type* keys = node->keys();
+
+        if ( position == middle ) // key itself moves up
+        {
+            _relocate( this->_separator_allocator, keys + middle, keys + _max_keys, sibling->keys(), _relocatable_keys() );
+            sibling->_children[0] = right;
+            std::memcpy( static_cast<void*>( sibling->_children + 1 ), static_cast<const void*>( node->_children + middle + 1 ), ( _max_keys - middle ) * sizeof( btree_node_base* ) );
+            sibling->_count = static_cast<unsigned short>( _max_keys - middle );
+            node->_count = static_cast<unsigned short>( middle );
+            this->_adopt( sibling, 0, sibling->_count + 1 );
+            this->_insert_child( node, key, sibling );
+            return ;
+        }
+
+        size_type       up = ( position < middle ) ? middle - 1 : middle;
+        separator_type  separator( keys[up] );
+
+        this->_separator_allocator.destroy( keys + up );
+        _relocate( this->_separator_allocator, keys + up + 1, keys + _max_keys, sibling->keys(), _relocatable_keys() );
+        std::memcpy( static_cast<void*>( sibling->_children ), static_cast<const void*>( node->_children + up + 1 ), ( _max_keys - up ) * sizeof( btree_node_base* ) );
+        sibling->_count = static_cast<unsigned short>( _max_keys - up - 1 );
+        node->_count = static_cast<unsigned short>( up );
+        this->_adopt( sibling, 0, sibling->_count + 1 );
+        if ( position < middle )
+            this->_insert_into( node, position, key, right );
+        else
+            this->_insert_into( sibling, position - up - 1, key, right );
+        this->_insert_child( node, separator, sibling );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void btree<T, Compare, Allocator, KeyOfValue>::_insert_into( internal_type* node, size_type position, const separator_type& key, btree_node_base* child )
+    {
+        _relocate( this->_separator_allocator, node->keys() + position, node->keys() + node->_count, node->keys() + position + 1, _relocatable_keys() );
+        this->_separator_allocator.construct( node->keys() + position, key );
+        std::memmove( static_cast<void*>( node->_children + position + 2 ), static_cast<const void*>( node->_children + position + 1 ),
+                ( node->_count - position ) * sizeof( btree_node_base* ) );
+        node->_children[position + 1] = child;
+        ++( node->_count );
+        this->_adopt( node, position + 1, node->_count + 1 );
+    }
+
+    // Separators stay valid when their element is erased: they still lie
+    // between the elements left and right of them.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename btree<T, Compare, Allocator, KeyOfValue>::iterator btree<T, Compare, Allocator, KeyOfValue>::_erase_at( leaf_type* leaf, size_type index )
+    {
+        this->_allocator.destroy( leaf->values() + index );
+        _relocate( this->_allocator, leaf->values() + index + 1, leaf->values() + leaf->_count, leaf->values() + index, _relocatable_values() );
+        --( leaf->_count );
+        --( this->_size );
+        if ( leaf == this->_root )
+        {
+            if ( leaf->_count == 0 )
+            {
+                this->_destroy_node( leaf );
+                this->_root = nullptr;
+                this->_first_leaf = nullptr;
+                this->_last_leaf = nullptr;
+                return ( iterator() );
+            }
+        }
+        else if ( leaf->_count < _min_values )
+            this->_rebalance_leaf( leaf, index );
+        return ( this->_make_iter( leaf, index ) );
+    }
+
+    // Takes one element from a sibling, that can spare it, otherwise merges
+    // with a sibling and removes the separator between them from the parent.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void btree<T, Compare, Allocator, KeyOfValue>::_rebalance_leaf( leaf_type*& leaf, size_type& index )
+    {
+        internal_type*  parent = _internal( leaf->_parent );
+        size_type       position = leaf->_position;
+        leaf_type*      left = ( position > 0 ) ? _leaf( parent->_children[position - 1] ) : nullptr;
+        leaf_type*      right = ( position < parent->_count ) ? _leaf( parent->_children[position + 1] ) : nullptr;
+
+        if ( left != nullptr && left->_count > _min_values )
+        {
+            _relocate( this->_allocator, leaf->values(), leaf->values() + leaf->_count, leaf->values() + 1, _relocatable_values() );
+            _relocate( this->_allocator, left->values() + left->_count - 1, left->values() + left->_count, leaf->values(), _relocatable_values() );
+            --( left->_count );
+            ++( leaf->_count );
+            ++index;
+            this->_separator_allocator.destroy( parent->keys() + position - 1 );
+            this->_separator_allocator.construct( parent->keys() + position - 1, _key( leaf->values()[0] ) );
+            return ;
+        }
+        if ( right != nullptr && right->_count > _min_values )
+        {
+            _relocate( this->_allocator, right->values(), right->values() + 1, leaf->values() + leaf->_count, _relocatable_values() );
+            _relocate( this->_allocator, right->values() + 1, right->values() + right->_count, right->values(), _relocatable_values() );
+            ++( leaf->_count );
+            --( right->_count );
+            this->_separator_allocator.destroy( parent->keys() + position );
+            this->_separator_allocator.construct( parent->keys() + position, _key( right->values()[0] ) );
+            return ;
+        }
+        if ( left != nullptr )
+        {
+            index += left->_count;
+            right = leaf;
+            leaf = left;
+            --position;
+        }
+        _relocate( this->_allocator, right->values(), right->values() + right->_count, leaf->values() + leaf->_count, _relocatable_values() );
+        leaf->_count = static_cast<unsigned short>( leaf->_count + right->_count );
+        right->_count = 0; // its elements belong to leaf now
+        leaf->_next = right->_next;
+        if ( right->_next != nullptr )
+            right->_next->_prev = leaf;
+        else
+            this->_last_leaf = leaf;
+        this->_destroy_node( right );
+        this->_separator_allocator.destroy( parent->keys() + position );
+        this->_close_gap( parent, position );
+        this->_rebalance_internal( parent );
+    }
+
+    // Like _rebalance_leaf(), but a borrowed child rotates through the
+    // parent: the separator comes down, the sibling's outer key goes up.
+    // An internal root left without keys hands the root to its only child.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void btree<T, Compare, Allocator, KeyOfValue>::_rebalance_internal( internal_type* node )
+    {
+        while ( node != this->_root && node->_count < _min_keys )
+        {
+            internal_type*  parent = _internal( node->_parent );
+            size_type       position = node->_position;
+            internal_type*  left = ( position > 0 ) ? _internal( parent->_children[position - 1] ) : nullptr;
+            internal_type*  right = ( position < parent->_count ) ? _internal( parent->_children[position + 1] ) : nullptr;
+
+            if ( left != nullptr && left->_count > _min_keys )
+            {
+                _relocate( this->_separator_allocator, node->keys(), node->keys() + node->_count, node->keys() + 1, _relocatable_keys() );
+                _relocate( this->_separator_allocator, parent->keys() + position - 1, parent->keys() + position, node->keys(), _relocatable_keys() );
+                _relocate( this->_separator_allocator, left->keys() + left->_count - 1, left->keys() + left->_count, parent->keys() + position - 1, _relocatable_keys() );
+                std::memmove( static_cast<void*>( node->_children + 1 ), static_cast<const void*>( node->_children ), ( node->_count + 1 ) * sizeof( btree_node_base* ) );
+                node->_children[0] = left->_children[left->_count];
+                --( left->_count );
+                ++( node->_count );
+                this->_adopt( node, 0, node->_count + 1 );
+                return ;
+            }
+            if ( right != nullptr && right->_count > _min_keys )
+            {
+                _relocate( this->_separator_allocator, parent->keys() + position, parent->keys() + position + 1, node->keys() + node->_count, _relocatable_keys() );
+                _relocate( this->_separator_allocator, right->keys(), right->keys() + 1, parent->keys() + position, _relocatable_keys() );
+                _relocate( this->_separator_allocator, right->keys() + 1, right->keys() + right->_count, right->keys(), _relocatable_keys() );
+                node->_children[node->_count + 1] = right->_children[0];
+                std::memmove( static_cast<void*>( right->_children ), static_cast<const void*>( right->_children + 1 ), right->_count * sizeof( btree_node_base* ) );
+                ++( node->_count );
+                --( right->_count );
+                this->_adopt( node, node->_count, node->_count + 1 );
+                this->_adopt( right, 0, right->_count + 1 );
+                return ;
+            }
+            if ( left != nullptr )
+            {
+                right = node;
+                node = left;
+                --position;
+            }
+            _relocate( this->_separator_allocator, parent->keys() + position, parent->keys() + position + 1, node->keys() + node->_count, _relocatable_keys() );
+            _relocate( this->_separator_allocator, right->keys(), right->keys() + right->_count, node->keys() + node->_count + 1, _relocatable_keys() );
+            std::memcpy( static_cast<void*>( node->_children + node->_count + 1 ), static_cast<const void*>( right->_children ), ( right->_count + 1 ) * sizeof( btree_node_base* ) );
+            this->_adopt( node, node->_count + 1, node->_count + right->_count + 2 );
+            node->_count = static_cast<unsigned short>( node->_count + right->_count + 1 );
+            right->_count = 0; // its keys and children belong to node now
+            this->_destroy_node( right );
+            this->_close_gap( parent, position );
+            node = parent;
+        }
+        if ( node == this->_root && node->_count == 0 )
+        {
+            this->_root = node->_children[0];
+            this->_root->_parent = nullptr;
+            this->_root->_position = 0;
+            this->_destroy_node( node );
+        }
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void btree<T, Compare, Allocator, KeyOfValue>::_close_gap( internal_type* node, size_type position )
+    {
+        _relocate( this->_separator_allocator, node->keys() + position + 1, node->keys() + node->_count, node->keys() + position, _relocatable_keys() );
+        std::memmove( static_cast<void*>( node->_children + position + 1 ), static_cast<const void*>( node->_children + position + 2 ),
+                ( node->_count - position - 1 ) * sizeof( btree_node_base* ) );
+        --( node->_count );
+        this->_adopt( node, position + 1, node->_count + 1 );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void btree<T, Compare, Allocator, KeyOfValue>::_adopt( internal_type* node, size_type first, size_type last )
+    {
+        for ( ; first < last; ++first )
+        {
+            node->_children[first]->_parent = node;
+            node->_children[first]->_position = static_cast<unsigned short>( first );
+        }
+    }
+
+    // Appends in order, so every leaf but the last ends up full.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void btree<T, Compare, Allocator, KeyOfValue>::_append_all( const btree& other )
+    {
+        for ( const_iterator it = other.begin(); it != other.end(); ++it )
+        {
+            if ( this->_last_leaf == nullptr )
+                this->_insert_at( nullptr, 0, *( it ) );
+            else
+                this->_insert_at( this->_last_leaf, this->_last_leaf->_count, *( it ) );
+        }
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename btree<T, Compare, Allocator, KeyOfValue>::leaf_type* btree<T, Compare, Allocator, KeyOfValue>::_create_leaf()
+    {
+        leaf_type*  leaf = this->_leaf_allocator.allocate( 1 );
+
+        leaf->_parent = nullptr;
+        leaf->_position = 0;
+        leaf->_count = 0;
+        leaf->_leaf = true;
+        leaf->_prev = nullptr;
+        leaf->_next = nullptr;
+        return ( leaf );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename btree<T, Compare, Allocator, KeyOfValue>::internal_type* btree<T, Compare, Allocator, KeyOfValue>::_create_internal()
+    {
+        internal_type*  node = this->_internal_allocator.allocate( 1 );
+
+        node->_parent = nullptr;
+        node->_position = 0;
+        node->_count = 0;
+        node->_leaf = false;
+        return ( node );
+    }
+
+    // Destroys the elements or keys a node holds, not its children.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void btree<T, Compare, Allocator, KeyOfValue>::_destroy_node( btree_node_base* node )
+    {
+        if ( node->_leaf )
+        {
+            leaf_type*  leaf = _leaf( node );
+
+            for ( size_type i = 0; i < leaf->_count; ++i )
+                this->_allocator.destroy( leaf->values() + i );
+            this->_leaf_allocator.deallocate( leaf, 1 );
+        }
+        else
+        {
+            internal_type*  internal = _internal( node );
+
+            for ( size_type i = 0; i < internal->_count; ++i )
+                this->_separator_allocator.destroy( internal->keys() + i );
+            this->_internal_allocator.deallocate( internal, 1 );
+        }
+    }
+
+    // [first, last) and dest may overlap. Afterwards dest holds the elements
+    // and whatever part of [first, last) it does not cover is raw memory.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    template <typename U, typename UAllocator>
+    void btree<T, Compare, Allocator, KeyOfValue>::_relocate( __attribute__( ( unused ) ) UAllocator& alloc, U* first, U* last, U* dest, ft::true_type )
+    {
+        if ( first != last )
+            std::memmove( static_cast<void*>( dest ), static_cast<const void*>( first ), static_cast<size_type>( last - first ) * sizeof( U ) );
+    }
+
+    // Element by element, in the direction that never overwrites a
+    // constructed element before it was moved.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    template <typename U, typename UAllocator>
+    void btree<T, Compare, Allocator, KeyOfValue>::_relocate( UAllocator& alloc, U* first, U* last, U* dest, ft::false_type )
+    {
+        if ( dest < first )
+        {
+            for ( ; first != last; ++first, ++dest )
+            {
+                alloc.construct( dest, *( first ) );
+                alloc.destroy( first );
+            }
+        }
+        else if ( dest > first )
+        {
+            dest += last - first;
+            while ( last != first )
+            {
+                --last;
+                --dest;
+                alloc.construct( dest, *( last ) );
+                alloc.destroy( last );
+            }
+        }
+    }
+
+} // namespace ft
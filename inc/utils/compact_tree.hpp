@@ -0,0 +1,916 @@
+#pragma once
+
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+
+#include "./iterator.hpp"
+#include "./functional.hpp"
+#include "./tree.hpp"
+#include "./type_traits.hpp"
+#include "./utility.hpp"
+#include "../vector.hpp"
+
+#ifndef nullptr
+#define nullptr NULL
+#endif
+
+namespace ft
+{
+
+    /* ------------------------- compact_tree_node -------------------------- */
+
+    /*
+    ** The node of a compact_tree: instead of three pointers it links its
+    ** parent and children by 32 bit indices into the node array of the tree,
+    ** the colour is kept in the lowest bit of the parent link.
+    ** Index 0 is the tree's null node, index 1 its base (end()) node.
+    ** The value is raw storage, aligned like T: the tree constructs it when
+    ** the node is linked in and destroys it when the node is erased, so the
+    ** sentinels and free slots never hold one.
+    */
+
+    typedef unsigned int    compact_index; // 32 bit on all supported platforms
+
+    template <typename T>
+    struct compact_tree_node
+    {
+        typedef T           value_type;
+
+        compact_index       _parent_colour; // parent index << 1 | colour bit
+        compact_index       _left;
+        compact_index       _right; // next free slot, while the node is on the free list
+        char                _storage[sizeof( T )] __attribute__( ( aligned( __alignof__( T ) ) ) );
+
+        compact_index get_parent() const;
+        void set_parent( compact_index parent );
+        node_state get_colour() const;
+        void set_colour( node_state colour );
+        T* value();
+        const T* value() const;
+    }; // compact_tree_node
+
+    template <typename T>
+    struct is_trivially_default_constructible<compact_tree_node<T> > : public true_type {};
+
+    /* compact_tree_node member functions */
+
+    template <typename T>
+    inline compact_index compact_tree_node<T>::get_parent() const
+    {
+        return ( this->_parent_colour >> 1 );
+    }
+
+    template <typename T>
+    inline void compact_tree_node<T>::set_parent( compact_index parent )
+    {
+        this->_parent_colour = ( parent << 1 ) | ( this->_parent_colour & 1 );
+    }
+
+    template <typename T>
+    inline node_state compact_tree_node<T>::get_colour() const
+    {
+        return ( static_cast<node_state>( this->_parent_colour & 1 ) );
+    }
+
+    template <typename T>
+    inline void compact_tree_node<T>::set_colour( node_state colour )
+    {
+        this->_parent_colour = ( this->_parent_colour & ~static_cast<compact_index>( 1 ) ) | static_cast<compact_index>( colour );
+    }
+
+    template <typename T>
+    inline T* compact_tree_node<T>::value()
+    {
+        return ( reinterpret_cast<T*>( this->_storage ) );
+    }
+
+    template <typename T>
+    inline const T* compact_tree_node<T>::value() const
+    {
+        return ( reinterpret_cast<const T*>( this->_storage ) );
+    }
+
+
+    /* ------------------------- compact_tree_links ------------------------- */
+
+    /*
+    ** The link policy of a compact_tree (see tree_links): a node is named by
+    ** its index into the node array, so the policy holds the array. The
+    ** shared red black algorithms and iterators of tree.hpp work on it as
+    ** they do on pointers. An iterator is invalidated, if the array grows.
+    */
+
+    template <typename T>
+    class compact_tree_links
+    {
+
+    public:
+        typedef compact_index               handle;
+        typedef T                           value_type;
+
+        static const bool                   ranked = false;
+
+    private:
+        compact_tree_node<T>*   _nodes;
+
+    public:
+        compact_tree_links();
+        explicit compact_tree_links( compact_tree_node<T>* nodes );
+
+        static handle null();
+        static bool is_end( handle node );
+        handle left( handle node ) const;
+        void set_left( handle node, handle child ) const;
+        handle right( handle node ) const;
+        void set_right( handle node, handle child ) const;
+        handle parent( handle node ) const;
+        void set_parent( handle node, handle parent ) const;
+        node_state colour( handle node ) const;
+        void set_colour( handle node, node_state colour ) const;
+        std::size_t count( handle node ) const;
+        void set_count( handle node, std::size_t count ) const;
+        value_type& value( handle node ) const;
+        void prefetch( handle node ) const;
+
+    }; // compact_tree_links
+
+    template <typename T>
+    const bool compact_tree_links<T>::ranked;
+
+    /* compact_tree_links member functions */
+
+    template <typename T>
+    compact_tree_links<T>::compact_tree_links() : _nodes( nullptr ) {}
+
+    template <typename T>
+    compact_tree_links<T>::compact_tree_links( compact_tree_node<T>* nodes ) : _nodes( nodes ) {}
+
+    template <typename T>
+    inline typename compact_tree_links<T>::handle compact_tree_links<T>::null()
+    {
+        return ( 0 );
+    }
+
+    template <typename T>
+    inline bool compact_tree_links<T>::is_end( handle node )
+    {
+        return ( node == 1 );
+    }
+
+    template <typename T>
+    inline typename compact_tree_links<T>::handle compact_tree_links<T>::left( handle node ) const
+    {
+        return ( this->_nodes[node]._left );
+    }
+
+    template <typename T>
+    inline void compact_tree_links<T>::set_left( handle node, handle child ) const
+    {
+        this->_nodes[node]._left = child;
+    }
+
+    template <typename T>
+    inline typename compact_tree_links<T>::handle compact_tree_links<T>::right( handle node ) const
+    {
+        return ( this->_nodes[node]._right );
+    }
+
+    template <typename T>
+    inline void compact_tree_links<T>::set_right( handle node, handle child ) const
+    {
+        this->_nodes[node]._right = child;
+    }
+
+    template <typename T>
+    inline typename compact_tree_links<T>::handle compact_tree_links<T>::parent( handle node ) const
+    {
+        return ( this->_nodes[node].get_parent() );
+    }
+
+    template <typename T>
+    inline void compact_tree_links<T>::set_parent( handle node, handle parent ) const
+    {
+        this->_nodes[node].set_parent( parent );
+    }
+
+    template <typename T>
+    inline node_state compact_tree_links<T>::colour( handle node ) const
+    {
+        return ( this->_nodes[node].get_colour() );
+    }
+
+    template <typename T>
+    inline void compact_tree_links<T>::set_colour( handle node, node_state colour ) const
+    {
+        this->_nodes[node].set_colour( colour );
+    }
+
+    template <typename T>
+    inline std::size_t compact_tree_links<T>::count( __attribute__( ( unused ) ) handle node ) const
+    {
+        return ( 0 );
+    }
+
+    template <typename T>
+    inline void compact_tree_links<T>::set_count( __attribute__( ( unused ) ) handle node, __attribute__( ( unused ) ) std::size_t count ) const {}
+
+    template <typename T>
+    inline typename compact_tree_links<T>::value_type& compact_tree_links<T>::value( handle node ) const
+    {
+        return ( *( this->_nodes[node].value() ) );
+    }
+
+    template <typename T>
+    inline void compact_tree_links<T>::prefetch( handle node ) const
+    {
+        tree_prefetch( this->_nodes + node );
+    }
+
+
+    /* ---------------------------- Compact Tree ---------------------------- */
+
+    /*
+    ** The red black tree of red_black_tree (the same algorithms of tree.hpp,
+    ** through compact_tree_links), but all nodes live in one ft::vector and are
+    ** linked by 32 bit indices. A node of a compact_tree<int> takes 16 bytes
+    ** instead of 32, and since no link is an address, the node array can be
+    ** moved as it is (bitwise, if T is trivially relocatable).
+    **
+    ** _nodes[0] is the null node, _nodes[1] the base node (its _left is the
+    ** root, its _right the right-most node). Erased slots are kept on a free
+    ** list (linked through _right) for reuse, as raw storage. The values are
+    ** exactly those of the nodes reachable from the root, so the tree grows
+    ** the node array itself (see _grow) instead of letting ft::vector copy it.
+    **
+    ** Growing the node array invalidates iterators, pointers and references
+    ** into the tree, like for ft::vector; reserve() avoids that.
+    ** At most 2^31 - 2 elements can be stored.
+    */
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue = ft::identity<T> >
+    class compact_tree
+    {
+
+    private:
+        typedef ft::compact_tree_node<T>                                    node_type;
+        typedef ft::compact_tree_links<T>                                   links_type;
+        typedef typename Allocator::template rebind<node_type>::other       node_allocator_type;
+        typedef ft::vector<node_type, node_allocator_type>                  node_vector;
+
+    public:
+        typedef T                                                           value_type;
+        typedef typename KeyOfValue::result_type                            key_type;
+        typedef Compare                                                     key_compare;
+        typedef Allocator                                                   allocator_type;
+        typedef typename allocator_type::size_type                          size_type;
+        typedef typename allocator_type::difference_type                    difference_type;
+        typedef typename allocator_type::reference                          reference;
+        typedef typename allocator_type::const_reference                    const_reference;
+        typedef typename allocator_type::pointer                            pointer;
+        typedef typename allocator_type::const_pointer                      const_pointer;
+        typedef ft::tree_iterator<links_type, value_type>                   iterator;
+        typedef ft::tree_const_iterator<links_type, value_type>             const_iterator;
+        typedef ft::reverse_iterator<iterator>                              reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator>                        const_reverse_iterator;
+
+    private:
+        typedef typename ft::is_trivially_relocatable<value_type>::type     _relocatable_values;
+
+        static const compact_index  _null = 0; // every missing child is linked to this node
+        static const compact_index  _base = 1; // _nodes[_base]._left is the root node, end()
+        static const compact_index  _max_index = ~static_cast<compact_index>( 0 ) >> 1; // one bit of the parent link holds the colour
+
+        node_vector         _nodes;
+        compact_index       _begin_node; // left-most node, a.k.a node with smallest key
+        compact_index       _free_list; // erased slots, _null if there are none
+        key_compare         _compare;
+        allocator_type      _allocator;
+        size_type           _size;
+
+    public:
+        // Constructors / Destructor / Assignment
+        explicit compact_tree( const key_compare& comp = Compare(), const allocator_type& alloc = Allocator() );
+        compact_tree( const compact_tree& other );
+        ~compact_tree();
+
+        compact_tree& operator=( const compact_tree& other );
+
+        // Iterators:
+        iterator begin();
+        const_iterator begin() const;
+        iterator end();
+        const_iterator end() const;
+        reverse_iterator rbegin();
+        const_reverse_iterator rbegin() const;
+        reverse_iterator rend();
+        const_reverse_iterator rend() const;
+
+        // Capacity
+        size_type size() const;
+        size_type max_size() const;
+        size_type capacity() const; // elements, which fit without growing the node array
+        void reserve( size_type n );
+
+        // Modifiers:
+        ft::pair<iterator,bool> insert( const value_type& value); // single element
+        iterator insert( const_iterator position, const value_type& value); // with hint
+        template <typename InputIterator>
+            void insert( InputIterator first, InputIterator last ); // range
+        template <typename ValueFactory>
+            ft::pair<iterator,bool> insert_key( const key_type& key, const ValueFactory& make_value ); // make_value() is only called, if key is missing
+        void erase( iterator position ); // iterator
+        size_type erase( const key_type& key ); // key
+        void erase( iterator first, iterator last ); // range
+        void swap( compact_tree& x );
+        void clear();
+
+        // Operations:
+        iterator find( const key_type& key );
+        const_iterator find( const key_type& key ) const;
+        size_type count( const key_type& key ) const;
+        iterator lower_bound( const key_type& key );
+        const_iterator lower_bound( const key_type& key ) const;
+        iterator upper_bound( const key_type& key );
+        const_iterator upper_bound( const key_type& key ) const;
+        ft::pair<iterator,iterator> equal_range( const key_type& key );
+        ft::pair<const_iterator,const_iterator> equal_range( const key_type& key ) const;
+
+        // Allocator / Compare:
+        allocator_type get_allocator() const;
+        key_compare key_comp() const;
+
+    private:
+        void _init_sentinels(); // only for an empty node array
+        static const key_type& _key( const value_type& value ); // KeyOfValue()( value )
+        node_type& _node( compact_index index );
+        const node_type& _node( compact_index index ) const;
+        links_type _links() const;
+        iterator _make_iter( compact_index index );
+        const_iterator _make_iter( compact_index index ) const;
+        compact_index _find_node( const key_type& key ) const; // _base, if not found
+        compact_index _lower_bound_node( const key_type& key ) const; // first node not less than key
+        compact_index _upper_bound_node( const key_type& key ) const; // first node greater than key
+        compact_index _find_insert_position( const key_type& key, compact_index& parent, bool& as_left_child ) const;
+        compact_index _insert_node_at( compact_index parent, bool as_left_child, compact_index new_node ); // links a new leaf below parent and rebalances
+        compact_index _create_node( const value_type& value );
+        void _destroy_node( compact_index index );
+        void _grow( size_type n ); // room for n elements
+        void _relocate_values( node_vector& nodes, ft::true_type );
+        void _relocate_values( node_vector& nodes, ft::false_type );
+        void _copy_nodes( const compact_tree& src ); // only for an empty tree
+        void _destroy_values();
+
+    }; // compact_tree
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    const compact_index compact_tree<T, Compare, Allocator, KeyOfValue>::_null;
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    const compact_index compact_tree<T, Compare, Allocator, KeyOfValue>::_base;
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    const compact_index compact_tree<T, Compare, Allocator, KeyOfValue>::_max_index;
+
+    /* compact_tree member functions */
+    /* public */
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    compact_tree<T, Compare, Allocator, KeyOfValue>::compact_tree( const key_compare& comp, const allocator_type& alloc )
+    : _nodes( node_allocator_type( alloc ) ), _begin_node( _base ), _free_list( _null ), _compare( comp ), _allocator( alloc ), _size( 0 )
+    {
+        this->_init_sentinels();
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    compact_tree<T, Compare, Allocator, KeyOfValue>::compact_tree( const compact_tree& src )
+    : _nodes( src._nodes.get_allocator() ), _begin_node( _base ), _free_list( _null ), _compare( src._compare ), _allocator( src._allocator ), _size( 0 )
+    {
+        this->_copy_nodes( src );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    compact_tree<T, Compare, Allocator, KeyOfValue>::~compact_tree()
+    {
+        this->_destroy_values();
+    }
+
+    // Keeps the storage of the node array: a value may not be assignable, so every one is copy constructed.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    compact_tree<T, Compare, Allocator, KeyOfValue>& compact_tree<T, Compare, Allocator, KeyOfValue>::operator=( const compact_tree& other )
+    {
+        if ( this != &other )
+        {
+            this->_destroy_values();
+            this->_nodes.clear();
+            this->_compare = other._compare;
+            this->_copy_nodes( other );
+        }
+        return ( *( this ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename compact_tree<T, Compare, Allocator, KeyOfValue>::iterator compact_tree<T, Compare, Allocator, KeyOfValue>::begin()
+    {
+        return ( this->_make_iter( this->_begin_node ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename compact_tree<T, Compare, Allocator, KeyOfValue>::const_iterator compact_tree<T, Compare, Allocator, KeyOfValue>::begin() const
+    {
+        return ( this->_make_iter( this->_begin_node ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename compact_tree<T, Compare, Allocator, KeyOfValue>::iterator compact_tree<T, Compare, Allocator, KeyOfValue>::end()
+    {
+        return ( this->_make_iter( _base ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename compact_tree<T, Compare, Allocator, KeyOfValue>::const_iterator compact_tree<T, Compare, Allocator, KeyOfValue>::end() const
+    {
+        return ( this->_make_iter( _base ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename compact_tree<T, Compare, Allocator, KeyOfValue>::reverse_iterator compact_tree<T, Compare, Allocator, KeyOfValue>::rbegin()
+    {
+        return ( reverse_iterator( this->end() ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename compact_tree<T, Compare, Allocator, KeyOfValue>::const_reverse_iterator compact_tree<T, Compare, Allocator, KeyOfValue>::rbegin() const
+    {
+        return ( const_reverse_iterator( this->end() ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename compact_tree<T, Compare, Allocator, KeyOfValue>::reverse_iterator compact_tree<T, Compare, Allocator, KeyOfValue>::rend()
+    {
+        return ( reverse_iterator( this->begin() ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename compact_tree<T, Compare, Allocator, KeyOfValue>::const_reverse_iterator compact_tree<T, Compare, Allocator, KeyOfValue>::rend() const
+    {
+        return ( const_reverse_iterator( this->begin() ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename compact_tree<T, Compare, Allocator, KeyOfValue>::size_type compact_tree<T, Compare, Allocator, KeyOfValue>::size() const
+    {
+        return ( this->_size );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename compact_tree<T, Compare, Allocator, KeyOfValue>::size_type compact_tree<T, Compare, Allocator, KeyOfValue>::max_size() const
+    {
+        size_type vector_max = this->_nodes.max_size() - 2;
+        size_type index_max = static_cast<size_type>( _max_index ) - 1;
+
+        return ( ( vector_max < index_max ) ? vector_max : index_max );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename compact_tree<T, Compare, Allocator, KeyOfValue>::size_type compact_tree<T, Compare, Allocator, KeyOfValue>::capacity() const
+    {
+        return ( this->_nodes.capacity() - 2 );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void compact_tree<T, Compare, Allocator, KeyOfValue>::reserve( size_type n )
+    {
+        if ( n > this->max_size() )
+            throw std::length_error( "ft::compact_tree" );
+        if ( n > this->capacity() )
+            this->_grow( n );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    ft::pair<typename compact_tree<T, Compare, Allocator, KeyOfValue>::iterator, bool> compact_tree<T, Compare, Allocator, KeyOfValue>::insert( const value_type& value )
+    {
+        compact_index   parent;
+        bool            as_left_child;
+        compact_index   found = this->_find_insert_position( _key( value ), parent, as_left_child );
+
+        if ( found != _null )
+            return ( ft::make_pair( this->_make_iter( found ), false ) );
+        return ( ft::make_pair( this->_make_iter( this->_insert_node_at( parent, as_left_child, this->_create_node( value ) ) ), true ) );
+    }
+
+    // If value belongs directly before or after position, it is linked there
+    // without a search (amortized constant), otherwise a full insert is done.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename compact_tree<T, Compare, Allocator, KeyOfValue>::iterator compact_tree<T, Compare, Allocator, KeyOfValue>::insert( const_iterator position, const value_type& value )
+    {
+        compact_index   parent = _null; // only set, if found is _null
+        bool            as_left_child = false;
+        compact_index   found = tree_hint_insert_position( this->_links(), _base, this->_begin_node, position.base(), _key( value ), KeyOfValue(), this->_compare, parent, as_left_child );
+
+        if ( found != _null )
+            return ( this->_make_iter( found ) );
+        return ( this->_make_iter( this->_insert_node_at( parent, as_left_child, this->_create_node( value ) ) ) );
+    }
+
+    // Already sorted input is appended to the right-most node with one
+    // comparison per element instead of a full descent (see tree_find_insert_position()).
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    template <typename InputIterator>
+    void compact_tree<T, Compare, Allocator, KeyOfValue>::insert( InputIterator first, InputIterator last )
+    {
+        for ( ; first != last; ++first )
+            this->insert( *( first ) );
+    }
+
+    // Like insert( make_value() ), but with a single descent by key: the value
+    // is only built (and a slot taken), if key is not yet in the tree.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    template <typename ValueFactory>
+    ft::pair<typename compact_tree<T, Compare, Allocator, KeyOfValue>::iterator, bool> compact_tree<T, Compare, Allocator, KeyOfValue>::insert_key( const key_type& key, const ValueFactory& make_value )
+    {
+        compact_index   parent;
+        bool            as_left_child;
+        compact_index   found = this->_find_insert_position( key, parent, as_left_child );
+
+        if ( found != _null )
+            return ( ft::make_pair( this->_make_iter( found ), false ) );
+        return ( ft::make_pair( this->_make_iter( this->_insert_node_at( parent, as_left_child, this->_create_node( make_value() ) ) ), true ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void compact_tree<T, Compare, Allocator, KeyOfValue>::erase( iterator position )
+    {
+        compact_index   node = position.base();
+        links_type      links = this->_links();
+
+        if ( node == _base || node == _null )
+            return ;
+        if ( node == this->_begin_node )
+        {
+            if ( links.right( node ) != _null )
+                this->_begin_node = tree_min( links, links.right( node ) );
+            else
+                this->_begin_node = links.parent( node );
+        }
+        if ( node == links.right( _base ) )
+        {
+            if ( links.left( node ) != _null )
+                links.set_right( _base, tree_max( links, links.left( node ) ) );
+            else
+                links.set_right( _base, links.parent( node ) );
+        }
+        tree_unlink( links, node, _base );
+        this->_destroy_node( node );
+        --( this->_size );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename compact_tree<T, Compare, Allocator, KeyOfValue>::size_type compact_tree<T, Compare, Allocator, KeyOfValue>::erase( const key_type& key )
+    {
+        compact_index   node = this->_find_node( key );
+
+        if ( node == _base )
+            return ( 0 );
+        this->erase( this->_make_iter( node ) );
+        return ( 1 );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void compact_tree<T, Compare, Allocator, KeyOfValue>::erase( iterator first, iterator last )
+    {
+        while ( first != last )
+            this->erase( first++ );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void compact_tree<T, Compare, Allocator, KeyOfValue>::swap( compact_tree& x )
+    {
+        if ( this != &x )
+        {
+            this->_nodes.swap( x._nodes );
+            ft::swap( this->_begin_node, x._begin_node );
+            ft::swap( this->_free_list, x._free_list );
+            ft::swap( this->_compare, x._compare );
+            ft::swap( this->_allocator, x._allocator );
+            ft::swap( this->_size, x._size );
+        }
+    }
+
+    // Keeps the capacity of the node array.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void compact_tree<T, Compare, Allocator, KeyOfValue>::clear()
+    {
+        this->_destroy_values();
+        this->_nodes.clear();
+        this->_init_sentinels();
+        this->_begin_node = _base;
+        this->_free_list = _null;
+        this->_size = 0;
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename compact_tree<T, Compare, Allocator, KeyOfValue>::iterator compact_tree<T, Compare, Allocator, KeyOfValue>::find( const key_type& key )
+    {
+        return ( this->_make_iter( this->_find_node( key ) ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename compact_tree<T, Compare, Allocator, KeyOfValue>::const_iterator compact_tree<T, Compare, Allocator, KeyOfValue>::find( const key_type& key ) const
+    {
+        return ( this->_make_iter( this->_find_node( key ) ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename compact_tree<T, Compare, Allocator, KeyOfValue>::size_type compact_tree<T, Compare, Allocator, KeyOfValue>::count( const key_type& key ) const
+    {
+        return ( ( this->_find_node( key ) == _base ) ? 0 : 1 );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename compact_tree<T, Compare, Allocator, KeyOfValue>::iterator compact_tree<T, Compare, Allocator, KeyOfValue>::lower_bound( const key_type& key )
+    {
+        return ( this->_make_iter( this->_lower_bound_node( key ) ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename compact_tree<T, Compare, Allocator, KeyOfValue>::const_iterator compact_tree<T, Compare, Allocator, KeyOfValue>::lower_bound( const key_type& key ) const
+    {
+        return ( this->_make_iter( this->_lower_bound_node( key ) ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename compact_tree<T, Compare, Allocator, KeyOfValue>::iterator compact_tree<T, Compare, Allocator, KeyOfValue>::upper_bound( const key_type& key )
+    {
+        return ( this->_make_iter( this->_upper_bound_node( key ) ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename compact_tree<T, Compare, Allocator, KeyOfValue>::const_iterator compact_tree<T, Compare, Allocator, KeyOfValue>::upper_bound( const key_type& key ) const
+    {
+        return ( this->_make_iter( this->_upper_bound_node( key ) ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    ft::pair<typename compact_tree<T, Compare, Allocator, KeyOfValue>::iterator,
+        typename compact_tree<T, Compare, Allocator, KeyOfValue>::iterator>
+        compact_tree<T, Compare, Allocator, KeyOfValue>::equal_range( const key_type& key )
+    {
+        return ( ft::make_pair( this->lower_bound( key ), this->upper_bound( key ) ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    ft::pair<typename compact_tree<T, Compare, Allocator, KeyOfValue>::const_iterator,
+        typename compact_tree<T, Compare, Allocator, KeyOfValue>::const_iterator>
+        compact_tree<T, Compare, Allocator, KeyOfValue>::equal_range( const key_type& key ) const
+    {
+        return ( ft::make_pair( this->lower_bound( key ), this->upper_bound( key ) ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename compact_tree<T, Compare, Allocator, KeyOfValue>::allocator_type compact_tree<T, Compare, Allocator, KeyOfValue>::get_allocator() const
+    {
+        return ( this->_allocator );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename compact_tree<T, Compare, Allocator, KeyOfValue>::key_compare compact_tree<T, Compare, Allocator, KeyOfValue>::key_comp() const
+    {
+        return ( this->_compare );
+    }
+
+    /* private */
+
+    // Both sentinels are black and hold no value. The null node has no children,
+    // neither has the base node yet, so it is its own right-most node.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void compact_tree<T, Compare, Allocator, KeyOfValue>::_init_sentinels()
+    {
+        this->_nodes.resize_default_init( 2 );
+        this->_node( _null )._parent_colour = BLACK;
+        this->_node( _null )._left = _null;
+        this->_node( _null )._right = _null;
+        this->_node( _base )._parent_colour = BLACK;
+        this->_node( _base )._left = _null;
+        this->_node( _base )._right = _base;
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    inline const typename compact_tree<T, Compare, Allocator, KeyOfValue>::key_type& compact_tree<T, Compare, Allocator, KeyOfValue>::_key( const value_type& value )
+    {
+        return ( KeyOfValue()( value ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    inline typename compact_tree<T, Compare, Allocator, KeyOfValue>::node_type& compact_tree<T, Compare, Allocator, KeyOfValue>::_node( compact_index index )
+    {
+        return ( this->_nodes[index] );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    inline const typename compact_tree<T, Compare, Allocator, KeyOfValue>::node_type& compact_tree<T, Compare, Allocator, KeyOfValue>::_node( compact_index index ) const
+    {
+        return ( this->_nodes[index] );
+    }
+
+    // The policy holds the address of the node array, so it is only valid until the array grows.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    inline typename compact_tree<T, Compare, Allocator, KeyOfValue>::links_type compact_tree<T, Compare, Allocator, KeyOfValue>::_links() const
+    {
+        return ( links_type( const_cast<node_type*>( &this->_nodes[0] ) ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    inline typename compact_tree<T, Compare, Allocator, KeyOfValue>::iterator compact_tree<T, Compare, Allocator, KeyOfValue>::_make_iter( compact_index index )
+    {
+        return ( iterator( index, this->_links() ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    inline typename compact_tree<T, Compare, Allocator, KeyOfValue>::const_iterator compact_tree<T, Compare, Allocator, KeyOfValue>::_make_iter( compact_index index ) const
+    {
+        return ( const_iterator( index, this->_links() ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    inline compact_index compact_tree<T, Compare, Allocator, KeyOfValue>::_find_node( const key_type& key ) const
+    {
+        return ( tree_find( this->_links(), _base, key, KeyOfValue(), this->_compare ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    inline compact_index compact_tree<T, Compare, Allocator, KeyOfValue>::_lower_bound_node( const key_type& key ) const
+    {
+        return ( tree_lower_bound( this->_links(), _base, key, KeyOfValue(), this->_compare ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    inline compact_index compact_tree<T, Compare, Allocator, KeyOfValue>::_upper_bound_node( const key_type& key ) const
+    {
+        return ( tree_upper_bound( this->_links(), _base, key, KeyOfValue(), this->_compare ) );
+    }
+
+    // _null, if key is not yet part of the tree (see tree_find_insert_position())
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    inline compact_index compact_tree<T, Compare, Allocator, KeyOfValue>::_find_insert_position( const key_type& key, compact_index& parent, bool& as_left_child ) const
+    {
+        return ( tree_find_insert_position( this->_links(), _base, key, KeyOfValue(), this->_compare, parent, as_left_child ) );
+    }
+
+    // The node array may have grown for new_node, so the policy is taken afterwards.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    compact_index compact_tree<T, Compare, Allocator, KeyOfValue>::_insert_node_at( compact_index parent, bool as_left_child, compact_index new_node )
+    {
+        tree_insert_leaf( this->_links(), _base, this->_begin_node, parent, as_left_child, new_node );
+        ++( this->_size );
+        return ( new_node );
+    }
+
+    // Takes a slot from the free list, or appends one to the node array. The
+    // value is constructed first, so a throwing copy leaves the tree as it was.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    compact_index compact_tree<T, Compare, Allocator, KeyOfValue>::_create_node( const value_type& value )
+    {
+        compact_index   index = this->_free_list;
+
+        if ( index != _null )
+        {
+            this->_allocator.construct( this->_node( index ).value(), value );
+            this->_free_list = this->_node( index )._right;
+        }
+        else
+        {
+            if ( this->_size >= this->max_size() )
+                throw std::length_error( "ft::compact_tree" );
+            if ( this->_nodes.size() == this->_nodes.capacity() )
+                this->_grow( ( this->_size < this->max_size() / 2 ) ? ( ( this->_size > 0 ) ? this->_size * 2 : 1 ) : this->max_size() );
+            index = static_cast<compact_index>( this->_nodes.size() );
+            this->_nodes.resize_default_init( this->_nodes.size() + 1 );
+            try
+            {
+                this->_allocator.construct( this->_node( index ).value(), value );
+            }
+            catch ( ... )
+            {
+                this->_nodes.pop_back();
+                throw ;
+            }
+        }
+        this->_node( index ).set_colour( RED );
+        this->_node( index ).set_parent( _null );
+        this->_node( index )._left = _null;
+        this->_node( index )._right = _null;
+        return ( index );
+    }
+
+    // The slot goes back to raw storage on the free list.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void compact_tree<T, Compare, Allocator, KeyOfValue>::_destroy_node( compact_index index )
+    {
+        this->_allocator.destroy( this->_node( index ).value() );
+        this->_node( index )._left = _null;
+        this->_node( index )._right = this->_free_list;
+        this->_free_list = index;
+    }
+
+    // Moves the nodes into a fresh array for n elements, at the same indices.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void compact_tree<T, Compare, Allocator, KeyOfValue>::_grow( size_type n )
+    {
+        node_vector nodes( this->_nodes.get_allocator() );
+
+        nodes.reserve( n + 2 );
+        nodes.resize_default_init( this->_nodes.size() );
+        this->_relocate_values( nodes, _relocatable_values() );
+        this->_nodes.swap( nodes );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void compact_tree<T, Compare, Allocator, KeyOfValue>::_relocate_values( node_vector& nodes, ft::true_type )
+    {
+        std::memcpy( static_cast<void*>( &nodes[0] ), &this->_nodes[0], this->_nodes.size() * sizeof( node_type ) );
+    }
+
+    // Copies every value before the first one is destroyed, so a throwing copy leaves the tree as it was.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void compact_tree<T, Compare, Allocator, KeyOfValue>::_relocate_values( node_vector& nodes, ft::false_type )
+    {
+        links_type      links = this->_links();
+        links_type      new_links( &nodes[0] );
+        compact_index   node = this->_begin_node;
+
+        for ( size_type i = 0; i < this->_nodes.size(); ++i )
+        {
+            nodes[i]._parent_colour = this->_nodes[i]._parent_colour;
+            nodes[i]._left = this->_nodes[i]._left;
+            nodes[i]._right = this->_nodes[i]._right;
+        }
+        try
+        {
+            for ( ; node != _base; node = tree_next( links, node ) )
+                this->_allocator.construct( &new_links.value( node ), links.value( node ) );
+        }
+        catch ( ... )
+        {
+            for ( compact_index done = this->_begin_node; done != node; done = tree_next( links, done ) )
+                this->_allocator.destroy( &new_links.value( done ) );
+            throw ;
+        }
+        this->_destroy_values();
+    }
+
+    // The links are indices, so they are copied as they are, free slots included.
+    // If a copy throws, the tree is left empty.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void compact_tree<T, Compare, Allocator, KeyOfValue>::_copy_nodes( const compact_tree& src )
+    {
+        links_type      src_links = src._links();
+        compact_index   node = src._begin_node;
+
+        this->_nodes.resize_default_init( src._nodes.size() );
+        for ( size_type i = 0; i < src._nodes.size(); ++i )
+        {
+            this->_nodes[i]._parent_colour = src._nodes[i]._parent_colour;
+            this->_nodes[i]._left = src._nodes[i]._left;
+            this->_nodes[i]._right = src._nodes[i]._right;
+        }
+        try
+        {
+            for ( ; node != _base; node = tree_next( src_links, node ) )
+                this->_allocator.construct( this->_node( node ).value(), src_links.value( node ) );
+        }
+        catch ( ... )
+        {
+            for ( compact_index done = src._begin_node; done != node; done = tree_next( src_links, done ) )
+                this->_allocator.destroy( this->_node( done ).value() );
+            this->_nodes.clear();
+            this->_init_sentinels();
+            this->_begin_node = _base;
+            this->_free_list = _null;
+            this->_size = 0;
+            throw ;
+        }
+        this->_begin_node = src._begin_node;
+        this->_free_list = src._free_list;
+        this->_size = src._size;
+    }
+
+    // Only the nodes reachable from the root hold a value.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void compact_tree<T, Compare, Allocator, KeyOfValue>::_destroy_values()
+    {
+        links_type  links = this->_links();
+
+        for ( compact_index node = this->_begin_node; node != _base; node = tree_next( links, node ) )
+            this->_allocator.destroy( &links.value( node ) );
+    }
+
+    /* compact_tree non-member functions */
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void swap( compact_tree<T, Compare, Allocator, KeyOfValue>& lhs, compact_tree<T, Compare, Allocator, KeyOfValue>& rhs )
+    {
+        lhs.swap( rhs );
+    }
+
+} // namespace ft
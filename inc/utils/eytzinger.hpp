@@ -0,0 +1,215 @@
+#pragma once
+
+#include <cstddef>
+
+#include "./iterator.hpp"
+
+#ifndef nullptr
+#define nullptr NULL
+#endif
+
+namespace ft
+{
+
+    /* --------------------------- eytzinger layout ------------------------- */
+
+    /*
+    ** The Eytzinger layout stores a sorted sequence of n elements as an
+    ** implicit binary search tree in breadth first order: with 1-based
+    ** positions, the children of position k are 2k and 2k + 1. The first
+    ** levels of every search share a few cache lines, and the position of
+    ** the next node is computed, not loaded.
+    **
+    ** These functions walk the tree in order. Position 0 stands for end().
+    ** A right child has an odd position, so climbing up until the node is
+    ** a left child is one shift past the trailing ones of k.
+    */
+
+    // The left-most position: the smallest element.
+    inline std::size_t eytzinger_first( std::size_t n )
+    {
+        std::size_t k = ( n > 0 ) ? 1 : 0;
+
+        while ( k != 0 && 2 * k <= n )
+            k = 2 * k;
+        return ( k );
+    }
+
+    // The right-most position: the greatest element.
+    inline std::size_t eytzinger_last( std::size_t n )
+    {
+        std::size_t k = ( n > 0 ) ? 1 : 0;
+
+        while ( k != 0 && 2 * k + 1 <= n )
+            k = 2 * k + 1;
+        return ( k );
+    }
+
+    // In-order successor of k, 0 after the greatest element.
+    inline std::size_t eytzinger_next( std::size_t k, std::size_t n )
+    {
+        if ( 2 * k + 1 <= n )
+        {
+            k = 2 * k + 1;
+            while ( 2 * k <= n )
+                k = 2 * k;
+            return ( k );
+        }
+        return ( k >> ( __builtin_ctzl( static_cast<unsigned long>( ~k ) ) + 1 ) );
+    }
+
+    // In-order predecessor of k, the greatest element for 0 (end()).
+    inline std::size_t eytzinger_prev( std::size_t k, std::size_t n )
+    {
+        if ( k == 0 )
+            return ( eytzinger_last( n ) );
+        if ( 2 * k <= n )
+        {
+            k = 2 * k;
+            while ( 2 * k + 1 <= n )
+                k = 2 * k + 1;
+            return ( k );
+        }
+        return ( k >> ( __builtin_ctzl( static_cast<unsigned long>( k ) ) + 1 ) );
+    }
+
+
+    /* ------------------------- Eytzinger Iterator ------------------------- */
+
+    /*
+    ** A constant bidirectional_iterator, which visits an Eytzinger array in
+    ** sorted order: the array, its size and the 1-based position.
+    ** end() is position 0.
+    */
+
+    template <typename T>
+    class eytzinger_iterator
+    {
+
+    public:
+        typedef bidirectional_iterator_tag          iterator_category;
+        typedef T                                   value_type;
+        typedef ptrdiff_t                           difference_type;
+        typedef const T*                            pointer;
+        typedef const T&                            reference;
+
+    private:
+        const T*        _data;
+        std::size_t     _size;
+        std::size_t     _position;
+
+    public:
+        eytzinger_iterator();
+        eytzinger_iterator( const T* data, std::size_t size, std::size_t position );
+        eytzinger_iterator( const eytzinger_iterator& other );
+        ~eytzinger_iterator();
+
+        eytzinger_iterator& operator=( const eytzinger_iterator& src );
+
+        const T* base() const;
+        std::size_t position() const;
+        reference operator*() const;
+        pointer operator->() const;
+        eytzinger_iterator& operator++();
+        eytzinger_iterator  operator++(int);
+        eytzinger_iterator& operator--();
+        eytzinger_iterator  operator--(int);
+
+    }; // eytzinger_iterator
+
+    /* eytzinger_iterator member functions */
+
+    template <typename T>
+    eytzinger_iterator<T>::eytzinger_iterator() : _data( nullptr ), _size( 0 ), _position( 0 ) {}
+
+    template <typename T>
+    eytzinger_iterator<T>::eytzinger_iterator( const T* data, std::size_t size, std::size_t position )
+    : _data( data ), _size( size ), _position( position ) {}
+
+    template <typename T>
+    eytzinger_iterator<T>::eytzinger_iterator( const eytzinger_iterator& other )
+    : _data( other._data ), _size( other._size ), _position( other._position ) {}
+
+    template <typename T>
+    eytzinger_iterator<T>::~eytzinger_iterator() {}
+
+    template <typename T>
+    eytzinger_iterator<T>& eytzinger_iterator<T>::operator=( const eytzinger_iterator& src )
+    {
+        this->_data = src._data;
+        this->_size = src._size;
+        this->_position = src._position;
+        return ( *( this ) );
+    }
+
+    template <typename T>
+    const T* eytzinger_iterator<T>::base() const
+    {
+        return ( this->_data );
+    }
+
+    template <typename T>
+    std::size_t eytzinger_iterator<T>::position() const
+    {
+        return ( this->_position );
+    }
+
+    template <typename T>
+    typename eytzinger_iterator<T>::reference eytzinger_iterator<T>::operator*() const
+    {
+        return ( this->_data[this->_position - 1] );
+    }
+
+    template <typename T>
+    typename eytzinger_iterator<T>::pointer eytzinger_iterator<T>::operator->() const
+    {
+        return ( this->_data + this->_position - 1 );
+    }
+
+    template <typename T>
+    eytzinger_iterator<T>& eytzinger_iterator<T>::operator++()
+    {
+        this->_position = eytzinger_next( this->_position, this->_size );
+        return ( *( this ) );
+    }
+
+    template <typename T>
+    eytzinger_iterator<T>  eytzinger_iterator<T>::operator++( int )
+    {
+        eytzinger_iterator  it = *( this );
+
+        ++( *( this ) );
+        return ( it );
+    }
+
+    template <typename T>
+    eytzinger_iterator<T>& eytzinger_iterator<T>::operator--()
+    {
+        this->_position = eytzinger_prev( this->_position, this->_size );
+        return ( *( this ) );
+    }
+
+    template <typename T>
+    eytzinger_iterator<T>  eytzinger_iterator<T>::operator--( int )
+    {
+        eytzinger_iterator  it = *( this );
+
+        --( *( this ) );
+        return ( it );
+    }
+
+    /* eytzinger_iterator non-member functions */
+
+    template <typename T>
+    inline bool operator==( const eytzinger_iterator<T>& lhs, const eytzinger_iterator<T>& rhs )
+    {
+        return ( lhs.base() == rhs.base() && lhs.position() == rhs.position() );
+    }
+
+    template <typename T>
+    inline bool operator!=( const eytzinger_iterator<T>& lhs, const eytzinger_iterator<T>& rhs )
+    {
+        return ( !( lhs == rhs ) );
+    }
+
+} // namespace ft
@@ -0,0 +1,583 @@
+#pragma once
+
+#include <memory>
+#include <stdexcept>
+
+#include "./iterator.hpp"
+#include "./functional.hpp"
+#include "./type_traits.hpp"
+#include "./utility.hpp"
+#include "../vector.hpp"
+
+#ifndef nullptr
+#define nullptr NULL
+#endif
+
+namespace ft
+{
+
+    /* ------------------------------ Flat Tree ----------------------------- */
+
+    /*
+    ** An ordered container of unique keys with the interface of
+    ** red_black_tree, stored as one sorted ft::vector: a lookup is a binary
+    ** search over contiguous memory and iterators are random access.
+    ** Inserting or erasing a single element shifts the elements behind it,
+    ** so this suits tables which are built in batches and then mostly read:
+    ** insert( first, last ) appends the whole range, sorts it and merges it
+    ** into the old elements in O(n + m log m).
+    **
+    ** Like for ft::vector, inserting and erasing invalidate iterators,
+    ** pointers and references. value_type has to be assignable.
+    */
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue = ft::identity<T> >
+    class flat_tree
+    {
+
+    private:
+        typedef ft::vector<T, Allocator>                                    value_vector;
+
+    public:
+        typedef T                                                           value_type;
+        typedef typename KeyOfValue::result_type                            key_type;
+        typedef Compare                                                     key_compare;
+        typedef Allocator                                                   allocator_type;
+        typedef typename allocator_type::size_type                          size_type;
+        typedef typename allocator_type::difference_type                    difference_type;
+        typedef typename allocator_type::reference                          reference;
+        typedef typename allocator_type::const_reference                    const_reference;
+        typedef typename allocator_type::pointer                            pointer;
+        typedef typename allocator_type::const_pointer                      const_pointer;
+        typedef typename value_vector::iterator                             iterator;
+        typedef typename value_vector::const_iterator                       const_iterator;
+        typedef typename value_vector::reverse_iterator                     reverse_iterator;
+        typedef typename value_vector::const_reverse_iterator               const_reverse_iterator;
+
+    private:
+        static const size_type  _run = 16; // the sort starts from runs of this length, sorted by insertion
+
+        value_vector        _values;
+        key_compare         _compare;
+
+    public:
+        // Constructors / Destructor / Assignment
+        explicit flat_tree( const key_compare& comp = Compare(), const allocator_type& alloc = Allocator() );
+        flat_tree( const flat_tree& other );
+        ~flat_tree();
+
+        flat_tree& operator=( const flat_tree& other );
+
+        // Iterators:
+        iterator begin();
+        const_iterator begin() const;
+        iterator end();
+        const_iterator end() const;
+        reverse_iterator rbegin();
+        const_reverse_iterator rbegin() const;
+        reverse_iterator rend();
+        const_reverse_iterator rend() const;
+
+        // Capacity
+        size_type size() const;
+        size_type max_size() const;
+        size_type capacity() const;
+        void reserve( size_type n );
+
+        // Modifiers:
+        ft::pair<iterator,bool> insert( const value_type& value); // single element
+        iterator insert( const_iterator position, const value_type& value); // with hint
+        template <typename InputIterator>
+            void insert( InputIterator first, InputIterator last ); // range: append, sort, merge
+        template <typename ValueFactory>
+            ft::pair<iterator,bool> insert_key( const key_type& key, const ValueFactory& make_value ); // make_value() is only called, if key is missing
+        void erase( const_iterator position ); // iterator
+        size_type erase( const key_type& key ); // key
+        void erase( const_iterator first, const_iterator last ); // range
+        void swap( flat_tree& x );
+        void clear(); // keeps the capacity
+
+        // Operations:
+        iterator find( const key_type& key );
+        const_iterator find( const key_type& key ) const;
+        size_type count( const key_type& key ) const;
+        iterator lower_bound( const key_type& key );
+        const_iterator lower_bound( const key_type& key ) const;
+        iterator upper_bound( const key_type& key );
+        const_iterator upper_bound( const key_type& key ) const;
+        ft::pair<iterator,iterator> equal_range( const key_type& key );
+        ft::pair<const_iterator,const_iterator> equal_range( const key_type& key ) const;
+
+        // Allocator / Compare:
+        allocator_type get_allocator() const;
+        key_compare key_comp() const;
+
+    private:
+        static const key_type& _key( const value_type& value ); // KeyOfValue()( value )
+        iterator _make_iter( const_iterator position );
+        size_type _lower_bound_index( const key_type& key ) const;
+        size_type _upper_bound_index( const key_type& key ) const;
+        bool _find_insert_position( const key_type& key, size_type& index ) const; // true, if key is at index
+        bool _less( const value_type& lhs, const value_type& rhs ) const;
+        void _sort_unique( size_type first ); // sorts [first, size()) stably, keeps the first of equal elements
+        void _insertion_sort( pointer first, pointer last );
+        void _merge( const_pointer first1, const_pointer last1, const_pointer first2, const_pointer last2, pointer dest );
+        void _merge_unique( size_type middle ); // merges the sorted [middle, size()) into [0, middle), old elements win
+
+    }; // flat_tree
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    const typename flat_tree<T, Compare, Allocator, KeyOfValue>::size_type flat_tree<T, Compare, Allocator, KeyOfValue>::_run;
+
+    /* flat_tree member functions */
+    /* public */
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    flat_tree<T, Compare, Allocator, KeyOfValue>::flat_tree( const key_compare& comp, const allocator_type& alloc )
+    : _values( alloc ), _compare( comp ) {}
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    flat_tree<T, Compare, Allocator, KeyOfValue>::flat_tree( const flat_tree& src )
+    : _values( src._values ), _compare( src._compare ) {}
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    flat_tree<T, Compare, Allocator, KeyOfValue>::~flat_tree() {}
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    flat_tree<T, Compare, Allocator, KeyOfValue>& flat_tree<T, Compare, Allocator, KeyOfValue>::operator=( const flat_tree& other )
+    {
+        if ( this != &other )
+        {
+            this->_values = other._values;
+            this->_compare = other._compare;
+        }
+        return ( *( this ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename flat_tree<T, Compare, Allocator, KeyOfValue>::iterator flat_tree<T, Compare, Allocator, KeyOfValue>::begin()
+    {
+        return ( this->_values.begin() );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename flat_tree<T, Compare, Allocator, KeyOfValue>::const_iterator flat_tree<T, Compare, Allocator, KeyOfValue>::begin() const
+    {
+        return ( this->_values.begin() );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename flat_tree<T, Compare, Allocator, KeyOfValue>::iterator flat_tree<T, Compare, Allocator, KeyOfValue>::end()
+    {
+        return ( this->_values.end() );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename flat_tree<T, Compare, Allocator, KeyOfValue>::const_iterator flat_tree<T, Compare, Allocator, KeyOfValue>::end() const
+    {
+        return ( this->_values.end() );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename flat_tree<T, Compare, Allocator, KeyOfValue>::reverse_iterator flat_tree<T, Compare, Allocator, KeyOfValue>::rbegin()
+    {
+        return ( this->_values.rbegin() );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename flat_tree<T, Compare, Allocator, KeyOfValue>::const_reverse_iterator flat_tree<T, Compare, Allocator, KeyOfValue>::rbegin() const
+    {
+        return ( this->_values.rbegin() );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename flat_tree<T, Compare, Allocator, KeyOfValue>::reverse_iterator flat_tree<T, Compare, Allocator, KeyOfValue>::rend()
+    {
+        return ( this->_values.rend() );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename flat_tree<T, Compare, Allocator, KeyOfValue>::const_reverse_iterator flat_tree<T, Compare, Allocator, KeyOfValue>::rend() const
+    {
+        return ( this->_values.rend() );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename flat_tree<T, Compare, Allocator, KeyOfValue>::size_type flat_tree<T, Compare, Allocator, KeyOfValue>::size() const
+    {
+        return ( this->_values.size() );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename flat_tree<T, Compare, Allocator, KeyOfValue>::size_type flat_tree<T, Compare, Allocator, KeyOfValue>::max_size() const
+    {
+        return ( this->_values.max_size() );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename flat_tree<T, Compare, Allocator, KeyOfValue>::size_type flat_tree<T, Compare, Allocator, KeyOfValue>::capacity() const
+    {
+        return ( this->_values.capacity() );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void flat_tree<T, Compare, Allocator, KeyOfValue>::reserve( size_type n )
+    {
+        this->_values.reserve( n );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    ft::pair<typename flat_tree<T, Compare, Allocator, KeyOfValue>::iterator, bool> flat_tree<T, Compare, Allocator, KeyOfValue>::insert( const value_type& value )
+    {
+        size_type   index;
+
+        if ( this->_find_insert_position( _key( value ), index ) )
+            return ( ft::make_pair( this->_values.begin() + index, false ) );
+        return ( ft::make_pair( this->_values.insert( this->_values.begin() + index, value ), true ) );
+    }
+
+    // If value belongs directly before position, it is inserted there
+    // without a search, otherwise a full insert is done.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename flat_tree<T, Compare, Allocator, KeyOfValue>::iterator flat_tree<T, Compare, Allocator, KeyOfValue>::insert( const_iterator position, const value_type& value )
+    {
+        if ( ( position == this->end() || this->_less( value, *( position ) ) )
+                && ( position == this->begin() || this->_less( *( position - 1 ), value ) ) )
+            return ( this->_values.insert( this->_make_iter( position ), value ) );
+        return ( this->insert( value ).first );
+    }
+
+    // Appends the whole range first: its elements are sorted among
+    // themselves and then merged with the old ones in a single pass,
+    // instead of shifting the tail once per element. Input that already
+    // follows the last element only costs the check.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    template <typename InputIterator>
+    void flat_tree<T, Compare, Allocator, KeyOfValue>::insert( InputIterator first, InputIterator last )
+    {
+        size_type   middle = this->_values.size();
+
+        this->_values.insert( this->_values.end(), first, last );
+        if ( this->_values.size() == middle )
+            return ;
+        this->_sort_unique( middle );
+        if ( middle > 0 && !( this->_less( this->_values[middle - 1], this->_values[middle] ) ) )
+            this->_merge_unique( middle );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    template <typename ValueFactory>
+    ft::pair<typename flat_tree<T, Compare, Allocator, KeyOfValue>::iterator, bool> flat_tree<T, Compare, Allocator, KeyOfValue>::insert_key( const key_type& key, const ValueFactory& make_value )
+    {
+        size_type   index;
+
+        if ( this->_find_insert_position( key, index ) )
+            return ( ft::make_pair( this->_values.begin() + index, false ) );
+        return ( ft::make_pair( this->_values.insert( this->_values.begin() + index, make_value() ), true ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void flat_tree<T, Compare, Allocator, KeyOfValue>::erase( const_iterator position )
+    {
+        this->_values.erase( this->_make_iter( position ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename flat_tree<T, Compare, Allocator, KeyOfValue>::size_type flat_tree<T, Compare, Allocator, KeyOfValue>::erase( const key_type& key )
+    {
+        iterator    position = this->find( key );
+
+        if ( position == this->end() )
+            return ( 0 );
+        this->_values.erase( position );
+        return ( 1 );
+    }
+
+    // One shift of the tail for the whole range.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void flat_tree<T, Compare, Allocator, KeyOfValue>::erase( const_iterator first, const_iterator last )
+    {
+        this->_values.erase( this->_make_iter( first ), this->_make_iter( last ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void flat_tree<T, Compare, Allocator, KeyOfValue>::swap( flat_tree& x )
+    {
+        if ( this != &x )
+        {
+            this->_values.swap( x._values );
+            ft::swap( this->_compare, x._compare );
+        }
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void flat_tree<T, Compare, Allocator, KeyOfValue>::clear()
+    {
+        this->_values.clear();
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename flat_tree<T, Compare, Allocator, KeyOfValue>::iterator flat_tree<T, Compare, Allocator, KeyOfValue>::find( const key_type& key )
+    {
+        size_type   index = this->_lower_bound_index( key );
+
+        if ( index == this->_values.size() || this->_compare( key, _key( this->_values[index] ) ) )
+            return ( this->end() );
+        return ( this->begin() + index );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename flat_tree<T, Compare, Allocator, KeyOfValue>::const_iterator flat_tree<T, Compare, Allocator, KeyOfValue>::find( const key_type& key ) const
+    {
+        size_type   index = this->_lower_bound_index( key );
+
+        if ( index == this->_values.size() || this->_compare( key, _key( this->_values[index] ) ) )
+            return ( this->end() );
+        return ( this->begin() + index );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename flat_tree<T, Compare, Allocator, KeyOfValue>::size_type flat_tree<T, Compare, Allocator, KeyOfValue>::count( const key_type& key ) const
+    {
+        return ( ( this->find( key ) == this->end() ) ? 0 : 1 );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename flat_tree<T, Compare, Allocator, KeyOfValue>::iterator flat_tree<T, Compare, Allocator, KeyOfValue>::lower_bound( const key_type& key )
+    {
+        return ( this->begin() + this->_lower_bound_index( key ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename flat_tree<T, Compare, Allocator, KeyOfValue>::const_iterator flat_tree<T, Compare, Allocator, KeyOfValue>::lower_bound( const key_type& key ) const
+    {
+        return ( this->begin() + this->_lower_bound_index( key ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename flat_tree<T, Compare, Allocator, KeyOfValue>::iterator flat_tree<T, Compare, Allocator, KeyOfValue>::upper_bound( const key_type& key )
+    {
+        return ( this->begin() + this->_upper_bound_index( key ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename flat_tree<T, Compare, Allocator, KeyOfValue>::const_iterator flat_tree<T, Compare, Allocator, KeyOfValue>::upper_bound( const key_type& key ) const
+    {
+        return ( this->begin() + this->_upper_bound_index( key ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    ft::pair<typename flat_tree<T, Compare, Allocator, KeyOfValue>::iterator,
+            typename flat_tree<T, Compare, Allocator, KeyOfValue>::iterator> flat_tree<T, Compare, Allocator, KeyOfValue>::equal_range( const key_type& key )
+    {
+        iterator    first = this->lower_bound( key );
+
+        if ( first == this->end() || this->_compare( key, _key( *( first ) ) ) )
+            return ( ft::make_pair( first, first ) );
+        return ( ft::make_pair( first, first + 1 ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    ft::pair<typename flat_tree<T, Compare, Allocator, KeyOfValue>::const_iterator,
+            typename flat_tree<T, Compare, Allocator, KeyOfValue>::const_iterator> flat_tree<T, Compare, Allocator, KeyOfValue>::equal_range( const key_type& key ) const
+    {
+        const_iterator  first = this->lower_bound( key );
+
+        if ( first == this->end() || this->_compare( key, _key( *( first ) ) ) )
+            return ( ft::make_pair( first, first ) );
+        return ( ft::make_pair( first, first + 1 ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename flat_tree<T, Compare, Allocator, KeyOfValue>::allocator_type flat_tree<T, Compare, Allocator, KeyOfValue>::get_allocator() const
+    {
+        return ( this->_values.get_allocator() );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename flat_tree<T, Compare, Allocator, KeyOfValue>::key_compare flat_tree<T, Compare, Allocator, KeyOfValue>::key_comp() const
+    {
+        return ( this->_compare );
+    }
+
+    /* private */
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    inline const typename flat_tree<T, Compare, Allocator, KeyOfValue>::key_type& flat_tree<T, Compare, Allocator, KeyOfValue>::_key( const value_type& value )
+    {
+        return ( KeyOfValue()( value ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    inline typename flat_tree<T, Compare, Allocator, KeyOfValue>::iterator flat_tree<T, Compare, Allocator, KeyOfValue>::_make_iter( const_iterator position )
+    {
+        return ( this->_values.begin() + ( position - this->begin() ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename flat_tree<T, Compare, Allocator, KeyOfValue>::size_type flat_tree<T, Compare, Allocator, KeyOfValue>::_lower_bound_index( const key_type& key ) const
+    {
+        size_type   low = 0;
+        size_type   high = this->_values.size();
+
+        while ( low < high )
+        {
+            size_type   middle = ( low + high ) / 2;
+
+            if ( this->_compare( _key( this->_values[middle] ), key ) )
+                low = middle + 1;
+            else
+                high = middle;
+        }
+        return ( low );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename flat_tree<T, Compare, Allocator, KeyOfValue>::size_type flat_tree<T, Compare, Allocator, KeyOfValue>::_upper_bound_index( const key_type& key ) const
+    {
+        size_type   low = 0;
+        size_type   high = this->_values.size();
+
+        while ( low < high )
+        {
+            size_type   middle = ( low + high ) / 2;
+
+            if ( this->_compare( key, _key( this->_values[middle] ) ) )
+                high = middle;
+            else
+                low = middle + 1;
+        }
+        return ( low );
+    }
+
+    // A key greater than the last element is appended after one comparison.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    bool flat_tree<T, Compare, Allocator, KeyOfValue>::_find_insert_position( const key_type& key, size_type& index ) const
+    {
+        index = this->_values.size();
+        if ( index == 0 || this->_compare( _key( this->_values.back() ), key ) )
+            return ( false );
+        index = this->_lower_bound_index( key );
+        return ( !( this->_compare( key, _key( this->_values[index] ) ) ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    inline bool flat_tree<T, Compare, Allocator, KeyOfValue>::_less( const value_type& lhs, const value_type& rhs ) const
+    {
+        return ( this->_compare( _key( lhs ), _key( rhs ) ) );
+    }
+
+    // Bottom-up merge sort: insertion sorted runs of _run elements, then
+    // rounds of pairwise merges, alternating between the range and a copy
+    // of it. Equal elements keep their order, so the first one survives.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void flat_tree<T, Compare, Allocator, KeyOfValue>::_sort_unique( size_type first )
+    {
+        pointer     values = &( this->_values[0] ) + first;
+        size_type   n = this->_values.size() - first;
+        size_type   sorted = 1;
+
+        while ( sorted < n && this->_less( values[sorted - 1], values[sorted] ) )
+            ++sorted;
+        if ( sorted == n ) // already sorted and unique
+            return ;
+
+        for ( size_type i = 0; i < n; i += _run )
+            this->_insertion_sort( values + i, values + ( ( i + _run < n ) ? i + _run : n ) );
+        if ( n > _run )
+        {
+            value_vector    buffer( values, values + n, this->_values.get_allocator() );
+            pointer         source = values;
+            pointer         dest = &( buffer[0] );
+
+            for ( size_type width = _run; width < n; width *= 2 )
+            {
+                for ( size_type i = 0; i < n; i += 2 * width )
+                {
+                    size_type   middle = ( i + width < n ) ? i + width : n;
+                    size_type   last = ( middle + width < n ) ? middle + width : n;
+
+                    this->_merge( source + i, source + middle, source + middle, source + last, dest + i );
+                }
+                ft::swap( source, dest );
+            }
+            if ( source != values )
+                ft::copy( source, source + n, values );
+        }
+
+        size_type   kept = 1;
+
+        for ( size_type i = 1; i < n; ++i )
+        {
+            if ( this->_less( values[kept - 1], values[i] ) )
+            {
+                if ( kept != i )
+                    values[kept] = values[i];
+                ++kept;
+            }
+        }
+        this->_values.erase( this->_values.begin() + first + kept, this->_values.end() );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void flat_tree<T, Compare, Allocator, KeyOfValue>::_insertion_sort( pointer first, pointer last )
+    {
+        for ( pointer it = first + 1; it < last; ++it )
+        {
+            if ( !( this->_less( *( it ), *( it - 1 ) ) ) )
+                continue ;
+
+            value_type  value( *( it ) );
+            pointer     hole = it;
+
+            for ( ; hole != first && this->_less( value, *( hole - 1 ) ); --hole )
+                *( hole ) = *( hole - 1 );
+            *( hole ) = value;
+        }
+    }
+
+    // Stable: on equal keys the element of the first range comes first.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void flat_tree<T, Compare, Allocator, KeyOfValue>::_merge( const_pointer first1, const_pointer last1, const_pointer first2, const_pointer last2, pointer dest )
+    {
+        while ( first1 != last1 && first2 != last2 )
+        {
+            if ( this->_less( *( first2 ), *( first1 ) ) )
+                *( dest++ ) = *( first2++ );
+            else
+                *( dest++ ) = *( first1++ );
+        }
+        ft::copy( first2, last2, ft::copy( first1, last1, dest ) );
+    }
+
+    // Into a new vector, which then takes the place of the old one; new
+    // elements equal to an old one are dropped.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void flat_tree<T, Compare, Allocator, KeyOfValue>::_merge_unique( size_type middle )
+    {
+        value_vector    merged( this->_values.get_allocator() );
+        const_pointer   old_first = &( this->_values[0] );
+        const_pointer   old_last = old_first + middle;
+        const_pointer   new_first = old_last;
+        const_pointer   new_last = old_first + this->_values.size();
+
+        merged.reserve( this->_values.size() );
+        while ( old_first != old_last && new_first != new_last )
+        {
+            if ( this->_less( *( new_first ), *( old_first ) ) )
+                merged.push_back( *( new_first++ ) );
+            else
+            {
+                if ( !( this->_less( *( old_first ), *( new_first ) ) ) )
+                    ++new_first;
+                merged.push_back( *( old_first++ ) );
+            }
+        }
+        for ( ; old_first != old_last; ++old_first )
+            merged.push_back( *( old_first ) );
+        for ( ; new_first != new_last; ++new_first )
+            merged.push_back( *( new_first ) );
+        this->_values.swap( merged );
+    }
+
+} // namespace ft
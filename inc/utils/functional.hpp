@@ -1,5 +1,10 @@
 #pragma once
 
+#include <cstddef>
+#include <string>
+
+#include "./utility.hpp"
+
 namespace ft
 {
 
@@ -47,4 +52,313 @@ namespace ft
         return ( x < y );
     }
 
+    /*
+    ** Not part of the C++98 standard (compare std::less<void> of C++14).
+    ** Transparent version of less: compares arguments of any two types with
+    ** operator <. Containers using it as comparison object accept lookup keys
+    ** of other types than their key_type (e.g. a const char* for std::string keys),
+    ** without constructing a temporary key_type.
+    */
+
+    template <>
+    struct less<void>
+    {
+    public:
+        typedef void    is_transparent;
+
+        template <class T, class U>
+            bool operator() ( const T& x, const U& y ) const;
+    }; // less<void>
+
+    template <class T, class U>
+    bool less<void>::operator() ( const T& x, const U& y ) const
+    {
+        return ( x < y );
+    }
+
+
+    /* ------------------------------- ranked ------------------------------- */
+
+    /*
+    ** Not part of any C++ standard.
+    ** Wraps the comparison object Compare of a map or set to opt it into
+    ** order statistics (see ft::is_ranked), e.g.
+    **     ft::map<int, int, ft::ranked<ft::less<int> > >
+    ** Every node then also stores the size of its subtree, which gives
+    ** nth(), rank() and ft::distance() on the iterators in O(log n),
+    ** at the cost of one more word per node and O(log n) to insert / erase.
+    ** Compares exactly like Compare, which has to be a class type.
+    */
+
+    template <class Compare>
+    struct ranked : public Compare
+    {
+    public:
+        typedef void    is_ranked;
+
+        ranked();
+        ranked( const Compare& comp );
+    }; // ranked
+
+    template <class Compare>
+    ranked<Compare>::ranked() : Compare() {}
+
+    template <class Compare>
+    ranked<Compare>::ranked( const Compare& comp ) : Compare( comp ) {}
+
+
+    /* ------------------------- identity / select1st ----------------------- */
+
+    /*
+    ** Not part of the C++98 standard (SGI STL extensions).
+    ** Key extraction for the tree based containers:
+    ** identity returns its argument (set), select1st the first member of a pair (map).
+    */
+
+    template <class T>
+    struct identity
+    {
+    public:
+        typedef T       argument_type;
+        typedef T       result_type;
+
+        const result_type& operator() ( const argument_type& x ) const;
+    }; // identity
+
+    template <class T>
+    const typename identity<T>::result_type& identity<T>::operator() ( const argument_type& x ) const
+    {
+        return ( x );
+    }
+
+    template <class Pair>
+    struct select1st
+    {
+    public:
+        typedef Pair                        argument_type;
+        typedef typename Pair::first_type   result_type;
+
+        const result_type& operator() ( const argument_type& x ) const;
+    }; // select1st
+
+    template <class Pair>
+    const typename select1st<Pair>::result_type& select1st<Pair>::operator() ( const argument_type& x ) const
+    {
+        return ( x.first );
+    }
+
+
+    /* ------------------ map_default_value / map_key_value ----------------- */
+
+    /*
+    ** Value factories for the insert_key() of the map containers: the value
+    ** (by default ft::pair<const Key, T>) is only built, when the factory is
+    ** invoked, i.e. only if the key is missing. map_default_value gives
+    ** ( key, T() ) for operator[], map_key_value ( key, obj ) for try_insert().
+    ** Both hold references, so they must not outlive their arguments.
+    */
+
+    template <class Key, class T, class Value = ft::pair<const Key, T> >
+    struct map_default_value
+    {
+    public:
+        typedef Value       result_type;
+
+        const Key&          key;
+
+        explicit map_default_value( const Key& k );
+
+        result_type operator() () const;
+    }; // map_default_value
+
+    template <class Key, class T, class Value>
+    map_default_value<Key, T, Value>::map_default_value( const Key& k ) : key( k ) {}
+
+    template <class Key, class T, class Value>
+    typename map_default_value<Key, T, Value>::result_type map_default_value<Key, T, Value>::operator() () const
+    {
+        return ( result_type( this->key, T() ) );
+    }
+
+    template <class Key, class T, class Value = ft::pair<const Key, T> >
+    struct map_key_value
+    {
+    public:
+        typedef Value       result_type;
+
+        const Key&          key;
+        const T&            mapped;
+
+        map_key_value( const Key& k, const T& obj );
+
+        result_type operator() () const;
+    }; // map_key_value
+
+    template <class Key, class T, class Value>
+    map_key_value<Key, T, Value>::map_key_value( const Key& k, const T& obj ) : key( k ), mapped( obj ) {}
+
+    template <class Key, class T, class Value>
+    typename map_key_value<Key, T, Value>::result_type map_key_value<Key, T, Value>::operator() () const
+    {
+        return ( result_type( this->key, this->mapped ) );
+    }
+
+
+    /* ------------------------------ equal_to ------------------------------ */
+
+    /*
+    ** (https://cplusplus.com/reference/functional/equal_to/)
+    ** Function object class for equality comparison:
+    ** Binary function object class whose call returns whether its two arguments
+    ** compare equal (as returned by operator ==).
+    */
+
+    template <class T>
+    struct equal_to : ft::binary_function<T,T,bool>
+    {
+    public:
+        bool operator() ( const T& x, const T& y ) const;
+    }; // equal_to
+
+    template <class T>
+    bool equal_to<T>::operator() ( const T& x, const T& y ) const
+    {
+        return ( x == y );
+    }
+
+
+    /* -------------------------------- hash -------------------------------- */
+
+    /*
+    ** Not part of the C++98 standard (compare std::hash of C++11).
+    ** Function object class whose call returns a hash value of its argument:
+    ** equal arguments give equal values. Defined for the integral and
+    ** floating point types, pointers and std::string; other key types of the
+    ** unordered containers specialize it, or the container gets its own Hash.
+    ** Integers hash to themselves: the containers mix the bits themselves.
+    */
+
+    // FNV-1a over the bytes, with the 64 bit parameters where std::size_t has them.
+    inline std::size_t hash_bytes( const void* data, std::size_t length )
+    {
+        const std::size_t       prime = ( sizeof( std::size_t ) > 4 ) ? ( ( static_cast<std::size_t>( 0x100UL ) << 16 << 16 ) | 0x1B3UL ) : 0x01000193UL;
+        const unsigned char*    bytes = static_cast<const unsigned char*>( data );
+        std::size_t             hash = ( sizeof( std::size_t ) > 4 ) ? ( ( static_cast<std::size_t>( 0xCBF29CE4UL ) << 16 << 16 ) | 0x84222325UL ) : 0x811C9DC5UL;
+
+        for ( std::size_t i = 0; i < length; ++i )
+        {
+            hash ^= bytes[i];
+            hash *= prime;
+        }
+        return ( hash );
+    }
+
+    template <class T>
+    struct hash; // only the specializations are defined
+
+    template <class T>
+    struct integral_hash
+    {
+    public:
+        typedef T               argument_type;
+        typedef std::size_t     result_type;
+
+        result_type operator() ( T x ) const;
+    }; // integral_hash
+
+    template <class T>
+    typename integral_hash<T>::result_type integral_hash<T>::operator() ( T x ) const
+    {
+        return ( static_cast<result_type>( x ) );
+    }
+
+    // 0.0 and -0.0 compare equal, but differ in their bytes.
+    template <class T>
+    struct floating_point_hash
+    {
+    public:
+        typedef T               argument_type;
+        typedef std::size_t     result_type;
+
+        result_type operator() ( T x ) const;
+    }; // floating_point_hash
+
+    template <class T>
+    typename floating_point_hash<T>::result_type floating_point_hash<T>::operator() ( T x ) const
+    {
+        if ( x == 0 )
+            return ( 0 );
+        return ( ft::hash_bytes( &x, sizeof( x ) ) );
+    }
+
+    template <>
+    struct hash<bool>               : public integral_hash<bool> {};
+
+    template <>
+    struct hash<char>               : public integral_hash<char> {};
+
+    template <>
+    struct hash<signed char>        : public integral_hash<signed char> {};
+
+    template <>
+    struct hash<unsigned char>      : public integral_hash<unsigned char> {};
+
+    template <>
+    struct hash<wchar_t>            : public integral_hash<wchar_t> {};
+
+    template <>
+    struct hash<short>              : public integral_hash<short> {};
+
+    template <>
+    struct hash<unsigned short>     : public integral_hash<unsigned short> {};
+
+    template <>
+    struct hash<int>                : public integral_hash<int> {};
+
+    template <>
+    struct hash<unsigned int>       : public integral_hash<unsigned int> {};
+
+    template <>
+    struct hash<long>               : public integral_hash<long> {};
+
+    template <>
+    struct hash<unsigned long>      : public integral_hash<unsigned long> {};
+
+    template <>
+    struct hash<float>              : public floating_point_hash<float> {};
+
+    template <>
+    struct hash<double>             : public floating_point_hash<double> {};
+
+    template <class T>
+    struct hash<T*>
+    {
+    public:
+        typedef T*              argument_type;
+        typedef std::size_t     result_type;
+
+        result_type operator() ( T* p ) const;
+    }; // hash<T*>
+
+    template <class T>
+    typename hash<T*>::result_type hash<T*>::operator() ( T* p ) const
+    {
+        return ( reinterpret_cast<result_type>( p ) );
+    }
+
+    template <>
+    struct hash<std::string>
+    {
+    public:
+        typedef std::string     argument_type;
+        typedef std::size_t     result_type;
+
+        result_type operator() ( const std::string& s ) const;
+    }; // hash<std::string>
+
+    inline hash<std::string>::result_type hash<std::string>::operator() ( const std::string& s ) const
+    {
+        return ( ft::hash_bytes( s.data(), s.size() ) );
+    }
+
 } // namespace ft
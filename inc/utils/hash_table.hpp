@@ -0,0 +1,1170 @@
+#pragma once
+
+#include <climits>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "./iterator.hpp"
+#include "./functional.hpp"
+#include "./type_traits.hpp"
+#include "./utility.hpp"
+#include "../vector.hpp"
+
+#ifndef nullptr
+#define nullptr NULL
+#endif
+
+namespace ft
+{
+
+    /* ------------------------ hash table control bytes -------------------- */
+
+    /*
+    ** Every slot of a hash_table has one control byte: a full slot stores the
+    ** low 7 bits of its element's hash (0 .. 127), the negative values mark
+    ** empty and deleted slots. A lookup compares the control bytes of
+    ** hash_group_width slots at once and only compares keys, where these 7
+    ** bits match; with SSE2 a group is one 16 byte load and compare.
+    **
+    ** The byte behind the last slot is a sentinel, which stops iterators,
+    ** followed by copies of the first hash_group_width - 1 control bytes, so
+    ** a group starting at any slot can be loaded without wrapping around.
+    */
+
+    typedef signed char     hash_ctrl;
+
+    const hash_ctrl         hash_ctrl_empty = -128;
+    const hash_ctrl         hash_ctrl_deleted = -2;
+    const hash_ctrl         hash_ctrl_sentinel = -1;
+    const std::size_t       hash_group_width = 16;
+
+    // The bit i of each mask stands for the control byte i of the group.
+    struct hash_group
+    {
+#ifdef __SSE2__
+        __m128i             _ctrl;
+#else
+        const hash_ctrl*    _ctrl;
+#endif
+
+        explicit hash_group( const hash_ctrl* ctrl );
+
+        unsigned int match( hash_ctrl h2 ) const;
+        unsigned int match_empty() const;
+        unsigned int match_empty_or_deleted() const;
+        std::size_t count_leading_empty_or_deleted() const;
+    }; // hash_group
+
+    /* hash_group member functions */
+
+#ifdef __SSE2__
+
+    inline hash_group::hash_group( const hash_ctrl* ctrl )
+    : _ctrl( _mm_loadu_si128( reinterpret_cast<const __m128i*>( ctrl ) ) ) {}
+
+    inline unsigned int hash_group::match( hash_ctrl h2 ) const
+    {
+        return ( static_cast<unsigned int>( _mm_movemask_epi8( _mm_cmpeq_epi8( _mm_set1_epi8( h2 ), this->_ctrl ) ) ) );
+    }
+
+    inline unsigned int hash_group::match_empty() const
+    {
+        return ( this->match( hash_ctrl_empty ) );
+    }
+
+    inline unsigned int hash_group::match_empty_or_deleted() const
+    {
+        return ( static_cast<unsigned int>( _mm_movemask_epi8( _mm_cmpgt_epi8( _mm_set1_epi8( hash_ctrl_sentinel ), this->_ctrl ) ) ) );
+    }
+
+#else
+
+    inline hash_group::hash_group( const hash_ctrl* ctrl ) : _ctrl( ctrl ) {}
+
+    inline unsigned int hash_group::match( hash_ctrl h2 ) const
+    {
+        unsigned int    mask = 0;
+
+        for ( std::size_t i = 0; i < hash_group_width; ++i )
+        {
+            if ( this->_ctrl[i] == h2 )
+                mask |= 1u << i;
+        }
+        return ( mask );
+    }
+
+    inline unsigned int hash_group::match_empty() const
+    {
+        return ( this->match( hash_ctrl_empty ) );
+    }
+
+    inline unsigned int hash_group::match_empty_or_deleted() const
+    {
+        unsigned int    mask = 0;
+
+        for ( std::size_t i = 0; i < hash_group_width; ++i )
+        {
+            if ( this->_ctrl[i] < hash_ctrl_sentinel )
+                mask |= 1u << i;
+        }
+        return ( mask );
+    }
+
+#endif
+
+    // The number of slots an iterator skips: the mask + 1 clears its trailing ones.
+    inline std::size_t hash_group::count_leading_empty_or_deleted() const
+    {
+        return ( __builtin_ctz( this->match_empty_or_deleted() + 1 ) );
+    }
+
+    /*
+    ** A slot is raw storage for one element, aligned like the leaves of a
+    ** btree. The table constructs and destroys the elements itself, so the
+    ** ft::vector holding the slots may leave them uninitialized.
+    */
+
+    template <typename T>
+    struct hash_slot
+    {
+        union _storage
+        {
+            char            bytes[sizeof( T )];
+            long double     _align_ld;
+            long            _align_l;
+            void*           _align_p;
+        };
+
+        _storage    _value;
+
+        T* value();
+        const T* value() const;
+    }; // hash_slot
+
+    template <typename T>
+    struct is_trivially_default_constructible<hash_slot<T> > : public true_type {};
+
+    /* hash_slot member functions */
+
+    template <typename T>
+    inline T* hash_slot<T>::value()
+    {
+        return ( reinterpret_cast<T*>( this->_value.bytes ) );
+    }
+
+    template <typename T>
+    inline const T* hash_slot<T>::value() const
+    {
+        return ( reinterpret_cast<const T*>( this->_value.bytes ) );
+    }
+
+
+    /* ------------------------- Hash Table Iterator ------------------------ */
+
+    /*
+    ** A forward_iterator: a control byte and its slot. end() is the sentinel
+    ** (or no slot at all, if the table never allocated any), any other
+    ** iterator points to a full slot. Iterating visits the slots in order.
+    */
+
+    template <typename T>
+    class hash_table_iterator
+    {
+
+    public:
+        typedef forward_iterator_tag                iterator_category;
+        typedef T                                   value_type;
+        typedef ptrdiff_t                           difference_type;
+        typedef T*                                  pointer;
+        typedef T&                                  reference;
+        typedef hash_slot<T>*                       slot_ptr;
+
+    private:
+        const hash_ctrl*    _ctrl;
+        slot_ptr            _slot;
+
+    public:
+        hash_table_iterator();
+        hash_table_iterator( const hash_ctrl* ctrl, slot_ptr slot );
+        hash_table_iterator( const hash_table_iterator& other );
+        ~hash_table_iterator();
+
+        hash_table_iterator& operator=( const hash_table_iterator& src );
+
+        const hash_ctrl* ctrl() const;
+        slot_ptr base() const;
+        reference operator*() const;
+        pointer operator->() const;
+        hash_table_iterator& operator++();
+        hash_table_iterator  operator++(int);
+
+    }; // hash_table_iterator
+
+    /* hash_table_iterator member functions */
+
+    template <typename T>
+    hash_table_iterator<T>::hash_table_iterator() : _ctrl( nullptr ), _slot( nullptr ) {}
+
+    template <typename T>
+    hash_table_iterator<T>::hash_table_iterator( const hash_ctrl* ctrl, slot_ptr slot ) : _ctrl( ctrl ), _slot( slot ) {}
+
+    template <typename T>
+    hash_table_iterator<T>::hash_table_iterator( const hash_table_iterator& other ) : _ctrl( other._ctrl ), _slot( other._slot ) {}
+
+    template <typename T>
+    hash_table_iterator<T>::~hash_table_iterator() {}
+
+    template <typename T>
+    hash_table_iterator<T>& hash_table_iterator<T>::operator=( const hash_table_iterator& src )
+    {
+        this->_ctrl = src._ctrl;
+        this->_slot = src._slot;
+        return ( *( this ) );
+    }
+
+    template <typename T>
+    const hash_ctrl* hash_table_iterator<T>::ctrl() const
+    {
+        return ( this->_ctrl );
+    }
+
+    template <typename T>
+    typename hash_table_iterator<T>::slot_ptr hash_table_iterator<T>::base() const
+    {
+        return ( this->_slot );
+    }
+
+    template <typename T>
+    typename hash_table_iterator<T>::reference hash_table_iterator<T>::operator*() const
+    {
+        return ( *( this->_slot->value() ) );
+    }
+
+    template <typename T>
+    typename hash_table_iterator<T>::pointer hash_table_iterator<T>::operator->() const
+    {
+        return ( this->_slot->value() );
+    }
+
+    // Skips a group of free slots at a time, the sentinel stops it.
+    template <typename T>
+    hash_table_iterator<T>& hash_table_iterator<T>::operator++()
+    {
+        ++( this->_ctrl );
+        ++( this->_slot );
+        while ( *( this->_ctrl ) < hash_ctrl_sentinel )
+        {
+            std::size_t shift = hash_group( this->_ctrl ).count_leading_empty_or_deleted();
+
+            this->_ctrl += shift;
+            this->_slot += shift;
+        }
+        return ( *( this ) );
+    }
+
+    template <typename T>
+    hash_table_iterator<T>  hash_table_iterator<T>::operator++( int )
+    {
+        hash_table_iterator it = *( this );
+
+        ++( *( this ) );
+        return ( it );
+    }
+
+    /* hash_table_iterator non-member functions */
+
+    template <typename T>
+    inline bool operator==( const hash_table_iterator<T>& lhs, const hash_table_iterator<T>& rhs )
+    {
+        return ( lhs.ctrl() == rhs.ctrl() );
+    }
+
+    template <typename T>
+    inline bool operator!=( const hash_table_iterator<T>& lhs, const hash_table_iterator<T>& rhs )
+    {
+        return ( !( lhs == rhs ) );
+    }
+
+
+    /* ---------------------- Hash Table Const Iterator --------------------- */
+
+    template <typename T>
+    class hash_table_const_iterator
+    {
+
+    public:
+        typedef forward_iterator_tag                iterator_category;
+        typedef T                                   value_type;
+        typedef ptrdiff_t                           difference_type;
+        typedef const T*                            pointer;
+        typedef const T&                            reference;
+        typedef const hash_slot<T>*                 slot_ptr;
+        typedef hash_table_iterator<T>              non_const_iterator;
+
+    private:
+        const hash_ctrl*    _ctrl;
+        slot_ptr            _slot;
+
+    public:
+        hash_table_const_iterator();
+        hash_table_const_iterator( const hash_ctrl* ctrl, slot_ptr slot );
+        hash_table_const_iterator( const hash_table_const_iterator& other );
+        hash_table_const_iterator( const non_const_iterator& other );
+        ~hash_table_const_iterator();
+
+        hash_table_const_iterator& operator=( const hash_table_const_iterator& src );
+
+        const hash_ctrl* ctrl() const;
+        slot_ptr base() const;
+        reference operator*() const;
+        pointer operator->() const;
+        hash_table_const_iterator& operator++();
+        hash_table_const_iterator  operator++(int);
+
+    }; // hash_table_const_iterator
+
+    /* hash_table_const_iterator member functions */
+
+    template <typename T>
+    hash_table_const_iterator<T>::hash_table_const_iterator() : _ctrl( nullptr ), _slot( nullptr ) {}
+
+    template <typename T>
+    hash_table_const_iterator<T>::hash_table_const_iterator( const hash_ctrl* ctrl, slot_ptr slot ) : _ctrl( ctrl ), _slot( slot ) {}
+
+    template <typename T>
+    hash_table_const_iterator<T>::hash_table_const_iterator( const hash_table_const_iterator& other ) : _ctrl( other._ctrl ), _slot( other._slot ) {}
+
+    template <typename T>
+    hash_table_const_iterator<T>::hash_table_const_iterator( const non_const_iterator& other ) : _ctrl( other.ctrl() ), _slot( other.base() ) {}
+
+    template <typename T>
+    hash_table_const_iterator<T>::~hash_table_const_iterator() {}
+
+    template <typename T>
+    hash_table_const_iterator<T>& hash_table_const_iterator<T>::operator=( const hash_table_const_iterator& src )
+    {
+        this->_ctrl = src._ctrl;
+        this->_slot = src._slot;
+        return ( *( this ) );
+    }
+
+    template <typename T>
+    const hash_ctrl* hash_table_const_iterator<T>::ctrl() const
+    {
+        return ( this->_ctrl );
+    }
+
+    template <typename T>
+    typename hash_table_const_iterator<T>::slot_ptr hash_table_const_iterator<T>::base() const
+    {
+        return ( this->_slot );
+    }
+
+    template <typename T>
+    typename hash_table_const_iterator<T>::reference hash_table_const_iterator<T>::operator*() const
+    {
+        return ( *( this->_slot->value() ) );
+    }
+
+    template <typename T>
+    typename hash_table_const_iterator<T>::pointer hash_table_const_iterator<T>::operator->() const
+    {
+        return ( this->_slot->value() );
+    }
+
+    template <typename T>
+    hash_table_const_iterator<T>& hash_table_const_iterator<T>::operator++()
+    {
+        ++( this->_ctrl );
+        ++( this->_slot );
+        while ( *( this->_ctrl ) < hash_ctrl_sentinel )
+        {
+            std::size_t shift = hash_group( this->_ctrl ).count_leading_empty_or_deleted();
+
+            this->_ctrl += shift;
+            this->_slot += shift;
+        }
+        return ( *( this ) );
+    }
+
+    template <typename T>
+    hash_table_const_iterator<T>  hash_table_const_iterator<T>::operator++( int )
+    {
+        hash_table_const_iterator   it = *( this );
+
+        ++( *( this ) );
+        return ( it );
+    }
+
+    /* hash_table_const_iterator non-member functions */
+
+    template <typename T>
+    inline bool operator==( const hash_table_const_iterator<T>& lhs, const hash_table_const_iterator<T>& rhs )
+    {
+        return ( lhs.ctrl() == rhs.ctrl() );
+    }
+
+    template <typename T>
+    inline bool operator!=( const hash_table_const_iterator<T>& lhs, const hash_table_const_iterator<T>& rhs )
+    {
+        return ( !( lhs == rhs ) );
+    }
+
+    template <typename T>
+    inline bool operator==( const hash_table_iterator<T>& lhs, const hash_table_const_iterator<T>& rhs )
+    {
+        return ( lhs.ctrl() == rhs.ctrl() );
+    }
+
+    template <typename T>
+    inline bool operator!=( const hash_table_iterator<T>& lhs, const hash_table_const_iterator<T>& rhs )
+    {
+        return ( !( lhs == rhs ) );
+    }
+
+    template <typename T>
+    inline bool operator==( const hash_table_const_iterator<T>& lhs, const hash_table_iterator<T>& rhs )
+    {
+        return ( lhs.ctrl() == rhs.ctrl() );
+    }
+
+    template <typename T>
+    inline bool operator!=( const hash_table_const_iterator<T>& lhs, const hash_table_iterator<T>& rhs )
+    {
+        return ( !( lhs == rhs ) );
+    }
+
+
+    /* ------------------------------ Hash Table ---------------------------- */
+
+    /*
+    ** An unordered container of unique keys with open addressing: the
+    ** elements live in the slots of one ft::vector, next to an ft::vector of
+    ** control bytes (see hash_group). A key's hash picks the group where its
+    ** probe sequence starts, and the following groups are visited in
+    ** quadratic steps until a group with an empty slot ends the search.
+    ** Erasing leaves a deleted mark, unless no probe sequence can have passed
+    ** the slot; inserting reuses these marks, and a rehash drops them.
+    **
+    ** The number of slots is 2^k - 1 (at least hash_group_width - 1), and it
+    ** grows, before the full and deleted slots together would exceed
+    ** max_load_factor(). Inserting may rehash, which invalidates all
+    ** iterators; otherwise elements never move, so iterators, pointers and
+    ** references stay valid until their element is erased.
+    **
+    ** Hash results are mixed by a multiplication before use, so identity
+    ** hashes like ft::hash<int> work well.
+    */
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue = ft::identity<T> >
+    class hash_table
+    {
+
+    private:
+        typedef hash_slot<T>                                                slot_type;
+        typedef typename Allocator::template rebind<slot_type>::other       slot_allocator;
+        typedef typename Allocator::template rebind<hash_ctrl>::other       ctrl_allocator;
+        typedef ft::vector<slot_type, slot_allocator>                       slot_vector;
+        typedef ft::vector<hash_ctrl, ctrl_allocator>                       ctrl_vector;
+
+    public:
+        typedef T                                                           value_type;
+        typedef typename KeyOfValue::result_type                            key_type;
+        typedef Hash                                                        hasher;
+        typedef KeyEqual                                                    key_equal;
+        typedef Allocator                                                   allocator_type;
+        typedef typename allocator_type::size_type                          size_type;
+        typedef typename allocator_type::difference_type                    difference_type;
+        typedef typename allocator_type::reference                          reference;
+        typedef typename allocator_type::const_reference                    const_reference;
+        typedef typename allocator_type::pointer                            pointer;
+        typedef typename allocator_type::const_pointer                      const_pointer;
+        typedef hash_table_iterator<value_type>                             iterator;
+        typedef hash_table_const_iterator<value_type>                       const_iterator;
+
+    private:
+        typedef typename ft::is_trivially_relocatable<value_type>::type     _relocatable_values;
+
+        ctrl_vector         _ctrl; // _capacity + hash_group_width bytes, or none
+        slot_vector         _slots;
+        size_type           _capacity; // 2^k - 1 slots, or 0
+        size_type           _size;
+        size_type           _growth_left; // empty slots, which may still be filled before a rehash
+        float               _max_load_factor;
+        hasher              _hash;
+        key_equal           _equal;
+        allocator_type      _allocator;
+
+    public:
+        // Constructors / Destructor / Assignment
+        explicit hash_table( size_type bucket_count = 0, const hasher& hash = Hash(), const key_equal& equal = KeyEqual(),
+                const allocator_type& alloc = Allocator() );
+        hash_table( const hash_table& other );
+        ~hash_table();
+
+        hash_table& operator=( const hash_table& other );
+
+        // Iterators:
+        iterator begin();
+        const_iterator begin() const;
+        iterator end();
+        const_iterator end() const;
+
+        // Capacity
+        size_type size() const;
+        size_type max_size() const;
+
+        // Modifiers:
+        ft::pair<iterator,bool> insert( const value_type& value );
+        template <typename InputIterator>
+            void insert( InputIterator first, InputIterator last );
+        template <typename ValueFactory>
+            ft::pair<iterator,bool> insert_key( const key_type& key, const ValueFactory& make_value ); // make_value() is only called, if key is missing
+        void erase( const_iterator position ); // iterator
+        size_type erase( const key_type& key ); // key
+        void erase( const_iterator first, const_iterator last ); // range
+        void swap( hash_table& x );
+        void clear(); // keeps the slots
+
+        // Operations:
+        iterator find( const key_type& key );
+        const_iterator find( const key_type& key ) const;
+        size_type count( const key_type& key ) const;
+        ft::pair<iterator,iterator> equal_range( const key_type& key );
+        ft::pair<const_iterator,const_iterator> equal_range( const key_type& key ) const;
+
+        // Hash policy:
+        size_type bucket_count() const; // the number of slots
+        float load_factor() const;
+        float max_load_factor() const;
+        void max_load_factor( float ml );
+        void rehash( size_type n ); // at least n slots, and enough for size()
+        void reserve( size_type n ); // room for n elements without a rehash
+
+        // Allocator / Hash / KeyEqual:
+        allocator_type get_allocator() const;
+        hasher hash_function() const;
+        key_equal key_eq() const;
+
+    private:
+        static const key_type& _key( const value_type& value ); // KeyOfValue()( value )
+        static size_type _mix( size_type hash );
+        static size_type _h1( size_type hash ); // where the probe sequence starts
+        static hash_ctrl _h2( size_type hash ); // the control byte
+        static size_type _find_non_full( const hash_ctrl* ctrl, size_type capacity, size_type hash );
+        static void _set_ctrl( hash_ctrl* ctrl, size_type capacity, size_type index, hash_ctrl h2 );
+        static size_type _normalize( size_type n ); // the next 2^k - 1 not less than n
+        size_type _hash_of( const key_type& key ) const;
+        size_type _growth_limit( size_type capacity ) const;
+        size_type _capacity_for( size_type n ) const; // slots needed for n elements
+        size_type _find_index( const key_type& key, size_type hash ) const; // _capacity, if key is missing
+        size_type _first_full() const;
+        iterator _make_iter( size_type index );
+        const_iterator _make_iter( size_type index ) const;
+        size_type _prepare_insert( size_type hash ); // a free slot for hash, after a rehash if needed
+        iterator _insert_new( size_type hash, const value_type& value ); // value's key is missing
+        void _erase_at( size_type index );
+        void _resize( size_type capacity );
+        void _reset_ctrl();
+        void _copy_values( const hash_table& src );
+        void _destroy_values();
+        void _relocate( slot_type* dest, slot_type* src, ft::true_type );
+        void _relocate( slot_type* dest, slot_type* src, ft::false_type );
+
+    }; // hash_table
+
+    /* hash_table member functions */
+    /* public */
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::hash_table( size_type bucket_count, const hasher& hash, const key_equal& equal,
+    const allocator_type& alloc )
+    : _ctrl( ctrl_allocator( alloc ) ), _slots( slot_allocator( alloc ) ), _capacity( 0 ), _size( 0 ), _growth_left( 0 ),
+    _max_load_factor( 0.875f ), _hash( hash ), _equal( equal ), _allocator( alloc )
+    {
+        if ( bucket_count > 0 )
+            this->_resize( _normalize( bucket_count ) );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::hash_table( const hash_table& other )
+    : _ctrl( other._ctrl ), _slots( other._slots.get_allocator() ), _capacity( other._capacity ), _size( other._size ),
+    _growth_left( other._growth_left ), _max_load_factor( other._max_load_factor ), _hash( other._hash ),
+    _equal( other._equal ), _allocator( other._allocator )
+    {
+        this->_copy_values( other );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::~hash_table()
+    {
+        this->_destroy_values();
+    }
+
+    // Takes over the layout of other, deleted marks included: no element is hashed.
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>& hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::operator=( const hash_table& other )
+    {
+        if ( this != &other )
+        {
+            this->_destroy_values();
+            this->_ctrl = other._ctrl;
+            this->_capacity = other._capacity;
+            this->_size = other._size;
+            this->_growth_left = other._growth_left;
+            this->_max_load_factor = other._max_load_factor;
+            this->_hash = other._hash;
+            this->_equal = other._equal;
+            this->_copy_values( other );
+        }
+        return ( *( this ) );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::iterator hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::begin()
+    {
+        return ( this->_make_iter( this->_first_full() ) );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::const_iterator hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::begin() const
+    {
+        return ( this->_make_iter( this->_first_full() ) );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::iterator hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::end()
+    {
+        return ( this->_make_iter( this->_capacity ) );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::const_iterator hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::end() const
+    {
+        return ( this->_make_iter( this->_capacity ) );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::size_type hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::size() const
+    {
+        return ( this->_size );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::size_type hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::max_size() const
+    {
+        return ( this->_slots.max_size() / 2 );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    ft::pair<typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::iterator,bool> hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::insert( const value_type& value )
+    {
+        size_type   hash = this->_hash_of( _key( value ) );
+        size_type   index = this->_find_index( _key( value ), hash );
+
+        if ( index != this->_capacity )
+            return ( ft::make_pair( this->_make_iter( index ), false ) );
+        return ( ft::make_pair( this->_insert_new( hash, value ), true ) );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    template <typename InputIterator>
+    void hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::insert( InputIterator first, InputIterator last )
+    {
+        for ( ; first != last; ++first )
+            this->insert( *first );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    template <typename ValueFactory>
+    ft::pair<typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::iterator,bool> hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::insert_key( const key_type& key, const ValueFactory& make_value )
+    {
+        size_type   hash = this->_hash_of( key );
+        size_type   index = this->_find_index( key, hash );
+
+        if ( index != this->_capacity )
+            return ( ft::make_pair( this->_make_iter( index ), false ) );
+        return ( ft::make_pair( this->_insert_new( hash, make_value() ), true ) );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    void hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::erase( const_iterator position )
+    {
+        this->_erase_at( position.base() - &( this->_slots[0] ) );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::size_type hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::erase( const key_type& key )
+    {
+        size_type   index = this->_find_index( key, this->_hash_of( key ) );
+
+        if ( index == this->_capacity )
+            return ( 0 );
+        this->_erase_at( index );
+        return ( 1 );
+    }
+
+    // Erasing never moves an element, so first stays valid while it walks the range.
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    void hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::erase( const_iterator first, const_iterator last )
+    {
+        if ( first == this->begin() && last == this->end() )
+            this->clear();
+        else
+        {
+            while ( first != last )
+                this->erase( first++ );
+        }
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    void hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::swap( hash_table& x )
+    {
+        this->_ctrl.swap( x._ctrl );
+        this->_slots.swap( x._slots );
+        ft::swap( this->_capacity, x._capacity );
+        ft::swap( this->_size, x._size );
+        ft::swap( this->_growth_left, x._growth_left );
+        ft::swap( this->_max_load_factor, x._max_load_factor );
+        ft::swap( this->_hash, x._hash );
+        ft::swap( this->_equal, x._equal );
+        ft::swap( this->_allocator, x._allocator );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    void hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::clear()
+    {
+        this->_destroy_values();
+        this->_size = 0;
+        if ( this->_capacity > 0 )
+            this->_reset_ctrl();
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::iterator hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::find( const key_type& key )
+    {
+        if ( this->_size == 0 )
+            return ( this->end() );
+        return ( this->_make_iter( this->_find_index( key, this->_hash_of( key ) ) ) );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::const_iterator hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::find( const key_type& key ) const
+    {
+        if ( this->_size == 0 )
+            return ( this->end() );
+        return ( this->_make_iter( this->_find_index( key, this->_hash_of( key ) ) ) );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::size_type hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::count( const key_type& key ) const
+    {
+        return ( ( this->find( key ) == this->end() ) ? 0 : 1 );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    ft::pair<typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::iterator,
+            typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::iterator>
+            hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::equal_range( const key_type& key )
+    {
+        iterator    first = this->find( key );
+        iterator    last = first;
+
+        if ( last != this->end() )
+            ++last;
+        return ( ft::make_pair( first, last ) );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    ft::pair<typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::const_iterator,
+            typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::const_iterator>
+            hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::equal_range( const key_type& key ) const
+    {
+        const_iterator  first = this->find( key );
+        const_iterator  last = first;
+
+        if ( last != this->end() )
+            ++last;
+        return ( ft::make_pair( first, last ) );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::size_type hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::bucket_count() const
+    {
+        return ( this->_capacity );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    float hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::load_factor() const
+    {
+        if ( this->_capacity == 0 )
+            return ( 0 );
+        return ( static_cast<float>( this->_size ) / static_cast<float>( this->_capacity ) );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    float hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::max_load_factor() const
+    {
+        return ( this->_max_load_factor );
+    }
+
+    // At least one slot stays empty, whatever ml is: it ends every probe sequence.
+    // The full and deleted slots stay what the old limit minus _growth_left counts.
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    void hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::max_load_factor( float ml )
+    {
+        size_type   capacity;
+        size_type   used;
+        size_type   limit;
+
+        if ( !( ml > 0 ) )
+            return ;
+        used = ( this->_capacity == 0 ) ? 0 : this->_growth_limit( this->_capacity ) - this->_growth_left;
+        this->_max_load_factor = ( ml < 1 ) ? ml : 1;
+        if ( this->_capacity == 0 )
+            return ;
+        capacity = this->_capacity_for( this->_size );
+        limit = this->_growth_limit( this->_capacity );
+        if ( capacity > this->_capacity )
+            this->_resize( capacity );
+        else
+            this->_growth_left = ( limit > used ) ? limit - used : 0;
+    }
+
+    // Rehashing to the same number of slots only drops the deleted marks.
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    void hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::rehash( size_type n )
+    {
+        size_type   capacity = this->_capacity_for( this->_size );
+
+        if ( n == 0 && this->_size == 0 )
+        {
+            ctrl_vector( this->_ctrl.get_allocator() ).swap( this->_ctrl );
+            slot_vector( this->_slots.get_allocator() ).swap( this->_slots );
+            this->_capacity = 0;
+            this->_growth_left = 0;
+            return ;
+        }
+        if ( n > capacity )
+            capacity = _normalize( n );
+        this->_resize( capacity );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    void hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::reserve( size_type n )
+    {
+        size_type   capacity = this->_capacity_for( n );
+
+        if ( capacity > this->_capacity )
+            this->_resize( capacity );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::allocator_type hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::get_allocator() const
+    {
+        return ( this->_allocator );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::hasher hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::hash_function() const
+    {
+        return ( this->_hash );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::key_equal hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::key_eq() const
+    {
+        return ( this->_equal );
+    }
+
+    /* private */
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    inline const typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::key_type& hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::_key( const value_type& value )
+    {
+        return ( KeyOfValue()( value ) );
+    }
+
+    // Fibonacci hashing: the product carries every bit of hash into the high
+    // half, the shift folds that back into the 7 bits of the control byte.
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    inline typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::size_type hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::_mix( size_type hash )
+    {
+        const size_type factor = ( sizeof( size_type ) > 4 ) ? ( ( static_cast<size_type>( 0x9E3779B9UL ) << 16 << 16 ) | 0x7F4A7C15UL ) : 0x9E3779B9UL;
+
+        hash *= factor;
+        return ( hash ^ ( hash >> ( sizeof( size_type ) * CHAR_BIT / 2 ) ) );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    inline typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::size_type hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::_h1( size_type hash )
+    {
+        return ( hash >> 7 );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    inline hash_ctrl hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::_h2( size_type hash )
+    {
+        return ( static_cast<hash_ctrl>( hash & 0x7F ) );
+    }
+
+    // The table always keeps an empty slot, so the probe sequence ends.
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::size_type hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::_find_non_full( const hash_ctrl* ctrl, size_type capacity, size_type hash )
+    {
+        size_type   position = _h1( hash ) & capacity;
+        size_type   step = 0;
+        unsigned int mask;
+
+        while ( ( mask = hash_group( ctrl + position ).match_empty_or_deleted() ) == 0 )
+        {
+            step += hash_group_width;
+            position = ( position + step ) & capacity;
+        }
+        return ( ( position + __builtin_ctz( mask ) ) & capacity );
+    }
+
+    // Also writes the copy behind the sentinel, if index is one of the first slots.
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    inline void hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::_set_ctrl( hash_ctrl* ctrl, size_type capacity, size_type index, hash_ctrl h2 )
+    {
+        ctrl[index] = h2;
+        ctrl[( ( index - ( hash_group_width - 1 ) ) & capacity ) + ( hash_group_width - 1 )] = h2;
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::size_type hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::_normalize( size_type n )
+    {
+        size_type   capacity = hash_group_width - 1;
+
+        while ( capacity < n )
+            capacity = capacity * 2 + 1;
+        return ( capacity );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    inline typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::size_type hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::_hash_of( const key_type& key ) const
+    {
+        return ( _mix( this->_hash( key ) ) );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::size_type hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::_growth_limit( size_type capacity ) const
+    {
+        size_type   limit = static_cast<size_type>( static_cast<double>( capacity ) * this->_max_load_factor );
+
+        return ( ( limit < capacity ) ? limit : capacity - 1 );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::size_type hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::_capacity_for( size_type n ) const
+    {
+        size_type   capacity = hash_group_width - 1;
+
+        if ( n == 0 )
+            n = 1; // a table without room for one element could never insert
+        while ( this->_growth_limit( capacity ) < n )
+            capacity = capacity * 2 + 1;
+        return ( capacity );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::size_type hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::_find_index( const key_type& key, size_type hash ) const
+    {
+        if ( this->_capacity == 0 )
+            return ( this->_capacity );
+
+        const hash_ctrl*    ctrl = &( this->_ctrl[0] );
+        const slot_type*    slots = &( this->_slots[0] );
+        const hash_ctrl     h2 = _h2( hash );
+        size_type           position = _h1( hash ) & this->_capacity;
+        size_type           step = 0;
+
+        for ( ;; )
+        {
+            hash_group  group( ctrl + position );
+
+            for ( unsigned int match = group.match( h2 ); match != 0; match &= match - 1 )
+            {
+                size_type   index = ( position + __builtin_ctz( match ) ) & this->_capacity;
+
+                if ( this->_equal( _key( *( slots[index].value() ) ), key ) )
+                    return ( index );
+            }
+            if ( group.match_empty() != 0 )
+                return ( this->_capacity );
+            step += hash_group_width;
+            position = ( position + step ) & this->_capacity;
+        }
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::size_type hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::_first_full() const
+    {
+        size_type   index = 0;
+
+        if ( this->_capacity == 0 )
+            return ( 0 );
+        while ( this->_ctrl[index] < hash_ctrl_sentinel )
+            index += hash_group( &( this->_ctrl[index] ) ).count_leading_empty_or_deleted();
+        return ( index );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    inline typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::iterator hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::_make_iter( size_type index )
+    {
+        if ( this->_capacity == 0 )
+            return ( iterator() );
+        return ( iterator( &( this->_ctrl[0] ) + index, &( this->_slots[0] ) + index ) );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    inline typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::const_iterator hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::_make_iter( size_type index ) const
+    {
+        if ( this->_capacity == 0 )
+            return ( const_iterator() );
+        return ( const_iterator( &( this->_ctrl[0] ) + index, &( this->_slots[0] ) + index ) );
+    }
+
+    /*
+    ** Filling an empty slot uses up _growth_left, reusing a deleted one does
+    ** not. Once it is used up, the table doubles, or rehashes in place when
+    ** at least a fifth of the slots in use are only deleted marks. It never
+    ** rehashes in place without gaining room for the new element.
+    */
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::size_type hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::_prepare_insert( size_type hash )
+    {
+        size_type   index;
+
+        if ( this->_capacity == 0 )
+            this->_resize( this->_capacity_for( 1 ) );
+        index = _find_non_full( &( this->_ctrl[0] ), this->_capacity, hash );
+        if ( this->_growth_left == 0 && this->_ctrl[index] != hash_ctrl_deleted )
+        {
+            size_type   used = this->_growth_limit( this->_capacity );
+            size_type   grown = this->_capacity_for( this->_size + 1 );
+
+            if ( used > this->_size && this->_size * 5 <= used * 4 )
+                this->_resize( this->_capacity );
+            else
+                this->_resize( ( grown > this->_capacity * 2 + 1 ) ? grown : this->_capacity * 2 + 1 );
+            index = _find_non_full( &( this->_ctrl[0] ), this->_capacity, hash );
+        }
+        if ( this->_ctrl[index] == hash_ctrl_empty )
+            --( this->_growth_left );
+        return ( index );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    typename hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::iterator hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::_insert_new( size_type hash, const value_type& value )
+    {
+        size_type   index = this->_prepare_insert( hash );
+
+        this->_allocator.construct( this->_slots[index].value(), value );
+        _set_ctrl( &( this->_ctrl[0] ), this->_capacity, index, _h2( hash ) );
+        ++( this->_size );
+        return ( this->_make_iter( index ) );
+    }
+
+    /*
+    ** A probe sequence passes a slot only when its group had no empty slot.
+    ** If every group of hash_group_width slots around index has one, no
+    ** search can have walked on through index, and it may become empty again.
+    */
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    void hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::_erase_at( size_type index )
+    {
+        hash_ctrl*      ctrl = &( this->_ctrl[0] );
+        unsigned int    empty_before;
+        unsigned int    empty_after;
+        bool            was_never_full;
+
+        this->_allocator.destroy( this->_slots[index].value() );
+        --( this->_size );
+        empty_before = hash_group( ctrl + ( ( index - hash_group_width ) & this->_capacity ) ).match_empty();
+        empty_after = hash_group( ctrl + index ).match_empty();
+        was_never_full = empty_before != 0 && empty_after != 0
+            && static_cast<size_type>( __builtin_ctz( empty_after ) + __builtin_clz( empty_before )
+                                        - ( sizeof( unsigned int ) * CHAR_BIT - hash_group_width ) ) < hash_group_width;
+        _set_ctrl( ctrl, this->_capacity, index, was_never_full ? hash_ctrl_empty : hash_ctrl_deleted );
+        if ( was_never_full )
+            ++( this->_growth_left );
+    }
+
+    // Moves every element into fresh vectors of capacity slots.
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    void hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::_resize( size_type capacity )
+    {
+        ctrl_vector     ctrl( capacity + hash_group_width, hash_ctrl_empty, this->_ctrl.get_allocator() );
+        slot_vector     slots( this->_slots.get_allocator() );
+
+        ctrl[capacity] = hash_ctrl_sentinel;
+        slots.resize_default_init( capacity );
+        for ( size_type i = 0; i < this->_capacity; ++i )
+        {
+            if ( this->_ctrl[i] >= 0 )
+            {
+                size_type   hash = this->_hash_of( _key( *( this->_slots[i].value() ) ) );
+                size_type   index = _find_non_full( &( ctrl[0] ), capacity, hash );
+
+                _set_ctrl( &( ctrl[0] ), capacity, index, _h2( hash ) );
+                this->_relocate( &( slots[index] ), &( this->_slots[i] ), _relocatable_values() );
+            }
+        }
+        this->_ctrl.swap( ctrl );
+        this->_slots.swap( slots );
+        this->_capacity = capacity;
+        this->_growth_left = this->_growth_limit( capacity ) - this->_size;
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    void hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::_reset_ctrl()
+    {
+        std::memset( &( this->_ctrl[0] ), hash_ctrl_empty, this->_ctrl.size() );
+        this->_ctrl[this->_capacity] = hash_ctrl_sentinel;
+        this->_growth_left = this->_growth_limit( this->_capacity );
+    }
+
+    // Copies the elements of src into the same slots; _ctrl already is a copy of src's.
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    void hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::_copy_values( const hash_table& src )
+    {
+        this->_slots.clear();
+        this->_slots.resize_default_init( src._capacity );
+        for ( size_type i = 0; i < src._capacity; ++i )
+        {
+            if ( src._ctrl[i] >= 0 )
+                this->_allocator.construct( this->_slots[i].value(), *( src._slots[i].value() ) );
+        }
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    void hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::_destroy_values()
+    {
+        for ( size_type i = 0; i < this->_capacity; ++i )
+        {
+            if ( this->_ctrl[i] >= 0 )
+                this->_allocator.destroy( this->_slots[i].value() );
+        }
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    inline void hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::_relocate( slot_type* dest, slot_type* src, ft::true_type )
+    {
+        std::memcpy( dest, src, sizeof( slot_type ) );
+    }
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator, typename KeyOfValue>
+    inline void hash_table<T, Hash, KeyEqual, Allocator, KeyOfValue>::_relocate( slot_type* dest, slot_type* src, ft::false_type )
+    {
+        this->_allocator.construct( dest->value(), *( src->value() ) );
+        this->_allocator.destroy( src->value() );
+    }
+
+} // namespace ft
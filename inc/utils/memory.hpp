@@ -0,0 +1,428 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <new>
+
+#ifndef nullptr
+#define nullptr NULL
+#endif
+
+namespace ft
+{
+
+    /* ---------------------------- pool_allocator -------------------------- */
+
+    /*
+    ** Not part of any C++ standard.
+    ** A node allocator for the tree based containers, e.g.
+    **     ft::map<int, int, ft::less<int>, ft::pool_allocator<ft::pair<const int, int> > >
+    ** Single objects are handed out from contiguous chunks of ChunkSize objects,
+    ** freed objects are recycled through a free list. The chunks themselves are
+    ** only given back as a whole, either by release() (once no object is in use)
+    ** or when the last allocator sharing the pool is destroyed, so tearing down
+    ** a container costs O(chunks) calls to operator delete instead of O(n).
+    ** Requests for more than one object are passed on to operator new.
+    **
+    ** Copies and rebound copies of an allocator (e.g. the node allocator of a
+    ** map) share its pool family and compare equal, for as long as they live.
+    ** The family keeps one pool per object size, created on first use.
+    ** reserve() works on the pool of the allocator's own value_type, release(),
+    ** purge() and in_use() on the whole family. Nothing is thread safe.
+    */
+
+    union pool_chunk_header // the union keeps the slots behind it suitably aligned
+    {
+        pool_chunk_header*  next;
+        long double         _align_ld;
+        long                _align_l;
+        void*               _align_p;
+    };
+
+    struct pool_free_slot
+    {
+        pool_free_slot*     next;
+    };
+
+    struct pool_state
+    {
+        pool_state*         next; // the pool for another slot size in the same family
+        std::size_t         slot_size;
+        pool_chunk_header*  chunks; // singly linked list of all chunks
+        pool_free_slot*     free_list; // recycled slots
+        char*               bump; // next never used slot of the newest chunk
+        char*               bump_end;
+        std::size_t         in_use; // number of slots handed out
+    };
+
+    struct pool_family
+    {
+        pool_state*         pools;
+        std::size_t         owners; // number of allocators sharing this family
+    };
+
+    template <typename T, std::size_t ChunkSize = 256>
+    class pool_allocator
+    {
+
+    public:
+        typedef T                   value_type;
+        typedef T*                  pointer;
+        typedef const T*            const_pointer;
+        typedef T&                  reference;
+        typedef const T&            const_reference;
+        typedef std::size_t         size_type;
+        typedef std::ptrdiff_t      difference_type;
+
+        template <typename U>
+        struct rebind
+        {
+            typedef pool_allocator<U, ChunkSize> other;
+        };
+
+    private:
+        static const size_type  _slot_size = ( sizeof( T ) < sizeof( pool_free_slot ) ) ? sizeof( pool_free_slot ) : sizeof( T );
+
+        pool_family*    _family; // never nullptr
+        pool_state*     _pool; // the pool for _slot_size, nullptr until first used
+
+    public:
+        pool_allocator();
+        pool_allocator( const pool_allocator& other ) throw();
+        template <typename U>
+            pool_allocator( const pool_allocator<U, ChunkSize>& other ) throw();
+        ~pool_allocator();
+
+        pool_allocator& operator=( const pool_allocator& src );
+
+        pointer address( reference x ) const;
+        const_pointer address( const_reference x ) const;
+        pointer allocate( size_type n, const void* hint = 0 );
+        void deallocate( pointer p, size_type n );
+        size_type max_size() const throw();
+        void construct( pointer p, const value_type& val );
+        void destroy( pointer p );
+
+        void reserve( size_type n ); // extension: the next n single allocations will not call operator new
+        bool release(); // extension: gives all chunks back, if no object is in use
+        void purge(); // extension: gives all chunks back, every object still in use becomes invalid
+        size_type in_use() const; // extension: number of objects currently handed out
+
+        template <typename U, std::size_t N>
+            friend class pool_allocator;
+        template <typename U1, typename U2, std::size_t N>
+            friend bool operator==( const pool_allocator<U1, N>& lhs, const pool_allocator<U2, N>& rhs );
+
+    private:
+        void _attach( pool_family* family );
+        void _detach();
+        pool_state* _state(); // finds or creates the pool for _slot_size
+        static void _free_chunks( pool_state* pool );
+        void _add_chunk( size_type slots );
+
+    }; // pool_allocator
+
+    /* pool_allocator member functions */
+    /* public */
+
+    template <typename T, std::size_t ChunkSize>
+    pool_allocator<T, ChunkSize>::pool_allocator() : _family( nullptr ), _pool( nullptr )
+    {
+        this->_attach( new pool_family() );
+    }
+
+    template <typename T, std::size_t ChunkSize>
+    pool_allocator<T, ChunkSize>::pool_allocator( const pool_allocator& other ) throw() : _family( nullptr ), _pool( other._pool )
+    {
+        this->_attach( other._family );
+    }
+
+    template <typename T, std::size_t ChunkSize>
+    template <typename U>
+    pool_allocator<T, ChunkSize>::pool_allocator( const pool_allocator<U, ChunkSize>& other ) throw() : _family( nullptr ), _pool( nullptr )
+    {
+        this->_attach( other._family );
+    }
+
+    template <typename T, std::size_t ChunkSize>
+    pool_allocator<T, ChunkSize>::~pool_allocator()
+    {
+        this->_detach();
+    }
+
+    template <typename T, std::size_t ChunkSize>
+    pool_allocator<T, ChunkSize>& pool_allocator<T, ChunkSize>::operator=( const pool_allocator& src )
+    {
+        if ( this->_family != src._family )
+        {
+            this->_detach();
+            this->_attach( src._family );
+            this->_pool = src._pool;
+        }
+        return ( *( this ) );
+    }
+
+    template <typename T, std::size_t ChunkSize>
+    typename pool_allocator<T, ChunkSize>::pointer pool_allocator<T, ChunkSize>::address( reference x ) const
+    {
+        return ( &x );
+    }
+
+    template <typename T, std::size_t ChunkSize>
+    typename pool_allocator<T, ChunkSize>::const_pointer pool_allocator<T, ChunkSize>::address( const_reference x ) const
+    {
+        return ( &x );
+    }
+
+    template <typename T, std::size_t ChunkSize>
+    typename pool_allocator<T, ChunkSize>::pointer pool_allocator<T, ChunkSize>::allocate( size_type n, __attribute__( ( unused ) ) const void* hint )
+    {
+        pool_state* pool;
+        void*       slot;
+
+        if ( n != 1 )
+        {
+            if ( n > this->max_size() )
+                throw std::bad_alloc();
+            return ( static_cast<pointer>( ::operator new( n * sizeof( T ) ) ) );
+        }
+        pool = this->_state();
+        if ( pool->free_list != nullptr )
+        {
+            slot = pool->free_list;
+            pool->free_list = pool->free_list->next;
+        }
+        else
+        {
+            if ( pool->bump == pool->bump_end )
+                this->_add_chunk( ChunkSize );
+            slot = pool->bump;
+            pool->bump += _slot_size;
+        }
+        ++( pool->in_use );
+        return ( static_cast<pointer>( slot ) );
+    }
+
+    // p may come from any allocator equal to this one: they share the family,
+    // and the slot was handed out by its pool for the same object size.
+    template <typename T, std::size_t ChunkSize>
+    void pool_allocator<T, ChunkSize>::deallocate( pointer p, size_type n )
+    {
+        if ( p == nullptr )
+            return ;
+        if ( n != 1 )
+        {
+            ::operator delete( p );
+            return ;
+        }
+
+        pool_state*     pool = this->_state();
+        pool_free_slot* slot = reinterpret_cast<pool_free_slot*>( p );
+
+        slot->next = pool->free_list;
+        pool->free_list = slot;
+        --( pool->in_use );
+    }
+
+    template <typename T, std::size_t ChunkSize>
+    typename pool_allocator<T, ChunkSize>::size_type pool_allocator<T, ChunkSize>::max_size() const throw()
+    {
+        return ( std::numeric_limits<size_type>::max() / sizeof( T ) );
+    }
+
+    template <typename T, std::size_t ChunkSize>
+    void pool_allocator<T, ChunkSize>::construct( pointer p, const value_type& val )
+    {
+        new ( static_cast<void*>( p ) ) T( val );
+    }
+
+    template <typename T, std::size_t ChunkSize>
+    void pool_allocator<T, ChunkSize>::destroy( pointer p )
+    {
+        p->~T();
+    }
+
+    // Makes room for n slots in one contiguous chunk. The unused rest of the
+    // current chunk is moved onto the free list, so nothing is lost.
+    template <typename T, std::size_t ChunkSize>
+    void pool_allocator<T, ChunkSize>::reserve( size_type n )
+    {
+        pool_state* pool = this->_state();
+
+        if ( static_cast<size_type>( pool->bump_end - pool->bump ) >= n * _slot_size )
+            return ;
+        for ( ; pool->bump != pool->bump_end; pool->bump += _slot_size )
+        {
+            pool_free_slot* slot = reinterpret_cast<pool_free_slot*>( pool->bump );
+
+            slot->next = pool->free_list;
+            pool->free_list = slot;
+        }
+        this->_add_chunk( ( n > ChunkSize ) ? n : ChunkSize );
+    }
+
+    // Returns every chunk of the family to the system in O(chunks), if none of
+    // the objects handed out by any allocator sharing it is still in use.
+    template <typename T, std::size_t ChunkSize>
+    bool pool_allocator<T, ChunkSize>::release()
+    {
+        if ( this->in_use() != 0 )
+            return ( false );
+        this->purge();
+        return ( true );
+    }
+
+    // Returns every chunk of the family to the system in O(chunks), without
+    // deallocate() for the objects still in use. Their destructors have to run
+    // before, unless they are trivial, and none of them may be used afterwards.
+    template <typename T, std::size_t ChunkSize>
+    void pool_allocator<T, ChunkSize>::purge()
+    {
+        for ( pool_state* pool = this->_family->pools; pool != nullptr; pool = pool->next )
+        {
+            _free_chunks( pool );
+            pool->in_use = 0;
+        }
+    }
+
+    template <typename T, std::size_t ChunkSize>
+    typename pool_allocator<T, ChunkSize>::size_type pool_allocator<T, ChunkSize>::in_use() const
+    {
+        size_type   n = 0;
+
+        for ( const pool_state* pool = this->_family->pools; pool != nullptr; pool = pool->next )
+            n += pool->in_use;
+        return ( n );
+    }
+
+    /* private */
+
+    template <typename T, std::size_t ChunkSize>
+    void pool_allocator<T, ChunkSize>::_attach( pool_family* family )
+    {
+        this->_family = family;
+        ++( this->_family->owners );
+    }
+
+    template <typename T, std::size_t ChunkSize>
+    void pool_allocator<T, ChunkSize>::_detach()
+    {
+        if ( --( this->_family->owners ) == 0 )
+        {
+            while ( this->_family->pools != nullptr )
+            {
+                pool_state* next = this->_family->pools->next;
+
+                _free_chunks( this->_family->pools );
+                delete this->_family->pools;
+                this->_family->pools = next;
+            }
+            delete this->_family;
+        }
+        this->_family = nullptr;
+        this->_pool = nullptr;
+    }
+
+    // A family rarely holds more than two or three pools (values and nodes),
+    // so the pool is looked up once and kept in _pool.
+    template <typename T, std::size_t ChunkSize>
+    pool_state* pool_allocator<T, ChunkSize>::_state()
+    {
+        if ( this->_pool != nullptr )
+            return ( this->_pool );
+        for ( pool_state* pool = this->_family->pools; pool != nullptr; pool = pool->next )
+        {
+            if ( pool->slot_size == _slot_size )
+                return ( this->_pool = pool );
+        }
+        this->_pool = new pool_state();
+        this->_pool->slot_size = _slot_size;
+        this->_pool->next = this->_family->pools;
+        this->_family->pools = this->_pool;
+        return ( this->_pool );
+    }
+
+    template <typename T, std::size_t ChunkSize>
+    void pool_allocator<T, ChunkSize>::_free_chunks( pool_state* pool )
+    {
+        while ( pool->chunks != nullptr )
+        {
+            pool_chunk_header*  next = pool->chunks->next;
+
+            ::operator delete( pool->chunks );
+            pool->chunks = next;
+        }
+        pool->free_list = nullptr;
+        pool->bump = nullptr;
+        pool->bump_end = nullptr;
+    }
+
+    template <typename T, std::size_t ChunkSize>
+    void pool_allocator<T, ChunkSize>::_add_chunk( size_type slots )
+    {
+        pool_chunk_header*  chunk = static_cast<pool_chunk_header*>( ::operator new( sizeof( pool_chunk_header ) + slots * _slot_size ) );
+
+        chunk->next = this->_pool->chunks;
+        this->_pool->chunks = chunk;
+        this->_pool->bump = reinterpret_cast<char*>( chunk + 1 );
+        this->_pool->bump_end = this->_pool->bump + slots * _slot_size;
+    }
+
+    /* pool_allocator non-member functions */
+
+    template <typename U1, typename U2, std::size_t N>
+    bool operator==( const pool_allocator<U1, N>& lhs, const pool_allocator<U2, N>& rhs )
+    {
+        return ( lhs._family == rhs._family );
+    }
+
+    template <typename U1, typename U2, std::size_t N>
+    bool operator!=( const pool_allocator<U1, N>& lhs, const pool_allocator<U2, N>& rhs )
+    {
+        return ( !( lhs == rhs ) );
+    }
+
+
+    /* --------------------------- allocator hooks -------------------------- */
+
+    /*
+    ** Let the containers pass hints to allocators which can make use of them,
+    ** without requiring anything beyond the standard allocator interface.
+    ** allocator_reserve( alloc, n ): n single objects are about to be allocated.
+    ** allocator_can_purge( alloc, n ): true, if the n objects about to be freed
+    **     are all that alloc (and every allocator sharing its memory) has in use.
+    ** allocator_purge( alloc ): frees all objects of alloc at once, instead of
+    **     one deallocate() per object. Only after allocator_can_purge() said so.
+    */
+
+    template <typename Alloc>
+    void allocator_reserve( __attribute__( ( unused ) ) Alloc& alloc, __attribute__( ( unused ) ) std::size_t n ) {}
+
+    template <typename T, std::size_t ChunkSize>
+    void allocator_reserve( pool_allocator<T, ChunkSize>& alloc, std::size_t n )
+    {
+        alloc.reserve( n );
+    }
+
+    template <typename Alloc>
+    bool allocator_can_purge( __attribute__( ( unused ) ) const Alloc& alloc, __attribute__( ( unused ) ) std::size_t n )
+    {
+        return ( false );
+    }
+
+    template <typename T, std::size_t ChunkSize>
+    bool allocator_can_purge( const pool_allocator<T, ChunkSize>& alloc, std::size_t n )
+    {
+        return ( alloc.in_use() == n );
+    }
+
+    template <typename Alloc>
+    void allocator_purge( __attribute__( ( unused ) ) Alloc& alloc ) {}
+
+    template <typename T, std::size_t ChunkSize>
+    void allocator_purge( pool_allocator<T, ChunkSize>& alloc )
+    {
+        alloc.purge();
+    }
+
+} // namespace ft
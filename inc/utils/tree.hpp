@@ -1,10 +1,13 @@
 #pragma once
 
 // #include <iostream> // for debug_print() only! // comment in for usage of debug_print()
+#include <cstddef>
 #include <memory>
 
 #include "./iterator.hpp"
 #include "./functional.hpp"
+#include "./memory.hpp"
+#include "./type_traits.hpp"
 #include "./utility.hpp"
 
 #ifndef nullptr
@@ -20,6 +23,18 @@ namespace ft
     ** A general node template to be used in my implementations of 
     ** Binary Search Tree (BST) and Red Black Tree (RBT)
     ** Colour is unused in BST and set to default 'BLACK'
+    **
+    ** Parent and colour are only accessed through get_parent() / set_parent()
+    ** and get_colour() / set_colour(). Where it makes the node smaller
+    ** (see tree_node_packs_colour), the colour is kept in the lowest bit
+    ** of the parent pointer, which is always zero for an aligned node.
+    **
+    ** The links live in tree_node_base, which holds no value: the sentinel
+    ** nodes of a tree are plain tree_node_base objects. An all zero
+    ** tree_node_base is a black node without any links.
+    ** The links point to tree_node_base (as libstdc++ links _Rb_tree_node_base),
+    ** so a sentinel is linked like any other node. Only a node, which really
+    ** is a tree_node, is ever cast down to reach its value or count.
     */
 
     enum node_state
@@ -28,23 +43,168 @@ namespace ft
         BLACK = 0
     };
 
+    template <typename Node, bool PackColour>
+    struct tree_node_base
+    {
+        typedef tree_node_base*         base_ptr;
+        typedef const tree_node_base*   const_base_ptr;
+
+        base_ptr            _parent;
+        base_ptr            _left;
+        base_ptr            _right;
+        node_state          _colour;
+
+        base_ptr get_parent() const;
+        void set_parent( base_ptr parent );
+        node_state get_colour() const;
+        void set_colour( node_state colour );
+
+    }; // tree_node_base
+
+    /* tree_node_base member functions */
+
+    template <typename Node, bool PackColour>
+    inline typename tree_node_base<Node, PackColour>::base_ptr tree_node_base<Node, PackColour>::get_parent() const
+    {
+        return ( this->_parent );
+    }
+
+    template <typename Node, bool PackColour>
+    inline void tree_node_base<Node, PackColour>::set_parent( base_ptr parent )
+    {
+        this->_parent = parent;
+    }
+
+    template <typename Node, bool PackColour>
+    inline node_state tree_node_base<Node, PackColour>::get_colour() const
+    {
+        return ( this->_colour );
+    }
+
+    template <typename Node, bool PackColour>
+    inline void tree_node_base<Node, PackColour>::set_colour( node_state colour )
+    {
+        this->_colour = colour;
+    }
+
+    /*
+    ** tree_node_base with the colour packed into the parent pointer
+    */
+
+    template <typename Node>
+    struct tree_node_base<Node, true>
+    {
+        typedef tree_node_base*         base_ptr;
+        typedef const tree_node_base*   const_base_ptr;
+
+        std::size_t         _parent_colour; // parent pointer | colour bit
+        base_ptr            _left;
+        base_ptr            _right;
+
+        base_ptr get_parent() const;
+        void set_parent( base_ptr parent );
+        node_state get_colour() const;
+        void set_colour( node_state colour );
+
+    }; // tree_node_base<Node, true>
+
+    /* tree_node_base<Node, true> member functions */
+
+    template <typename Node>
+    inline typename tree_node_base<Node, true>::base_ptr tree_node_base<Node, true>::get_parent() const
+    {
+        return ( reinterpret_cast<base_ptr>( this->_parent_colour & ~static_cast<std::size_t>( 1 ) ) );
+    }
+
+    template <typename Node>
+    inline void tree_node_base<Node, true>::set_parent( base_ptr parent )
+    {
+        this->_parent_colour = reinterpret_cast<std::size_t>( parent ) | ( this->_parent_colour & 1 );
+    }
+
+    template <typename Node>
+    inline node_state tree_node_base<Node, true>::get_colour() const
+    {
+        return ( static_cast<node_state>( this->_parent_colour & 1 ) );
+    }
+
+    template <typename Node>
+    inline void tree_node_base<Node, true>::set_colour( node_state colour )
+    {
+        this->_parent_colour = ( this->_parent_colour & ~static_cast<std::size_t>( 1 ) ) | static_cast<std::size_t>( colour );
+    }
+
+    /*
+    ** The size of the subtree rooted at a node, only stored in the nodes of a
+    ** ranked tree (see ft::ranked). Otherwise the struct is empty and takes no
+    ** space in tree_node, and set_count() does nothing.
+    */
+
+    template <bool Ranked>
+    struct tree_node_count
+    {
+        std::size_t get_count() const;
+        void set_count( std::size_t count );
+
+    }; // tree_node_count
+
+    template <>
+    struct tree_node_count<true>
+    {
+        std::size_t         _count; // number of nodes in this subtree
+
+        std::size_t get_count() const;
+        void set_count( std::size_t count );
+
+    }; // tree_node_count<true>
+
+    /* tree_node_count member functions */
+
+    template <bool Ranked>
+    inline std::size_t tree_node_count<Ranked>::get_count() const
+    {
+        return ( 0 );
+    }
+
+    template <bool Ranked>
+    inline void tree_node_count<Ranked>::set_count( __attribute__( ( unused ) ) std::size_t count ) {}
+
+    inline std::size_t tree_node_count<true>::get_count() const
+    {
+        return ( this->_count );
+    }
+
+    inline void tree_node_count<true>::set_count( std::size_t count )
+    {
+        this->_count = count;
+    }
+
+    template <typename T, bool PackColour, bool Ranked>
+    class tree_node;
+
     template <typename T>
-    class tree_node
+    struct tree_node_packs_colour : public integral_constant<bool, ( __alignof__( void* ) >= 2
+                                                                    && sizeof( std::size_t ) == sizeof( void* )
+                                                                    && sizeof( tree_node<T, false, false> ) > sizeof( tree_node<T, true, false> ) )> {};
+
+    template <typename T, bool PackColour = tree_node_packs_colour<T>::value, bool Ranked = false>
+    class tree_node : public tree_node_base<tree_node<T, PackColour, Ranked>, PackColour>, public tree_node_count<Ranked>
     {
 
     public:
-        typedef T                               value_type;
-        typedef tree_node<value_type>*          node_ptr;
-        typedef const tree_node<value_type>*    const_node_ptr;
-        typedef tree_node<value_type>&          node_ref;
-        typedef const tree_node<value_type>&    const_node_ref;
+        typedef T                                                                   value_type;
+        typedef tree_node_base<tree_node<T, PackColour, Ranked>, PackColour>        base_type;
+        typedef typename base_type::base_ptr                                        base_ptr;
+        typedef typename base_type::const_base_ptr                                  const_base_ptr;
+        typedef tree_node<value_type, PackColour, Ranked>*                          node_ptr;
+        typedef const tree_node<value_type, PackColour, Ranked>*                    const_node_ptr;
+        typedef tree_node<value_type, PackColour, Ranked>&                          node_ref;
+        typedef const tree_node<value_type, PackColour, Ranked>&                    const_node_ref;
+
+        static const bool                                                           ranked = Ranked;
 
     public:
         T                   _data;
-        node_state          _colour;
-        node_ptr            _parent;
-        node_ptr            _left;
-        node_ptr            _right;
 
     public:
         tree_node();
@@ -53,47 +213,173 @@ namespace ft
         ~tree_node();
 
         tree_node& operator=( const tree_node& src );
-    
-    private:
-        void change_colour();
 
     }; // tree_node
 
     /* tree_node member functions */
     /* public */
 
-    template <typename T>
-    tree_node<T>::tree_node() : _data(), _colour( BLACK ), _parent( nullptr ), _left( nullptr ), _right( nullptr ) {}
+    template <typename T, bool PackColour, bool Ranked>
+    tree_node<T, PackColour, Ranked>::tree_node() : base_type(), tree_node_count<Ranked>(), _data() {}
 
-    template <typename T>
-    tree_node<T>::tree_node( const value_type& value ) : _data( value ), _colour( BLACK ), _parent( nullptr ), _left( nullptr ), _right( nullptr ) {}
+    template <typename T, bool PackColour, bool Ranked>
+    tree_node<T, PackColour, Ranked>::tree_node( const value_type& value ) : base_type(), tree_node_count<Ranked>(), _data( value ) {}
 
-    template <typename T>
-    tree_node<T>::tree_node( const tree_node& other) : _data( other._data ), _colour( other._colour ), _parent( other._parent ), _left( other._left ), _right( other._right ) {}
+    template <typename T, bool PackColour, bool Ranked>
+    tree_node<T, PackColour, Ranked>::tree_node( const tree_node& other) : base_type( other ), tree_node_count<Ranked>( other ), _data( other._data ) {}
 
-    template <typename T>
-    tree_node<T>::~tree_node() {}
+    template <typename T, bool PackColour, bool Ranked>
+    tree_node<T, PackColour, Ranked>::~tree_node() {}
 
-    template <typename T>
-    tree_node<T>& tree_node<T>::operator=( const tree_node& src )
+    template <typename T, bool PackColour, bool Ranked>
+    tree_node<T, PackColour, Ranked>& tree_node<T, PackColour, Ranked>::operator=( const tree_node& src )
     {
         if ( this != &src )
         {
-            this->_colour = src._colour;
+            base_type::operator=( src );
+            tree_node_count<Ranked>::operator=( src );
             this->_data = src._data;
-            this->_parent = src._parent;
-            this->_left = src._left;
-            this->_right = src._right;
         }
         return ( *( this ) );
     }
 
-    /* private */
 
-    template <typename T>
-    void tree_node<T>::change_colour()
+    /* ----------------------------- tree links ----------------------------- */
+
+    /*
+    ** The red black tree algorithms below only reach the nodes through a link
+    ** policy, so red_black_tree (nodes linked by pointers) and compact_tree
+    ** (nodes linked by 32 bit indices into one array, see compact_tree.hpp)
+    ** share them, and their iterators. A policy names a node by a handle:
+    **     handle, value_type      the node handle and the stored value
+    **     ranked                  true, if count() holds the size of the subtree
+    **     null()                  the black leaf every missing child links to
+    **     is_end( node )          the end node: its left link is the root,
+    **                             its right link the right-most node
+    **     left(), right(), parent(), colour(), count() and their setters,
+    **     value()
+    **     prefetch( node )        asks the cache to load a node (a hint only)
+    ** The algorithms never write to null(), so it may be shared by all trees.
+    ** They only call value() and count() for the nodes holding a value, so
+    ** tree_links casts down to Node there, but never null() or the end node.
+    ** tree_links has no state, so it takes no space in an iterator.
+    */
+
+    template <typename Node>
+    struct tree_links
+    {
+        typedef typename Node::base_ptr     handle;
+        typedef typename Node::value_type   value_type;
+
+        static const bool                   ranked = Node::ranked;
+
+        static typename Node::base_type     _nil; // shared by all trees of this node type: zero initialized (black, no links) and never written to
+
+        static handle null();
+        static bool is_end( handle node );
+        static handle left( handle node );
+        static void set_left( handle node, handle child );
+        static handle right( handle node );
+        static void set_right( handle node, handle child );
+        static handle parent( handle node );
+        static void set_parent( handle node, handle parent );
+        static node_state colour( handle node );
+        static void set_colour( handle node, node_state colour );
+        static std::size_t count( handle node );
+        static void set_count( handle node, std::size_t count );
+        static value_type& value( handle node );
+        static void prefetch( handle node );
+
+    }; // tree_links
+
+    template <typename Node>
+    typename Node::base_type tree_links<Node>::_nil;
+
+    /* tree_links member functions */
+
+    template <typename Node>
+    inline typename tree_links<Node>::handle tree_links<Node>::null()
+    {
+        return ( &_nil );
+    }
+
+    // The end node is the only node without a parent.
+    template <typename Node>
+    inline bool tree_links<Node>::is_end( handle node )
+    {
+        return ( node->get_parent() == nullptr );
+    }
+
+    template <typename Node>
+    inline typename tree_links<Node>::handle tree_links<Node>::left( handle node )
+    {
+        return ( node->_left );
+    }
+
+    template <typename Node>
+    inline void tree_links<Node>::set_left( handle node, handle child )
+    {
+        node->_left = child;
+    }
+
+    template <typename Node>
+    inline typename tree_links<Node>::handle tree_links<Node>::right( handle node )
+    {
+        return ( node->_right );
+    }
+
+    template <typename Node>
+    inline void tree_links<Node>::set_right( handle node, handle child )
+    {
+        node->_right = child;
+    }
+
+    template <typename Node>
+    inline typename tree_links<Node>::handle tree_links<Node>::parent( handle node )
+    {
+        return ( node->get_parent() );
+    }
+
+    template <typename Node>
+    inline void tree_links<Node>::set_parent( handle node, handle parent )
+    {
+        node->set_parent( parent );
+    }
+
+    template <typename Node>
+    inline node_state tree_links<Node>::colour( handle node )
+    {
+        return ( node->get_colour() );
+    }
+
+    template <typename Node>
+    inline void tree_links<Node>::set_colour( handle node, node_state colour )
+    {
+        node->set_colour( colour );
+    }
+
+    template <typename Node>
+    inline std::size_t tree_links<Node>::count( handle node )
     {
-        this->_colour = ( this->_colour == RED ) ? BLACK : RED;
+        return ( static_cast<Node*>( node )->get_count() );
+    }
+
+    template <typename Node>
+    inline void tree_links<Node>::set_count( handle node, std::size_t count )
+    {
+        static_cast<Node*>( node )->set_count( count );
+    }
+
+    template <typename Node>
+    inline typename tree_links<Node>::value_type& tree_links<Node>::value( handle node )
+    {
+        return ( static_cast<Node*>( node )->_data );
+    }
+
+    template <typename Node>
+    inline void tree_links<Node>::prefetch( handle node )
+    {
+        tree_prefetch( node );
     }
 
 
@@ -101,62 +387,594 @@ namespace ft
 
     /*
     ** A collection of useful algorithms and utility functions
-    ** for the implemented binary search tree or red black tree
+    ** for the implemented binary search tree or red black tree,
+    ** for any link policy (see tree_links)
     */
 
-    template <typename T>
-    typename tree_node<T>::node_ptr tree_min( typename tree_node<T>::node_ptr nodeptr )
+    template <typename Links>
+    typename Links::handle tree_min( const Links& links, typename Links::handle node )
     {
-        while ( nodeptr != nullptr && nodeptr->_left->_left != nullptr ) // equals this->_null
-            nodeptr = nodeptr->_left;
-        return ( nodeptr );
+        while ( node != links.null() && links.left( node ) != links.null() )
+            node = links.left( node );
+        return ( node );
     }
 
-    template <typename T>
-    typename tree_node<T>::const_node_ptr tree_min( typename tree_node<T>::const_node_ptr nodeptr )
+    template <typename Links>
+    typename Links::handle tree_max( const Links& links, typename Links::handle node )
+    {
+        while ( node != links.null() && links.right( node ) != links.null() )
+            node = links.right( node );
+        return ( node );
+    }
+
+    template <typename Links>
+    bool tree_is_left_child( const Links& links, typename Links::handle node )
+    {
+        return ( node == links.left( links.parent( node ) ) );
+    }
+
+    // In-order successor. The root is the left child of the end node, so climbing up stops there at the latest.
+    template <typename Links>
+    typename Links::handle tree_next( const Links& links, typename Links::handle node )
+    {
+        if ( links.right( node ) != links.null() )
+            return ( tree_min( links, links.right( node ) ) );
+        while ( !( tree_is_left_child( links, node ) ) )
+            node = links.parent( node );
+        return ( links.parent( node ) );
+    }
+
+    // In-order predecessor, the right-most node for the end node.
+    template <typename Links>
+    typename Links::handle tree_prev( const Links& links, typename Links::handle node )
+    {
+        if ( links.is_end( node ) )
+            return ( links.right( node ) );
+        if ( links.left( node ) != links.null() )
+            return ( tree_max( links, links.left( node ) ) );
+        while ( tree_is_left_child( links, node ) )
+            node = links.parent( node );
+        return ( links.parent( node ) );
+    }
+
+    // Size of the subtree rooted at node in a ranked tree, 0 for the null node
+    template <typename Links>
+    std::size_t tree_count( const Links& links, typename Links::handle node )
+    {
+        if ( node == links.null() )
+            return ( 0 );
+        return ( links.count( node ) );
+    }
+
+    // In-order position of node in a ranked tree, the size of the tree for the end node.
+    template <typename Links>
+    std::size_t tree_rank( const Links& links, typename Links::handle node )
+    {
+        std::size_t rank = tree_count( links, links.left( node ) );
+
+        if ( links.is_end( node ) ) // its left child is the root
+            return ( rank );
+        for ( ; !( links.is_end( links.parent( node ) ) ); node = links.parent( node ) )
+        {
+            if ( !tree_is_left_child( links, node ) )
+                rank += tree_count( links, links.left( links.parent( node ) ) ) + 1;
+        }
+        return ( rank );
+    }
+
+    // Subtree sizes of a ranked tree, from node up to the root
+    template <typename Links>
+    void tree_adjust_counts( const Links& links, typename Links::handle node, bool grow )
+    {
+        for ( ; !( links.is_end( node ) ); node = links.parent( node ) )
+            links.set_count( node, grow ? links.count( node ) + 1 : links.count( node ) - 1 );
+    }
+
+    // Asks the cache to load the node ahead of a descent reaching it (a hint only, no fault for any address).
+    template <typename NodePtr>
+    inline void tree_prefetch( NodePtr nodeptr )
+    {
+        __builtin_prefetch( static_cast<const void*>( nodeptr ) );
+    }
+
+    /*
+    ** True, if Compare is ft::less (ranked or not) on an arithmetic Key: a
+    ** comparison is then a single instruction and cannot throw, so a descent
+    ** can pick the next node with a conditional move instead of a branch.
+    */
+    template <typename Compare, typename Key>
+    struct tree_compare_is_arithmetic_less                                      : public false_type {};
+
+    template <typename Key>
+    struct tree_compare_is_arithmetic_less<ft::less<Key>, Key>                  : public is_arithmetic<Key> {};
+
+    template <typename Key>
+    struct tree_compare_is_arithmetic_less<ft::ranked<ft::less<Key> >, Key>     : public is_arithmetic<Key> {};
+
+
+    /* ------------------------ red black algorithms ------------------------ */
+
+    /*
+    ** (Cormen, Leiserson, Rivest & Stein: 'Introduction to Algorithms' - 3rd Edition, Chapter 13)
+    ** Rotations and the insert / erase fixups for any link policy. The root is
+    ** the left child of the end node, so relinking a child of the end node
+    ** needs no special case, as long as the left link is checked first (the
+    ** right link of the end node is the right-most node, not a child).
+    ** In a ranked tree the rotations keep the subtree sizes up to date.
+    */
+
+    template <typename Links>
+    void tree_left_rotate( const Links& links, typename Links::handle position )
+    {
+        typename Links::handle  right_node = links.right( position );
+        typename Links::handle  parent = links.parent( position );
+
+        links.set_right( position, links.left( right_node ) ); // turn right_nodes’s left subtree into positions’s right subtree
+        if ( links.left( right_node ) != links.null() )
+            links.set_parent( links.left( right_node ), position );
+        links.set_parent( right_node, parent ); // link position’s parent to right_node
+        if ( position == links.left( parent ) )
+            links.set_left( parent, right_node );
+        else
+            links.set_right( parent, right_node );
+        links.set_left( right_node, position ); // put position on right_node’s left
+        links.set_parent( position, right_node );
+        if ( Links::ranked )
+        {
+            links.set_count( right_node, links.count( position ) );
+            links.set_count( position, tree_count( links, links.left( position ) ) + tree_count( links, links.right( position ) ) + 1 );
+        }
+    }
+
+    template <typename Links>
+    void tree_right_rotate( const Links& links, typename Links::handle position )
     {
-        while ( nodeptr != nullptr || nodeptr->_left->_left != nullptr ) // equals this->_null
-            nodeptr = nodeptr->_left;
-        return ( nodeptr );
+        typename Links::handle  left_node = links.left( position );
+        typename Links::handle  parent = links.parent( position );
+
+        links.set_left( position, links.right( left_node ) ); // turn left_nodes’s right subtree into positions’s left subtree
+        if ( links.right( left_node ) != links.null() )
+            links.set_parent( links.right( left_node ), position );
+        links.set_parent( left_node, parent ); // link position’s parent to left_node
+        if ( position == links.left( parent ) )
+            links.set_left( parent, left_node );
+        else
+            links.set_right( parent, left_node );
+        links.set_right( left_node, position ); // put position on left_node’s right
+        links.set_parent( position, left_node );
+        if ( Links::ranked )
+        {
+            links.set_count( left_node, links.count( position ) );
+            links.set_count( position, tree_count( links, links.left( position ) ) + tree_count( links, links.right( position ) ) + 1 );
+        }
+    }
+
+    // Rebalances after position was linked in as a red leaf. Returns true, if the black height of the tree grew.
+    template <typename Links>
+    bool tree_insert_fixup( const Links& links, typename Links::handle position, typename Links::handle end )
+    {
+        typename Links::handle  parent;
+        typename Links::handle  grandparent;
+        typename Links::handle  uncle; // same level as parent node
+
+        while ( links.colour( links.parent( position ) ) == RED )
+        {
+            parent = links.parent( position );
+            grandparent = links.parent( parent );
+            if ( parent == links.left( grandparent ) )
+            {
+                uncle = links.right( grandparent );
+                // 3 cases:
+                if ( links.colour( uncle ) == RED ) // 1
+                {
+                    links.set_colour( parent, BLACK );
+                    links.set_colour( uncle, BLACK );
+                    links.set_colour( grandparent, RED );
+                    position = grandparent;
+                }
+                else
+                {
+                    if ( position == links.right( parent ) ) // 2
+                    {
+                        position = parent;
+                        tree_left_rotate( links, position );
+                        parent = links.parent( position );
+                    }
+                    // 3
+                    links.set_colour( parent, BLACK );
+                    links.set_colour( grandparent, RED );
+                    tree_right_rotate( links, grandparent );
+                }
+            }
+            else
+            {
+                uncle = links.left( grandparent );
+                // 3 cases:
+                if ( links.colour( uncle ) == RED ) // 1
+                {
+                    links.set_colour( parent, BLACK );
+                    links.set_colour( uncle, BLACK );
+                    links.set_colour( grandparent, RED );
+                    position = grandparent;
+                }
+                else
+                {
+                    if ( position == links.left( parent ) ) // 2
+                    {
+                        position = parent;
+                        tree_right_rotate( links, position );
+                        parent = links.parent( position );
+                    }
+                    // 3
+                    links.set_colour( parent, BLACK );
+                    links.set_colour( grandparent, RED );
+                    tree_left_rotate( links, grandparent );
+                }
+            }
+        }
+        if ( links.colour( links.left( end ) ) == BLACK )
+            return ( false );
+        links.set_colour( links.left( end ), BLACK );
+        return ( true );
+    }
+
+    // position may be null(), so its parent is passed in.
+    template <typename Links>
+    void tree_erase_fixup( const Links& links, typename Links::handle position, typename Links::handle parent, typename Links::handle end )
+    {
+        typename Links::handle  sibling; // same level as position
+
+        while ( position != links.left( end ) && links.colour( position ) == BLACK )
+        {
+            if ( position == links.left( parent ) )
+            {
+                sibling = links.right( parent );
+                if ( links.colour( sibling ) == RED ) // 1
+                {
+                    links.set_colour( sibling, BLACK );
+                    links.set_colour( parent, RED );
+                    tree_left_rotate( links, parent );
+                    sibling = links.right( parent );
+                }
+                if ( links.colour( links.left( sibling ) ) == BLACK && links.colour( links.right( sibling ) ) == BLACK ) // 2
+                {
+                    links.set_colour( sibling, RED );
+                    position = parent;
+                    parent = links.parent( position );
+                }
+                else
+                {
+                    if ( links.colour( links.right( sibling ) ) == BLACK ) // 3
+                    {
+                        links.set_colour( links.left( sibling ), BLACK );
+                        links.set_colour( sibling, RED );
+                        tree_right_rotate( links, sibling );
+                        sibling = links.right( parent );
+                    }
+                    // 4
+                    links.set_colour( sibling, links.colour( parent ) );
+                    links.set_colour( parent, BLACK );
+                    links.set_colour( links.right( sibling ), BLACK );
+                    tree_left_rotate( links, parent );
+                    position = links.left( end );
+                }
+            }
+            else
+            {
+                sibling = links.left( parent );
+                if ( links.colour( sibling ) == RED ) // 1
+                {
+                    links.set_colour( sibling, BLACK );
+                    links.set_colour( parent, RED );
+                    tree_right_rotate( links, parent );
+                    sibling = links.left( parent );
+                }
+                if ( links.colour( links.right( sibling ) ) == BLACK && links.colour( links.left( sibling ) ) == BLACK ) // 2
+                {
+                    links.set_colour( sibling, RED );
+                    position = parent;
+                    parent = links.parent( position );
+                }
+                else
+                {
+                    if ( links.colour( links.left( sibling ) ) == BLACK ) // 3
+                    {
+                        links.set_colour( links.right( sibling ), BLACK );
+                        links.set_colour( sibling, RED );
+                        tree_left_rotate( links, sibling );
+                        sibling = links.left( parent );
+                    }
+                    // 4
+                    links.set_colour( sibling, links.colour( parent ) );
+                    links.set_colour( parent, BLACK );
+                    links.set_colour( links.left( sibling ), BLACK );
+                    tree_right_rotate( links, parent );
+                    position = links.left( end );
+                }
+            }
+        }
+        if ( position != links.null() )
+            links.set_colour( position, BLACK );
+    }
+
+    template <typename Links>
+    void tree_transplant( const Links& links, typename Links::handle old_subtree, typename Links::handle new_subtree )
+    {
+        typename Links::handle  parent = links.parent( old_subtree );
+
+        if ( old_subtree == links.left( parent ) )
+            links.set_left( parent, new_subtree );
+        else
+            links.set_right( parent, new_subtree );
+        if ( new_subtree != links.null() )
+            links.set_parent( new_subtree, parent );
+    }
+
+    // Takes node out of the tree and rebalances, node itself is kept. The
+    // begin node and the right-most node, if a tree caches them, are up to the caller.
+    template <typename Links>
+    void tree_unlink( const Links& links, typename Links::handle node, typename Links::handle end )
+    {
+        typename Links::handle  track_node = node;
+        node_state              original_track_node_colour = links.colour( track_node );
+        typename Links::handle  replacement;
+        typename Links::handle  replacement_parent = links.parent( node ); // tracked here, null() never gets a parent
+
+        if ( Links::ranked ) // one node less below the parent of the node that is unlinked
+        {
+            if ( links.left( node ) != links.null() && links.right( node ) != links.null() )
+                tree_adjust_counts( links, links.parent( tree_min( links, links.right( node ) ) ), false );
+            else
+                tree_adjust_counts( links, links.parent( node ), false );
+        }
+        if ( links.left( node ) == links.null() )
+        {
+            replacement = links.right( node );
+            tree_transplant( links, node, replacement );
+        }
+        else if ( links.right( node ) == links.null() )
+        {
+            replacement = links.left( node );
+            tree_transplant( links, node, replacement );
+        }
+        else
+        {
+            track_node = tree_min( links, links.right( node ) );
+            original_track_node_colour = links.colour( track_node );
+            replacement = links.right( track_node );
+            if ( links.parent( track_node ) == node )
+                replacement_parent = track_node;
+            else
+            {
+                replacement_parent = links.parent( track_node );
+                tree_transplant( links, track_node, replacement );
+                links.set_right( track_node, links.right( node ) );
+                links.set_parent( links.right( track_node ), track_node );
+            }
+            tree_transplant( links, node, track_node );
+            links.set_left( track_node, links.left( node ) );
+            links.set_parent( links.left( track_node ), track_node );
+            links.set_colour( track_node, links.colour( node ) );
+            links.set_count( track_node, links.count( node ) );
+        }
+        if ( original_track_node_colour == BLACK )
+            tree_erase_fixup( links, replacement, replacement_parent, end );
+    }
+
+    /* ------------------------- tree key searches -------------------------- */
+
+    /*
+    ** The searches by key and the insert positions of red_black_tree and
+    ** compact_tree, for any link policy. key_of is the KeyOfValue of the tree
+    ** and comp its comparator, end its end node: a search, which finds no
+    ** node, returns end.
+    */
+
+    // Both children are prefetched before the key of a node is compared, so
+    // the next node is (partly) loaded by the time the comparison is done.
+    template <typename Links, typename K, typename KeyOfValue, typename Compare>
+    typename Links::handle tree_lower_bound( const Links& links, typename Links::handle end, const K& key, const KeyOfValue& key_of, const Compare& comp, ft::false_type )
+    {
+        typename Links::handle  rootptr = links.left( end );
+        typename Links::handle  position = end;
+
+        while ( rootptr != links.null() )
+        {
+            links.prefetch( links.left( rootptr ) );
+            links.prefetch( links.right( rootptr ) );
+            if ( !( comp( key_of( links.value( rootptr ) ), key ) ) )
+            {
+                position = rootptr;
+                rootptr = links.left( rootptr );
+            }
+            else
+                rootptr = links.right( rootptr );
+        }
+        return ( position );
+    }
+
+    // An arithmetic key with ft::less: the next node is picked without a branch.
+    template <typename Links, typename K, typename KeyOfValue, typename Compare>
+    typename Links::handle tree_lower_bound( const Links& links, typename Links::handle end, const K& key, const KeyOfValue& key_of, __attribute__( ( unused ) ) const Compare& comp, ft::true_type )
+    {
+        typename Links::handle  rootptr = links.left( end );
+        typename Links::handle  position = end;
+        bool                    go_right;
+
+        while ( rootptr != links.null() )
+        {
+            links.prefetch( links.left( rootptr ) );
+            links.prefetch( links.right( rootptr ) );
+            go_right = ( key_of( links.value( rootptr ) ) < key );
+            position = go_right ? position : rootptr;
+            rootptr = go_right ? links.right( rootptr ) : links.left( rootptr );
+        }
+        return ( position );
+    }
+
+    // First node not less than key
+    template <typename Links, typename K, typename KeyOfValue, typename Compare>
+    inline typename Links::handle tree_lower_bound( const Links& links, typename Links::handle end, const K& key, const KeyOfValue& key_of, const Compare& comp )
+    {
+        return ( tree_lower_bound( links, end, key, key_of, comp, typename tree_compare_is_arithmetic_less<Compare, K>::type() ) );
+    }
+
+    // First node greater than key
+    template <typename Links, typename K, typename KeyOfValue, typename Compare>
+    typename Links::handle tree_upper_bound( const Links& links, typename Links::handle end, const K& key, const KeyOfValue& key_of, const Compare& comp )
+    {
+        typename Links::handle  rootptr = links.left( end );
+        typename Links::handle  position = end;
+
+        while ( rootptr != links.null() )
+        {
+            if ( comp( key, key_of( links.value( rootptr ) ) ) )
+            {
+                position = rootptr;
+                rootptr = links.left( rootptr );
+            }
+            else
+                rootptr = links.right( rootptr );
+        }
+        return ( position );
     }
 
-    template <typename T>
-    typename tree_node<T>::node_ptr tree_max( typename tree_node<T>::node_ptr nodeptr )
+    template <typename Links, typename K, typename KeyOfValue, typename Compare>
+    typename Links::handle tree_find( const Links& links, typename Links::handle end, const K& key, const KeyOfValue& key_of, const Compare& comp )
     {
-        while ( nodeptr->_right->_right != nullptr ) // equals this->_null
-            nodeptr = nodeptr->_right;
-        return ( nodeptr );
+        typename Links::handle  position = tree_lower_bound( links, end, key, key_of, comp ); // one comparison per level
+
+        if ( position != end && !( comp( key, key_of( links.value( position ) ) ) ) ) // and one to verify
+            return ( position );
+        return ( end );
     }
 
-    template <typename T>
-    typename tree_node<T>::const_node_ptr tree_max( typename tree_node<T>::const_node_ptr nodeptr )
+    // Returns the node with an equivalent key, if there is one. Otherwise returns null()
+    // and sets parent / as_left_child to the place a node with this key belongs to.
+    // A key greater than all others (e.g. increasing timestamps or ids) is
+    // appended to the right-most node right away, without a descent: so is
+    // already sorted input, with one comparison per element.
+    template <typename Links, typename KeyOfValue, typename Compare>
+    typename Links::handle tree_find_insert_position( const Links& links, typename Links::handle end, const typename KeyOfValue::result_type& key, const KeyOfValue& key_of, const Compare& comp,
+                                                      typename Links::handle& parent, bool& as_left_child )
     {
-        while ( nodeptr->_right->_right != nullptr ) // equals this->_null
-            nodeptr = nodeptr->_right;
-        return ( nodeptr );
+        typename Links::handle  rootptr = links.left( end );
+
+        if ( rootptr != links.null() && comp( key_of( links.value( links.right( end ) ) ), key ) )
+        {
+            parent = links.right( end );
+            as_left_child = false;
+            return ( links.null() );
+        }
+        parent = end;
+        as_left_child = true;
+        while ( rootptr != links.null() )
+        {
+            parent = rootptr;
+            if ( comp( key, key_of( links.value( rootptr ) ) ) )
+            {
+                as_left_child = true;
+                rootptr = links.left( rootptr );
+            }
+            else if ( comp( key_of( links.value( rootptr ) ), key ) )
+            {
+                as_left_child = false;
+                rootptr = links.right( rootptr );
+            }
+            else
+                return ( rootptr );
+        }
+        return ( links.null() );
     }
 
-    template <typename T>
-    bool tree_is_left_child( typename tree_node<T>::node_ptr nodeptr )
+    // Like tree_find_insert_position(), but if key belongs directly before or
+    // after hint, the place next to hint is taken without a search (amortized
+    // constant). begin is the left-most node of the tree.
+    template <typename Links, typename KeyOfValue, typename Compare>
+    typename Links::handle tree_hint_insert_position( const Links& links, typename Links::handle end, typename Links::handle begin, typename Links::handle hint,
+                                                      const typename KeyOfValue::result_type& key, const KeyOfValue& key_of, const Compare& comp,
+                                                      typename Links::handle& parent, bool& as_left_child )
     {
-        return ( nodeptr == nodeptr->_parent->_left );
+        typename Links::handle  neighbour;
+
+        if ( hint == end ) // tree_find_insert_position() tries the right-most node first
+            return ( tree_find_insert_position( links, end, key, key_of, comp, parent, as_left_child ) );
+        if ( comp( key, key_of( links.value( hint ) ) ) ) // key goes before hint
+        {
+            neighbour = ( hint == begin ) ? end : tree_prev( links, hint );
+            if ( neighbour == end || comp( key_of( links.value( neighbour ) ), key ) )
+            {
+                if ( neighbour != end && links.right( neighbour ) == links.null() ) // hint has a left subtree, neighbour is its right-most node
+                {
+                    parent = neighbour;
+                    as_left_child = false;
+                }
+                else
+                {
+                    parent = hint;
+                    as_left_child = true;
+                }
+                return ( links.null() );
+            }
+        }
+        else if ( comp( key_of( links.value( hint ) ), key ) ) // key goes after hint
+        {
+            neighbour = tree_next( links, hint );
+            if ( neighbour == end || comp( key, key_of( links.value( neighbour ) ) ) )
+            {
+                if ( links.right( hint ) == links.null() )
+                {
+                    parent = hint;
+                    as_left_child = false;
+                }
+                else // neighbour is the left-most node of the right subtree of hint
+                {
+                    parent = neighbour;
+                    as_left_child = true;
+                }
+                return ( links.null() );
+            }
+        }
+        else // equivalent to hint
+            return ( hint );
+        return ( tree_find_insert_position( links, end, key, key_of, comp, parent, as_left_child ) );
     }
 
-    template <typename T>
-    bool tree_is_left_child( typename tree_node<T>::const_node_ptr nodeptr )
+    // Links new_node as the (empty) left or right child of parent, keeps the
+    // left-most node (begin) and the right-most node (right link of end) and
+    // rebalances. parent == end inserts the root of an empty tree.
+    template <typename Links>
+    void tree_insert_leaf( const Links& links, typename Links::handle end, typename Links::handle& begin, typename Links::handle parent, bool as_left_child, typename Links::handle new_node )
     {
-        return ( nodeptr == nodeptr->_parent->_left );
+        links.set_parent( new_node, parent );
+        if ( as_left_child )
+        {
+            links.set_left( parent, new_node );
+            if ( parent == begin )
+                begin = new_node;
+            if ( parent == end )
+                links.set_right( end, new_node );
+        }
+        else
+        {
+            links.set_right( parent, new_node );
+            if ( parent == links.right( end ) )
+                links.set_right( end, new_node );
+        }
+        if ( Links::ranked )
+            tree_adjust_counts( links, parent, true );
+        tree_insert_fixup( links, new_node, end );
     }
 
-
     /* --------------------------- Tree Iterator ---------------------------- */
 
     /*
-    ** A bidirectional_iterator, with typenames NodePtr and T
+    ** A bidirectional_iterator, with typenames Links (see tree_links) and T.
+    ** The link policy is a base class, so one without state takes no space.
     */
 
-    template <typename NodePtr, typename T>
-    class tree_iterator
+    template <typename Links, typename T>
+    class tree_iterator : private Links
     {
     public:
         typedef bidirectional_iterator_tag          iterator_category;
@@ -164,20 +982,22 @@ namespace ft
         typedef ptrdiff_t                           difference_type;
         typedef T*                                  pointer;
         typedef T&                                  reference;
+        typedef typename Links::handle              handle;
 
     private:
-        NodePtr _node_ptr;
+        handle  _node;
 
     public:
         tree_iterator();
-        tree_iterator( const NodePtr& ptr );
+        tree_iterator( const handle& node, const Links& links = Links() );
         tree_iterator( const tree_iterator& other );
         ~tree_iterator();
 
         tree_iterator& operator=( const tree_iterator& src );
-        tree_iterator& operator=( const NodePtr& src_ptr );
+        tree_iterator& operator=( const handle& node );
 
-        NodePtr base() const;
+        handle base() const;
+        const Links& links() const;
         reference operator*() const;
         pointer operator->() const;
         tree_iterator& operator++();
@@ -188,70 +1008,71 @@ namespace ft
     }; // tree_iterator
 
     /* tree_iterator member functions */
-    
-    template <typename NodePtr, typename T>
-    tree_iterator<NodePtr, T>::tree_iterator() : _node_ptr() {}
 
-    template <typename NodePtr, typename T>
-    tree_iterator<NodePtr, T>::tree_iterator( const NodePtr& ptr ) : _node_ptr( ptr ) {}
-    
-    template <typename NodePtr, typename T>
-    tree_iterator<NodePtr, T>::tree_iterator( const tree_iterator& other ) : _node_ptr( other._node_ptr ) {}
+    template <typename Links, typename T>
+    tree_iterator<Links, T>::tree_iterator() : Links(), _node() {}
+
+    template <typename Links, typename T>
+    tree_iterator<Links, T>::tree_iterator( const handle& node, const Links& links ) : Links( links ), _node( node ) {}
 
-    template <typename NodePtr, typename T>
-    tree_iterator<NodePtr, T>::~tree_iterator() {}
+    template <typename Links, typename T>
+    tree_iterator<Links, T>::tree_iterator( const tree_iterator& other ) : Links( other ), _node( other._node ) {}
 
+    template <typename Links, typename T>
+    tree_iterator<Links, T>::~tree_iterator() {}
 
-    template <typename NodePtr, typename T>
-    tree_iterator<NodePtr, T>& tree_iterator<NodePtr, T>::operator=( const tree_iterator& src )
+
+    template <typename Links, typename T>
+    tree_iterator<Links, T>& tree_iterator<Links, T>::operator=( const tree_iterator& src )
     {
         if ( this != &src )
-            this->_node_ptr = src._node_ptr;
+        {
+            Links::operator=( src );
+            this->_node = src._node;
+        }
         return ( *this );
     }
 
-    template <typename NodePtr, typename T>
-    tree_iterator<NodePtr, T>& tree_iterator<NodePtr, T>::operator=( const NodePtr& src_ptr )
+    template <typename Links, typename T>
+    tree_iterator<Links, T>& tree_iterator<Links, T>::operator=( const handle& node )
     {
-        this->_node_ptr = src_ptr;
+        this->_node = node;
         return ( *this );
     }
 
-    template <typename NodePtr, typename T>
-    NodePtr tree_iterator<NodePtr, T>::base() const
+    template <typename Links, typename T>
+    typename tree_iterator<Links, T>::handle tree_iterator<Links, T>::base() const
     {
-        return ( this->_node_ptr );
+        return ( this->_node );
     }
 
-    template <typename NodePtr, typename T>
-    typename tree_iterator<NodePtr, T>::reference tree_iterator<NodePtr, T>::operator*() const
+    template <typename Links, typename T>
+    const Links& tree_iterator<Links, T>::links() const
     {
-        return ( this->_node_ptr->_data );
+        return ( *( this ) );
     }
 
-    template <typename NodePtr, typename T>
-    typename tree_iterator<NodePtr, T>::pointer tree_iterator<NodePtr, T>::operator->() const
+    template <typename Links, typename T>
+    typename tree_iterator<Links, T>::reference tree_iterator<Links, T>::operator*() const
     {
-        return ( &( this->_node_ptr->_data ) );
+        return ( this->value( this->_node ) );
     }
 
-    template <typename NodePtr, typename T>
-    tree_iterator<NodePtr, T>& tree_iterator<NodePtr, T>::operator++()
+    template <typename Links, typename T>
+    typename tree_iterator<Links, T>::pointer tree_iterator<Links, T>::operator->() const
     {
-        if ( this->_node_ptr->_right->_right != nullptr ) // equals 'this->_node_ptr->_right == this->_null'
-            this->_node_ptr = tree_min<value_type>( this->_node_ptr->_right );
-        else
-        {
-            while ( !( tree_is_left_child<value_type>( this->_node_ptr ) )
-            && ( this->_node_ptr->_parent->_parent != nullptr ) )
-                this->_node_ptr = this->_node_ptr->_parent;
-            this->_node_ptr = this->_node_ptr->_parent;
-        }
+        return ( &( this->value( this->_node ) ) );
+    }
+
+    template <typename Links, typename T>
+    tree_iterator<Links, T>& tree_iterator<Links, T>::operator++()
+    {
+        this->_node = tree_next( this->links(), this->_node );
         return ( *( this ) );
     }
 
-    template <typename NodePtr, typename T>
-    tree_iterator<NodePtr, T>  tree_iterator<NodePtr, T>::operator++( int )
+    template <typename Links, typename T>
+    tree_iterator<Links, T>  tree_iterator<Links, T>::operator++( int )
     {
         tree_iterator   it = *( this );
 
@@ -259,22 +1080,15 @@ namespace ft
         return ( it );
     }
 
-    template <typename NodePtr, typename T>
-    tree_iterator<NodePtr, T>& tree_iterator<NodePtr, T>::operator--()
+    template <typename Links, typename T>
+    tree_iterator<Links, T>& tree_iterator<Links, T>::operator--()
     {
-        if ( this->_node_ptr->_left->_left != nullptr ) // equals 'this->_node_ptr->_left == this->_null'
-            this->_node_ptr = tree_max<value_type>( this->_node_ptr->_left );
-        else
-        {
-            while ( tree_is_left_child<value_type>( this->_node_ptr ) )
-                this->_node_ptr = this->_node_ptr->_parent;
-            this->_node_ptr = this->_node_ptr->_parent;
-        }
+        this->_node = tree_prev( this->links(), this->_node );
         return ( *( this ) );
     }
 
-    template <typename NodePtr, typename T>
-    tree_iterator<NodePtr, T>  tree_iterator<NodePtr, T>::operator--( int )
+    template <typename Links, typename T>
+    tree_iterator<Links, T>  tree_iterator<Links, T>::operator--( int )
     {
         tree_iterator   it = *( this );
 
@@ -284,14 +1098,14 @@ namespace ft
 
     /* tree_iterator non-member functions */
 
-    template <typename NodePtr, typename T>
-    bool operator==( const tree_iterator<NodePtr, T>& lhs, const tree_iterator<NodePtr, T>& rhs )
+    template <typename Links, typename T>
+    bool operator==( const tree_iterator<Links, T>& lhs, const tree_iterator<Links, T>& rhs )
     {
         return ( lhs.base() == rhs.base() );
     }
 
-    template <typename NodePtr, typename T>
-    bool operator!=( const tree_iterator<NodePtr, T>& lhs, const tree_iterator<NodePtr, T>& rhs )
+    template <typename Links, typename T>
+    bool operator!=( const tree_iterator<Links, T>& lhs, const tree_iterator<Links, T>& rhs )
     {
         return ( !( lhs == rhs ) );
     }
@@ -300,11 +1114,11 @@ namespace ft
     /* ------------------------ Tree Const Iterator ------------------------- */
 
     /*
-    ** A bidirectional_iterator, with typenames ConstNodePtr and T
+    ** A bidirectional_iterator, with typenames Links (see tree_links) and T
     */
 
-    template <typename ConstNodePtr, typename T>
-    class tree_const_iterator
+    template <typename Links, typename T>
+    class tree_const_iterator : private Links
     {
 
     public:
@@ -313,24 +1127,26 @@ namespace ft
         typedef ptrdiff_t                       difference_type;
         typedef const T*                        pointer;
         typedef const T&                        reference;
+        typedef typename Links::handle          handle;
 
     public: // needs to be public for current implementation of 'map_const_iterator( map_iterator<typename TreeIterator::non_const_iterator> other )' to work
-        typedef tree_iterator<typename tree_node<T>::node_ptr, value_type>  non_const_iterator;
+        typedef tree_iterator<Links, value_type>    non_const_iterator;
 
     private:
-        ConstNodePtr _node_ptr;
+        handle  _node;
 
     public:
         tree_const_iterator();
-        tree_const_iterator( const ConstNodePtr& ptr );
+        tree_const_iterator( const handle& node, const Links& links = Links() );
         tree_const_iterator( const tree_const_iterator& other );
         tree_const_iterator( const non_const_iterator& other );
         ~tree_const_iterator();
 
         tree_const_iterator& operator=( const tree_const_iterator& src );
-        tree_const_iterator& operator=( const ConstNodePtr& src_ptr );
+        tree_const_iterator& operator=( const handle& node );
 
-        ConstNodePtr base() const;
+        handle base() const;
+        const Links& links() const;
         reference operator*() const;
         pointer operator->() const;
         tree_const_iterator& operator++();
@@ -341,72 +1157,74 @@ namespace ft
     }; // tree_const_iterator
 
     /* tree_const_iterator member functions */
-    
-    template <typename ConstNodePtr, typename T>
-    tree_const_iterator<ConstNodePtr, T>::tree_const_iterator() : _node_ptr() {}
 
-    template <typename ConstNodePtr, typename T>
-    tree_const_iterator<ConstNodePtr, T>::tree_const_iterator( const ConstNodePtr& ptr ) : _node_ptr( ptr ) {}    
+    template <typename Links, typename T>
+    tree_const_iterator<Links, T>::tree_const_iterator() : Links(), _node() {}
 
-    template <typename ConstNodePtr, typename T>
-    tree_const_iterator<ConstNodePtr, T>::tree_const_iterator( const tree_const_iterator& other ) : _node_ptr( other._node_ptr ) {}
+    template <typename Links, typename T>
+    tree_const_iterator<Links, T>::tree_const_iterator( const handle& node, const Links& links ) : Links( links ), _node( node ) {}
 
-    template <typename ConstNodePtr, typename T>
-    tree_const_iterator<ConstNodePtr, T>::tree_const_iterator( const non_const_iterator& other ) : _node_ptr( other.base() ) {}
+    template <typename Links, typename T>
+    tree_const_iterator<Links, T>::tree_const_iterator( const tree_const_iterator& other ) : Links( other ), _node( other._node ) {}
 
-    template <typename ConstNodePtr, typename T>
-    tree_const_iterator<ConstNodePtr, T>::~tree_const_iterator() {}
+    template <typename Links, typename T>
+    tree_const_iterator<Links, T>::tree_const_iterator( const non_const_iterator& other ) : Links( other.links() ), _node( other.base() ) {}
 
+    template <typename Links, typename T>
+    tree_const_iterator<Links, T>::~tree_const_iterator() {}
 
-    template <typename ConstNodePtr, typename T>
-    tree_const_iterator<ConstNodePtr, T>& tree_const_iterator<ConstNodePtr, T>::operator=( const tree_const_iterator& src )
+
+    template <typename Links, typename T>
+    tree_const_iterator<Links, T>& tree_const_iterator<Links, T>::operator=( const tree_const_iterator& src )
     {
         if ( this != &src )
-            this->_node_ptr = src._node_ptr;
+        {
+            Links::operator=( src );
+            this->_node = src._node;
+        }
         return ( *this );
     }
 
-    template <typename ConstNodePtr, typename T>
-    tree_const_iterator<ConstNodePtr, T>& tree_const_iterator<ConstNodePtr, T>::operator=( const ConstNodePtr& src_ptr )
+    template <typename Links, typename T>
+    tree_const_iterator<Links, T>& tree_const_iterator<Links, T>::operator=( const handle& node )
     {
-        this->_node_ptr = src_ptr;
+        this->_node = node;
         return ( *this );
     }
 
-    template <typename ConstNodePtr, typename T>
-    ConstNodePtr tree_const_iterator<ConstNodePtr, T>::base() const
+    template <typename Links, typename T>
+    typename tree_const_iterator<Links, T>::handle tree_const_iterator<Links, T>::base() const
     {
-        return ( this->_node_ptr );
+        return ( this->_node );
     }
 
-    template <typename ConstNodePtr, typename T>
-    typename tree_const_iterator<ConstNodePtr, T>::reference tree_const_iterator<ConstNodePtr, T>::operator*() const
+    template <typename Links, typename T>
+    const Links& tree_const_iterator<Links, T>::links() const
     {
-        return ( this->_node_ptr->_data );
+        return ( *( this ) );
     }
 
-    template <typename ConstNodePtr, typename T>
-    typename tree_const_iterator<ConstNodePtr, T>::pointer tree_const_iterator<ConstNodePtr, T>::operator->() const
+    template <typename Links, typename T>
+    typename tree_const_iterator<Links, T>::reference tree_const_iterator<Links, T>::operator*() const
     {
-        return ( &( this->_node_ptr->_data ) );
+        return ( this->value( this->_node ) );
     }
 
-    template <typename ConstNodePtr, typename T>
-    tree_const_iterator<ConstNodePtr, T>& tree_const_iterator<ConstNodePtr, T>::operator++()
+    template <typename Links, typename T>
+    typename tree_const_iterator<Links, T>::pointer tree_const_iterator<Links, T>::operator->() const
     {
-        if ( this->_node_ptr->_right->_right != nullptr ) // equals 'this->_node_ptr->_right == this->_null'
-            this->_node_ptr = tree_min<value_type>( this->_node_ptr->_right );
-        else
-        {
-            while ( !( tree_is_left_child<value_type>( this->_node_ptr ) ) )
-                this->_node_ptr = this->_node_ptr->_parent;
-            this->_node_ptr = this->_node_ptr->_parent;
-        }
+        return ( &( this->value( this->_node ) ) );
+    }
+
+    template <typename Links, typename T>
+    tree_const_iterator<Links, T>& tree_const_iterator<Links, T>::operator++()
+    {
+        this->_node = tree_next( this->links(), this->_node );
         return ( *( this ) );
     }
 
-    template <typename ConstNodePtr, typename T>
-    tree_const_iterator<ConstNodePtr, T>  tree_const_iterator<ConstNodePtr, T>::operator++( int )
+    template <typename Links, typename T>
+    tree_const_iterator<Links, T>  tree_const_iterator<Links, T>::operator++( int )
     {
         tree_const_iterator   it = *( this );
 
@@ -414,22 +1232,15 @@ namespace ft
         return ( it );
     }
 
-    template <typename ConstNodePtr, typename T>
-    tree_const_iterator<ConstNodePtr, T>& tree_const_iterator<ConstNodePtr, T>::operator--()
+    template <typename Links, typename T>
+    tree_const_iterator<Links, T>& tree_const_iterator<Links, T>::operator--()
     {
-        if ( this->_node_ptr->_left->_left != nullptr ) // equals 'this->_node_ptr->_left == this->_null'
-            this->_node_ptr = tree_max<value_type>( this->_node_ptr->_left );
-        else
-        {
-            while ( tree_is_left_child<value_type>( this->_node_ptr ) )
-                this->_node_ptr = this->_node_ptr->_parent;
-            this->_node_ptr = this->_node_ptr->_parent;
-        }
+        this->_node = tree_prev( this->links(), this->_node );
         return ( *( this ) );
     }
 
-    template <typename ConstNodePtr, typename T>
-    tree_const_iterator<ConstNodePtr, T>  tree_const_iterator<ConstNodePtr, T>::operator--( int )
+    template <typename Links, typename T>
+    tree_const_iterator<Links, T>  tree_const_iterator<Links, T>::operator--( int )
     {
         tree_const_iterator   it = *( this );
 
@@ -439,42 +1250,79 @@ namespace ft
 
     /* tree_const_iterator non-member functions */
 
-    template <typename ConstNodePtr, typename T>
-    inline bool operator==( const tree_const_iterator<ConstNodePtr, T>& lhs, const tree_const_iterator<ConstNodePtr, T>& rhs )
+    template <typename Links, typename T>
+    inline bool operator==( const tree_const_iterator<Links, T>& lhs, const tree_const_iterator<Links, T>& rhs )
     {
         return ( lhs.base() == rhs.base() );
     }
 
-    template <typename ConstNodePtr, typename T>
-    inline bool operator!=( const tree_const_iterator<ConstNodePtr, T>& lhs, const tree_const_iterator<ConstNodePtr, T>& rhs )
+    template <typename Links, typename T>
+    inline bool operator!=( const tree_const_iterator<Links, T>& lhs, const tree_const_iterator<Links, T>& rhs )
     {
         return ( !( lhs == rhs ) );
     }
 
-    template <typename ConstNodePtr, typename NodePtr, typename T>
-    inline bool operator==( const tree_iterator<NodePtr, T>& lhs, const tree_const_iterator<ConstNodePtr, T>& rhs )
+    template <typename Links, typename T>
+    inline bool operator==( const tree_iterator<Links, T>& lhs, const tree_const_iterator<Links, T>& rhs )
     {
         return ( lhs.base() == rhs.base() );
     }
 
-    template <typename ConstNodePtr, typename NodePtr, typename T>
-    inline bool operator!=( const tree_iterator<NodePtr, T>& lhs, const tree_const_iterator<ConstNodePtr, T>& rhs )
+    template <typename Links, typename T>
+    inline bool operator!=( const tree_iterator<Links, T>& lhs, const tree_const_iterator<Links, T>& rhs )
     {
         return ( !( lhs == rhs ) );
     }
 
-        template <typename ConstNodePtr, typename NodePtr, typename T>
-    inline bool operator==( const tree_const_iterator<ConstNodePtr, T>& lhs, const tree_iterator<NodePtr, T>& rhs )
+    template <typename Links, typename T>
+    inline bool operator==( const tree_const_iterator<Links, T>& lhs, const tree_iterator<Links, T>& rhs )
     {
         return ( lhs.base() == rhs.base() );
     }
 
-    template <typename ConstNodePtr, typename NodePtr, typename T>
-    inline bool operator!=( const tree_const_iterator<ConstNodePtr, T>& lhs, const tree_iterator<NodePtr, T>& rhs )
+    template <typename Links, typename T>
+    inline bool operator!=( const tree_const_iterator<Links, T>& lhs, const tree_iterator<Links, T>& rhs )
     {
         return ( !( lhs == rhs ) );
     }
 
+    /*
+    ** ft::distance for the iterators of a ranked tree (see ft::ranked):
+    ** the difference of the in-order positions, O(log n) instead of O(n).
+    */
+
+    template <typename T, bool PackColour>
+    inline typename tree_iterator<tree_links<tree_node<T, PackColour, true> >, T>::difference_type
+    distance( tree_iterator<tree_links<tree_node<T, PackColour, true> >, T> first, tree_iterator<tree_links<tree_node<T, PackColour, true> >, T> last )
+    {
+        typedef typename tree_iterator<tree_links<tree_node<T, PackColour, true> >, T>::difference_type  difference_type;
+
+        return ( static_cast<difference_type>( tree_rank( last.links(), last.base() ) ) - static_cast<difference_type>( tree_rank( first.links(), first.base() ) ) );
+    }
+
+    template <typename T, bool PackColour>
+    inline typename tree_const_iterator<tree_links<tree_node<T, PackColour, true> >, T>::difference_type
+    distance( tree_const_iterator<tree_links<tree_node<T, PackColour, true> >, T> first, tree_const_iterator<tree_links<tree_node<T, PackColour, true> >, T> last )
+    {
+        typedef typename tree_const_iterator<tree_links<tree_node<T, PackColour, true> >, T>::difference_type  difference_type;
+
+        return ( static_cast<difference_type>( tree_rank( last.links(), last.base() ) ) - static_cast<difference_type>( tree_rank( first.links(), first.base() ) ) );
+    }
+
+
+    /* --------------------------- sorted_unique ---------------------------- */
+
+    /*
+    ** Not part of the C++98 standard (compare std::sorted_unique of C++23).
+    ** Tag for range constructors / range inserts of map and set: the caller
+    ** guarantees, that the range is sorted by the container's comparison
+    ** and free of equivalent keys, so no check is needed.
+    */
+
+    struct sorted_unique_t {};
+
+    const sorted_unique_t   sorted_unique = sorted_unique_t();
+
 
     /* --------------------------- Red Black Tree --------------------------- */
 
@@ -499,20 +1347,32 @@ namespace ft
     ** 5. For each node, all simple paths from the node to descendant leaves contain the same number of black nodes
     */
 
-    template <typename T, typename Compare, typename Allocator>
+    /*
+    ** Compare orders the keys, KeyOfValue extracts the key of a value_type
+    ** (ft::identity for set, ft::select1st for map), so all lookups only
+    ** need a key_type. If Compare is transparent (see ft::is_transparent),
+    ** find() and lower_bound() accept any type Compare can compare with a key.
+    ** If Compare is ranked (see ft::ranked), every node also stores the size
+    ** of its subtree, which nth() and rank() use to find positions in O(log n).
+    */
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue = ft::identity<T> >
     class red_black_tree
     {
 
     private:
-        typedef ft::tree_node<T>                                            node_type;
+        typedef ft::tree_node<T, ft::tree_node_packs_colour<T>::value, ft::is_ranked<Compare>::value>    node_type;
         typedef typename node_type::node_ptr                                node_type_ptr;
         typedef typename node_type::const_node_ptr                          const_node_type_ptr;
-        typedef typename node_type::node_ref                                node_type_ref;
-        typedef typename node_type::const_node_ref                          const_node_type_ref;
+        typedef typename node_type::base_type                               sentinel_type;
+        typedef typename node_type::base_ptr                                     base_ptr; // a node or a sentinel, only real nodes are cast to node_type_ptr
+        typedef typename node_type::const_base_ptr                               const_base_ptr;
+        typedef ft::tree_links<node_type>                                   links_type;
 
     public:
         typedef T                                                           value_type;
-        typedef Compare                                                     value_compare;
+        typedef typename KeyOfValue::result_type                            key_type;
+        typedef Compare                                                     key_compare;
         typedef Allocator                                                   allocator_type;
         typedef typename allocator_type::template rebind<node_type>::other  node_allocator_type;
         typedef typename allocator_type::size_type                          size_type;
@@ -521,23 +1381,29 @@ namespace ft
         typedef typename allocator_type::const_reference                    const_reference;
         typedef typename allocator_type::pointer                            pointer;
         typedef typename allocator_type::const_pointer                      const_pointer;
-        typedef ft::tree_iterator<node_type_ptr, value_type>                iterator;
-        typedef ft::tree_const_iterator<const_node_type_ptr, value_type>    const_iterator;
+        typedef ft::tree_iterator<links_type, value_type>                   iterator;
+        typedef ft::tree_const_iterator<links_type, value_type>             const_iterator;
         typedef ft::reverse_iterator<iterator>                              reverse_iterator;
         typedef ft::reverse_iterator<const_iterator>                        const_reverse_iterator;
 
     private:
-        node_type           _base; // first node in tree. _base->_left is root node
-        node_type_ptr       _null; // every node_direction without attached child points onto this node (instead of nullptr)
-        node_type_ptr       _begin_node; // left-most node, a.k.a node with smallest key
-        value_compare       _compare; 
+        struct _subtree // a detached subtree and its black height
+        {
+            base_ptr        root;
+            size_type       height;
+        };
+
+    private:
+        sentinel_type       _base; // end node, holds no value. _base._left is root node, _base._right the right-most node (&_base, if empty)
+        base_ptr            _begin_node; // left-most node, a.k.a node with smallest key
+        key_compare         _compare; 
         allocator_type      _allocator;
         node_allocator_type _node_allocator;
         size_type           _size;
 
     public:
         // Constructors / Destructor / Assignment
-        explicit red_black_tree( const value_compare& comp = Compare(), const allocator_type& alloc = Allocator() );
+        explicit red_black_tree( const key_compare& comp = Compare(), const allocator_type& alloc = Allocator() );
 	    red_black_tree( const red_black_tree& other );
         ~red_black_tree();
 
@@ -559,169 +1425,213 @@ namespace ft
 
         // Modifiers:
         ft::pair<iterator,bool> insert( const value_type& value); // single element
-        iterator insert( iterator position, const value_type& value); // with hint
+        iterator insert( const_iterator position, const value_type& value); // with hint
         template <typename InputIterator>
             void insert( InputIterator first, InputIterator last ); // range
+        template <typename InputIterator>
+            void insert( ft::sorted_unique_t, InputIterator first, InputIterator last ); // range, known to be sorted and unique
+        template <typename ValueFactory>
+            ft::pair<iterator,bool> insert_key( const key_type& key, const ValueFactory& make_value ); // make_value() is only called, if key is missing
         void erase( iterator position ); // iterator
-        size_type erase( const value_type& value); // key
-        void erase( iterator first, iterator last ); // range
+        size_type erase( const key_type& key ); // key
+        void erase( const_iterator first, const_iterator last ); // range
         void swap( red_black_tree& x );
         void clear();
+        void extract_range( const_iterator first, const_iterator last, red_black_tree& x ); // moves [first, last) into x, O(log n) (+ O(last - first) for an unranked tree)
+        void set_union( const red_black_tree& x ); // the three set operations are O(m log(n / m + 1)) with m = x.size()
+        void set_intersection( const red_black_tree& x );
+        void set_difference( const red_black_tree& x );
 
         // Operations:
-        iterator find( const value_type& value );
-        const_iterator find( const value_type& value ) const;
-        size_type count( const value_type& value ) const;
-        iterator lower_bound( const value_type& value );
-        const_iterator lower_bound( const value_type& value ) const;
-        iterator upper_bound( const value_type& value );
-        const_iterator upper_bound( const value_type& value ) const;
-        ft::pair<iterator,iterator> equal_range( const value_type& value );
-        ft::pair<const_iterator,const_iterator> equal_range( const value_type& value ) const;
+        iterator find( const key_type& key );
+        const_iterator find( const key_type& key ) const;
+        size_type count( const key_type& key ) const;
+        iterator lower_bound( const key_type& key );
+        const_iterator lower_bound( const key_type& key ) const;
+        iterator upper_bound( const key_type& key );
+        const_iterator upper_bound( const key_type& key ) const;
+        ft::pair<iterator,iterator> equal_range( const key_type& key );
+        ft::pair<const_iterator,const_iterator> equal_range( const key_type& key ) const;
+        ft::pair<iterator,iterator> bounds( const key_type& lo, const key_type& hi ); // [lower_bound( lo ), upper_bound( hi )) in one descent
+        ft::pair<const_iterator,const_iterator> bounds( const key_type& lo, const key_type& hi ) const;
+        template <typename K>
+            typename ft::enable_if<ft::is_transparent<Compare, K>::value, iterator>::type find( const K& key ); // heterogeneous lookup
+        template <typename K>
+            typename ft::enable_if<ft::is_transparent<Compare, K>::value, const_iterator>::type find( const K& key ) const;
+        template <typename K>
+            typename ft::enable_if<ft::is_transparent<Compare, K>::value, iterator>::type lower_bound( const K& key );
+        template <typename K>
+            typename ft::enable_if<ft::is_transparent<Compare, K>::value, const_iterator>::type lower_bound( const K& key ) const;
+        iterator nth( size_type n ); // element at in-order position n, end() if n >= size(). Only for a ranked Compare
+        const_iterator nth( size_type n ) const;
+        size_type rank( const key_type& key ) const; // number of elements less than key. Only for a ranked Compare
         // void debug_print() const; // only for debugging purposes // comment in for usage of debug_print()
 
         // Allocator / Compare:
         allocator_type get_allocator() const;
-        void destroy_node( node_type_ptr node );
-        value_compare value_comp() const;
+        void destroy_node( base_ptr node );
+        key_compare key_comp() const;
 
     private:
-        void _create_null();
-        void _init_root( node_type_ptr &new_node, node_type_ptr &position );
-        ft::pair<iterator, bool> _insert( node_type_ptr rootptr, const value_type& value ); // helper function for all insert methods
-        void _transplant( node_type_ptr old_subtree, node_type_ptr new_subtree ); // helper function for erase()
-        bool _node_has_children( node_type_ptr& node);
-        node_type_ptr _clone_tree( const red_black_tree& other, const node_type_ptr& other_root ); // helper function for assignment operator
-        // void _debug_print_recursive_inverted( const node_type_ptr& rootptr, int level, bool is_right ) const;  // comment in for usage of debug_print()
+        static base_ptr _null(); // every node_direction without attached child points onto links_type::null() (instead of nullptr)
+        base_ptr _end_node() const; // &_base, parent of the root node and end()
+        static node_type_ptr _node( base_ptr node ); // never for a sentinel: only a real node is a node_type
+        static const value_type& _value( const_base_ptr node ); // never for a sentinel
+        static const key_type& _key( const value_type& value ); // KeyOfValue()( value )
+        template <typename K>
+            base_ptr _find_node( const K& key ) const; // &_base, if not found
+        template <typename K>
+            base_ptr _lower_bound_node( const K& key ) const; // first node not less than key
+        template <typename K>
+            base_ptr _upper_bound_node( const K& key ) const; // first node greater than key
+        void _equal_range_nodes( const key_type& key, base_ptr& first, base_ptr& last ) const;
+        void _bounds_nodes( const key_type& lo, const key_type& hi, base_ptr& first, base_ptr& last ) const;
+        base_ptr _find_insert_position( const key_type& key, base_ptr& parent, bool& as_left_child ) const;
+        ft::pair<iterator, bool> _insert( const value_type& value ); // helper function for all insert methods
+        base_ptr _insert_node_at( base_ptr parent, bool as_left_child, base_ptr new_node ); // links a new leaf below parent and rebalances
+        template <typename InputIterator>
+            void _insert_range( InputIterator first, InputIterator last, ft::input_iterator_tag );
+        template <typename ForwardIterator>
+            void _insert_range( ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag ); // builds the tree in O(n), if the range is sorted and unique
+        template <typename InputIterator>
+            void _insert_sorted_unique( InputIterator first, InputIterator last, ft::input_iterator_tag );
+        template <typename ForwardIterator>
+            void _insert_sorted_unique( ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag ); // builds the tree in O(n), if it is empty
+        template <typename ForwardIterator>
+            bool _is_sorted_unique( ForwardIterator first, ForwardIterator last, size_type& n ) const;
+        template <typename ForwardIterator>
+            void _build_sorted( ForwardIterator first, size_type n ); // only for an empty tree
+        template <typename ForwardIterator>
+            base_ptr _build_subtree( ForwardIterator& first, size_type n, size_type depth, size_type red_depth );
+        bool _node_has_children( base_ptr& node);
+        void _clone_tree( const red_black_tree& other ); // only for an empty tree, helper function for copy constructor and assignment operator
+        base_ptr _clone_subtree( const_base_ptr other_root, const_base_ptr other_min, base_ptr& copy_min );
+        base_ptr _clone_node( const_base_ptr other_node, base_ptr parent );
+        // void _debug_print_recursive_inverted( const base_ptr& rootptr, int level, bool is_right ) const;  // comment in for usage of debug_print()
         node_type_ptr _create_node( const value_type& value );
-        void _clear( node_type_ptr& rootptr);
-        iterator _make_iter( node_type_ptr ptr );
-        const_iterator _make_iter( const_node_type_ptr ptr ) const;
-        void _left_rotate( node_type_ptr position );
-        void _right_rotate( node_type_ptr position );
-        void _tree_insert_fixup( node_type_ptr position );
-        void _tree_erase_fixup( node_type_ptr position );
+        void _clear(); // destroys all nodes, O(1) extra space
+        size_type _destroy_subtree( base_ptr root, bool deallocate );
+        static _subtree _make_subtree( base_ptr root, size_type height );
+        _subtree _whole() const;
+        void _hang( base_ptr root );
+        void _set_root( base_ptr root );
+        _subtree _join( _subtree left, base_ptr pivot, _subtree right );
+        _subtree _join2( _subtree left, _subtree right );
+        base_ptr _split( _subtree tree, const key_type& key, bool take_equal, _subtree& left, _subtree& right );
+        void _split_range( const_iterator first, const_iterator last, _subtree& left, _subtree& middle, _subtree& right );
+        _subtree _union( _subtree tree, const_base_ptr other );
+        _subtree _intersection( _subtree tree, const_base_ptr other );
+        _subtree _difference( _subtree tree, const_base_ptr other );
+        iterator _make_iter( base_ptr ptr );
+        const_iterator _make_iter( const_base_ptr ptr ) const;
+        base_ptr _nth_node( size_type n ) const;
+        static void _ranked_only( ft::true_type ); // no overload for false_type: nth() and rank() do not compile for an unranked tree
 
     }; // red_black_tree
 
     /* red_black_tree member functions */
     /* public */
 
-   template < typename T, typename Compare, typename Allocator>
-    red_black_tree<T, Compare, Allocator>::red_black_tree( const value_compare& comp, const allocator_type& alloc ) 
-    : _base(), _begin_node(&this->_base), _compare( comp ), _allocator( alloc ), _node_allocator( alloc ), _size( 0 )
+   template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    red_black_tree<T, Compare, Allocator, KeyOfValue>::red_black_tree( const key_compare& comp, const allocator_type& alloc ) 
+    : _base(), _begin_node(this->_end_node()), _compare( comp ), _allocator( alloc ), _node_allocator( alloc ), _size( 0 )
     {
-        _create_null();
-        this->_base._left = this->_null;
-        this->_begin_node = &this->_base;
+        this->_base._left = this->_null();
+        this->_base._right = this->_end_node();
+        this->_begin_node = this->_end_node();
     }
 
-    template < typename T, typename Compare, typename Allocator>
-    red_black_tree<T, Compare, Allocator>::red_black_tree( const red_black_tree& src )
-    : _base(), _begin_node(&this->_base), _compare( src._compare ), _allocator( src._allocator ), _node_allocator( src._node_allocator ), _size( src._size )
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    red_black_tree<T, Compare, Allocator, KeyOfValue>::red_black_tree( const red_black_tree& src )
+    : _base(), _begin_node(this->_end_node()), _compare( src._compare ), _allocator( src._allocator ), _node_allocator( src._node_allocator ), _size( 0 )
     {
-        _create_null();
-        this->_base._left = this->_null;
-        this->_begin_node = &this->_base;
-        if ( src._base._left != nullptr )
-        {
-            this->_base._left = this->_clone_tree( src, src._base._left );
-            this->_base._left->_parent = &this->_base;
-            this->_begin_node = tree_min<T>( this->_base._left );
-        }
+        this->_base._left = this->_null();
+        this->_base._right = this->_end_node();
+        this->_begin_node = this->_end_node();
+        this->_clone_tree( src );
     }
 
-    template < typename T, typename Compare, typename Allocator>
-    red_black_tree<T, Compare, Allocator>::~red_black_tree()
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    red_black_tree<T, Compare, Allocator, KeyOfValue>::~red_black_tree()
     {
-        if (this->_base._left != this->_null)
+        if (this->_base._left != this->_null())
         {
             this->clear();
-            this->_base._left = this->_null;
+            this->_base._left = this->_null();
             this->_begin_node = this->_base._left;
         }
-        if (this->_null != nullptr)
-            destroy_node( this->_null );
     }
 
 
-    template < typename T, typename Compare, typename Allocator>
-    red_black_tree<T, Compare, Allocator>& red_black_tree<T, Compare, Allocator>::operator=( const red_black_tree& other )
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    red_black_tree<T, Compare, Allocator, KeyOfValue>& red_black_tree<T, Compare, Allocator, KeyOfValue>::operator=( const red_black_tree& other )
     {
         if ( this != &other )
         {
             this->clear();
-            this->_allocator = other._allocator;
-            this->_node_allocator = other._node_allocator;
             this->_compare = other._compare;
-            if ( other._base._left != other._null )
-            {
-                this->_base._left = this->_clone_tree( other, other._base._left );
-                this->_begin_node = tree_min<T>( this->_base._left );
-            }
-            this->_size = other._size;
-            this->_base._left->_parent = &this->_base;
+            this->_clone_tree( other );
         }
         return ( *( this ) );
     }
 
 
-    template < typename T, typename Compare, typename Allocator>
-    typename red_black_tree<T, Compare, Allocator>::iterator red_black_tree<T, Compare, Allocator>::begin()
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::iterator red_black_tree<T, Compare, Allocator, KeyOfValue>::begin()
     {
         return ( iterator( this->_begin_node ) );
     }
 
-    template < typename T, typename Compare, typename Allocator>
-    typename red_black_tree<T, Compare, Allocator>::const_iterator red_black_tree<T, Compare, Allocator>::begin() const
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::const_iterator red_black_tree<T, Compare, Allocator, KeyOfValue>::begin() const
     {
         return ( const_iterator( this->_begin_node ) );
     }
 
-    template < typename T, typename Compare, typename Allocator>
-    typename red_black_tree<T, Compare, Allocator>::iterator red_black_tree<T, Compare, Allocator>::end()
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::iterator red_black_tree<T, Compare, Allocator, KeyOfValue>::end()
     {
-        return ( iterator( &this->_base ) );
+        return ( iterator( this->_end_node() ) );
     }
 
-    template < typename T, typename Compare, typename Allocator>
-    typename red_black_tree<T, Compare, Allocator>::const_iterator red_black_tree<T, Compare, Allocator>::end() const
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::const_iterator red_black_tree<T, Compare, Allocator, KeyOfValue>::end() const
     {
-        return ( const_iterator( &this->_base ) );
+        return ( const_iterator( this->_end_node() ) );
     }
 
-    template < typename T, typename Compare, typename Allocator>
-    typename red_black_tree<T, Compare, Allocator>::reverse_iterator red_black_tree<T, Compare, Allocator>::rbegin()
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::reverse_iterator red_black_tree<T, Compare, Allocator, KeyOfValue>::rbegin()
     {
-        return ( reverse_iterator( &this->_base ) );
+        return ( reverse_iterator( this->_end_node() ) );
     }
 
-    template < typename T, typename Compare, typename Allocator>
-    typename red_black_tree<T, Compare, Allocator>::const_reverse_iterator red_black_tree<T, Compare, Allocator>::rbegin() const
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::const_reverse_iterator red_black_tree<T, Compare, Allocator, KeyOfValue>::rbegin() const
     {
-        return ( const_reverse_iterator( &this->_base ) );
+        return ( const_reverse_iterator( this->_end_node() ) );
     }
 
-    template < typename T, typename Compare, typename Allocator>
-    typename red_black_tree<T, Compare, Allocator>::reverse_iterator red_black_tree<T, Compare, Allocator>::rend()
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::reverse_iterator red_black_tree<T, Compare, Allocator, KeyOfValue>::rend()
     {
         return ( reverse_iterator( this->_begin_node ) );
     }
 
-    template < typename T, typename Compare, typename Allocator>
-    typename red_black_tree<T, Compare, Allocator>::const_reverse_iterator red_black_tree<T, Compare, Allocator>::rend() const
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::const_reverse_iterator red_black_tree<T, Compare, Allocator, KeyOfValue>::rend() const
     {
         return ( const_reverse_iterator( this->_begin_node ) );
     }
 
-    template < typename T, typename Compare, typename Allocator>
-    typename red_black_tree<T, Compare, Allocator>::size_type red_black_tree<T, Compare, Allocator>::size() const
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::size_type red_black_tree<T, Compare, Allocator, KeyOfValue>::size() const
     {
         return ( this->_size);
     }
 
-    template < typename T, typename Compare, typename Allocator>
-    typename red_black_tree<T, Compare, Allocator>::size_type red_black_tree<T, Compare, Allocator>::max_size() const
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::size_type red_black_tree<T, Compare, Allocator, KeyOfValue>::max_size() const
     {
         size_type alloc_max = this->_node_allocator.max_size();
         size_type numeric_max = std::numeric_limits<difference_type>::max();
@@ -737,444 +1647,770 @@ namespace ft
     // An alternative way to insert elements in a map is by using member function map::operator[].
     // Internally, map containers keep all their elements sorted by their key following the criterion specified by its comparison object. The elements are always inserted in its respective position following this ordering.
     // The parameters determine how many elements are inserted and to which values they are initialized:
-    template < typename T, typename Compare, typename Allocator>
-    ft::pair<typename red_black_tree<T, Compare, Allocator>::iterator, bool> red_black_tree<T, Compare, Allocator>::insert( const value_type& value)
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    ft::pair<typename red_black_tree<T, Compare, Allocator, KeyOfValue>::iterator, bool> red_black_tree<T, Compare, Allocator, KeyOfValue>::insert( const value_type& value)
     {
-        return ( this->_insert( this->_base._left, value ) );
+        return ( this->_insert( value ) );
     }
 
-    template < typename T, typename Compare, typename Allocator>
-    typename red_black_tree<T, Compare, Allocator>::iterator red_black_tree<T, Compare, Allocator>::insert( __attribute__( ( unused ) ) iterator position, const value_type& value)
+    // If value belongs directly before or after position, it is linked there
+    // without a search (amortized constant), otherwise a full insert is done.
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::iterator red_black_tree<T, Compare, Allocator, KeyOfValue>::insert( const_iterator position, const value_type& value)
     {
-        // TASK: rewrite the hint part:
-        // if the element is smaller than 'value', and the successor bigger, insert here.
+        base_ptr        parent = this->_null(); // only set, if found is null()
+        bool            as_left_child = false;
+        base_ptr        found = tree_hint_insert_position( links_type(), this->_end_node(), this->_begin_node, position.base(), _key( value ), KeyOfValue(), this->_compare, parent, as_left_child );
 
-        return ( this->_insert( this->_base._left, value ).first );
+        if ( found != this->_null() )
+            return ( this->_make_iter( found ) );
+        return ( this->_make_iter( this->_insert_node_at( parent, as_left_child, this->_create_node( value ) ) ) );
     }
 
-    template < typename T, typename Compare, typename Allocator>
+    // A sorted and unique forward range inserted into an empty tree is built
+    // bottom up in O(n), everything else is inserted element by element.
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
     template <typename InputIterator>
-    void red_black_tree<T, Compare, Allocator>::insert( InputIterator first, InputIterator last )
+    void red_black_tree<T, Compare, Allocator, KeyOfValue>::insert( InputIterator first, InputIterator last )
     {
-        for ( ; first != last; ++first )
-            this->insert( *( first ) );
+        this->_insert_range( first, last, typename ft::iterator_traits<InputIterator>::iterator_category() );
     }
 
-    template < typename T, typename Compare, typename Allocator>
-    void red_black_tree<T, Compare, Allocator>::erase( iterator position )
+    // The caller guarantees, that [first, last) is sorted and unique.
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    template <typename InputIterator>
+    void red_black_tree<T, Compare, Allocator, KeyOfValue>::insert( ft::sorted_unique_t, InputIterator first, InputIterator last )
     {
-        node_type_ptr node = position.base();
+        this->_insert_sorted_unique( first, last, typename ft::iterator_traits<InputIterator>::iterator_category() );
+    }
 
-        if ( node == &this->_base || node == this->_null )
-            return ;
+    // Like insert( make_value() ), but with a single descent by key: the value
+    // is only built (and a node allocated), if key is not yet in the tree.
+    // _key( make_value() ) has to be equivalent to key.
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    template <typename ValueFactory>
+    ft::pair<typename red_black_tree<T, Compare, Allocator, KeyOfValue>::iterator, bool> red_black_tree<T, Compare, Allocator, KeyOfValue>::insert_key( const key_type& key, const ValueFactory& make_value )
+    {
+        base_ptr        parent;
+        bool            as_left_child;
+        base_ptr        found = this->_find_insert_position( key, parent, as_left_child );
+
+        if ( found != this->_null() )
+            return ( ft::make_pair( this->_make_iter( found ), false ) );
+        return ( ft::make_pair( this->_make_iter( this->_insert_node_at( parent, as_left_child, this->_create_node( make_value() ) ) ), true ) );
+    }
 
-        node_type_ptr   track_node = node;
-        node_state      original_track_node_colour = track_node->_colour;
-        node_type_ptr   replacement = &this->_base;
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void red_black_tree<T, Compare, Allocator, KeyOfValue>::erase( iterator position )
+    {
+        base_ptr node = position.base();
 
-        if ( node->_left == this->_null )
+        if ( node == this->_end_node() || node == this->_null() )
+            return ;
+        if ( node == this->_begin_node )
+        {
+            if ( node->_right != this->_null() )
+                this->_begin_node = tree_min( links_type(), node->_right );
+            else
+                this->_begin_node = this->_begin_node->get_parent();
+        }
+        if ( node == this->_base._right )
         {
-            replacement = node->_right;
-            this->_transplant( node, node->_right );
+            if ( node->_left != this->_null() )
+                this->_base._right = tree_max( links_type(), node->_left );
+            else
+                this->_base._right = node->get_parent();
         }
-        else if ( node->_right == this->_null )
+        tree_unlink( links_type(), node, this->_end_node() );
+        this->destroy_node( node );
+        --( this->_size );
+    }
+
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::size_type red_black_tree<T, Compare, Allocator, KeyOfValue>::erase( const key_type& key )
+    {
+        iterator find_return = this->find( key );
+
+        if ( find_return == this->end() )
+            return ( 0 );
+        this->erase( find_return );
+        return ( 1 );
+    }
+
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void red_black_tree<T, Compare, Allocator, KeyOfValue>::erase( const_iterator first, const_iterator last )
+    {
+        _subtree    left;
+        _subtree    middle;
+        _subtree    right;
+
+        if ( first == last )
+            return ;
+        if ( first == this->begin() && last == this->end() )
         {
-            replacement = node->_left;
-            this->_transplant( node, node->_left );
+            this->clear();
+            return ;
         }
+        this->_split_range( first, last, left, middle, right );
+        this->_size -= this->_destroy_subtree( middle.root, true );
+        this->_set_root( this->_join2( left, right ).root );
+    }
+
+    // Moves [first, last) into x, which is cleared and gets a copy of the
+    // allocators and the comparison object, so it can later free the nodes.
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void red_black_tree<T, Compare, Allocator, KeyOfValue>::extract_range( const_iterator first, const_iterator last, red_black_tree& x )
+    {
+        size_type   n = static_cast<size_type>( ft::distance( first, last ) );
+        _subtree    left;
+        _subtree    middle;
+        _subtree    right;
+
+        if ( this == &x )
+            return ;
+        x.clear();
+        x._compare = this->_compare;
+        x._allocator = this->_allocator;
+        x._node_allocator = this->_node_allocator;
+        if ( first == last )
+            return ;
+        this->_split_range( first, last, left, middle, right );
+        this->_set_root( this->_join2( left, right ).root );
+        this->_size -= n;
+        x._set_root( middle.root );
+        x._size = n;
+    }
+
+    // Inserts copies of the elements of x that are not in this tree yet.
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void red_black_tree<T, Compare, Allocator, KeyOfValue>::set_union( const red_black_tree& x )
+    {
+        if ( this != &x )
+            this->_set_root( this->_union( this->_whole(), x._base._left ).root );
+    }
+
+    // Erases the elements that are not in x.
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void red_black_tree<T, Compare, Allocator, KeyOfValue>::set_intersection( const red_black_tree& x )
+    {
+        if ( this != &x )
+            this->_set_root( this->_intersection( this->_whole(), x._base._left ).root );
+    }
+
+    // Erases the elements that are in x.
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void red_black_tree<T, Compare, Allocator, KeyOfValue>::set_difference( const red_black_tree& x )
+    {
+        if ( this == &x )
+            this->clear();
         else
+            this->_set_root( this->_difference( this->_whole(), x._base._left ).root );
+    }
+
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void red_black_tree<T, Compare, Allocator, KeyOfValue>::swap( red_black_tree& x )
+    {
+        if ( this != &x )
         {
-            track_node = tree_min<T>( node->_right );
-            original_track_node_colour = track_node->_colour;
-            replacement = track_node->_right;
-            if ( track_node->_parent == node )
-                replacement->_parent = track_node;
+            ft::swap( this->_base._left, x._base._left );
+            ft::swap( this->_base._right, x._base._right );
+            ft::swap( this->_begin_node, x._begin_node );
+            ft::swap( this->_node_allocator, x._node_allocator );
+            ft::swap( this->_allocator, x._allocator );
+            ft::swap( this->_compare, x._compare );
+            ft::swap( this->_size, x._size );
+            if ( this->_size == 0 )
+            {
+                this->_begin_node = this->_end_node();
+                this->_base._left = this->_null();
+                this->_base._right = this->_end_node();
+            }
             else
             {
-                this->_transplant( track_node, track_node->_right );
-                track_node->_right = node->_right;
-                track_node->_right->_parent = track_node;
+                this->_base._left->set_parent( this->_end_node() );
+            }
+            if ( x._size == 0 )
+            {
+                x._begin_node = x._end_node();
+                x._base._left = x._null();
+                x._base._right = x._end_node();
             }
-            this->_transplant( node, track_node );
-            track_node->_left = node->_left;
-            track_node->_left->_parent = track_node;
-            track_node->_colour = node->_colour;
+            else
+                x._base._left->set_parent( x._end_node() );
         }
-        if ( node == this->_begin_node )
+    }
+
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void red_black_tree<T, Compare, Allocator, KeyOfValue>::clear()
+    {
+        if ( this->_base._left != this->_null() )
+            this->_clear();
+        this->_begin_node = this->_end_node();
+        this->_base._right = this->_end_node();
+    }
+
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::iterator red_black_tree<T, Compare, Allocator, KeyOfValue>::find( const key_type& key )
+    {
+        return ( iterator( this->_find_node( key ) ) );
+    }
+
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::const_iterator red_black_tree<T, Compare, Allocator, KeyOfValue>::find( const key_type& key ) const
+    {
+        return ( const_iterator( this->_find_node( key ) ) );
+    }
+
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::size_type red_black_tree<T, Compare, Allocator, KeyOfValue>::count( const key_type& key ) const
+    {
+        return ( ( this->_find_node( key ) == this->_end_node() ) ? 0 : 1 );
+    }
+
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::iterator red_black_tree<T, Compare, Allocator, KeyOfValue>::lower_bound( const key_type& key )
+    {
+        return ( iterator( this->_lower_bound_node( key ) ) );
+    }
+
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::const_iterator red_black_tree<T, Compare, Allocator, KeyOfValue>::lower_bound( const key_type& key ) const
+    {
+        return ( const_iterator( this->_lower_bound_node( key ) ) );
+    }
+
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::iterator red_black_tree<T, Compare, Allocator, KeyOfValue>::upper_bound( const key_type& key )
+    {
+        return ( iterator( this->_upper_bound_node( key ) ) );
+    }
+
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::const_iterator red_black_tree<T, Compare, Allocator, KeyOfValue>::upper_bound( const key_type& key ) const
+    {
+        return ( const_iterator( this->_upper_bound_node( key ) ) );
+    }
+
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    ft::pair<typename red_black_tree<T, Compare, Allocator, KeyOfValue>::const_iterator,
+        typename red_black_tree<T, Compare, Allocator, KeyOfValue>::const_iterator> 
+        red_black_tree<T, Compare, Allocator, KeyOfValue>::equal_range( const key_type& k ) const
+    {
+        base_ptr        first;
+        base_ptr        last;
+
+        this->_equal_range_nodes( k, first, last );
+        return ( ft::make_pair( const_iterator( first ), const_iterator( last ) ) );
+    }
+
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    ft::pair<typename red_black_tree<T, Compare, Allocator, KeyOfValue>::iterator,
+        typename red_black_tree<T, Compare, Allocator, KeyOfValue>::iterator> 
+        red_black_tree<T, Compare, Allocator, KeyOfValue>::equal_range( const key_type& k )
+    {
+        base_ptr        first;
+        base_ptr        last;
+
+        this->_equal_range_nodes( k, first, last );
+        return ( ft::make_pair( iterator( first ), iterator( last ) ) );
+    }
+
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    ft::pair<typename red_black_tree<T, Compare, Allocator, KeyOfValue>::iterator,
+        typename red_black_tree<T, Compare, Allocator, KeyOfValue>::iterator>
+        red_black_tree<T, Compare, Allocator, KeyOfValue>::bounds( const key_type& lo, const key_type& hi )
+    {
+        base_ptr        first;
+        base_ptr        last;
+
+        this->_bounds_nodes( lo, hi, first, last );
+        return ( ft::make_pair( iterator( first ), iterator( last ) ) );
+    }
+
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    ft::pair<typename red_black_tree<T, Compare, Allocator, KeyOfValue>::const_iterator,
+        typename red_black_tree<T, Compare, Allocator, KeyOfValue>::const_iterator>
+        red_black_tree<T, Compare, Allocator, KeyOfValue>::bounds( const key_type& lo, const key_type& hi ) const
+    {
+        base_ptr        first;
+        base_ptr        last;
+
+        this->_bounds_nodes( lo, hi, first, last );
+        return ( ft::make_pair( const_iterator( first ), const_iterator( last ) ) );
+    }
+
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::iterator red_black_tree<T, Compare, Allocator, KeyOfValue>::nth( size_type n )
+    {
+        return ( iterator( this->_nth_node( n ) ) );
+    }
+
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::const_iterator red_black_tree<T, Compare, Allocator, KeyOfValue>::nth( size_type n ) const
+    {
+        return ( const_iterator( this->_nth_node( n ) ) );
+    }
+
+    // Like lower_bound(), but adds up the left subtrees it passes instead of remembering a node.
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::size_type red_black_tree<T, Compare, Allocator, KeyOfValue>::rank( const key_type& key ) const
+    {
+        base_ptr        rootptr = this->_base._left;
+        size_type       rank = 0;
+
+        _ranked_only( typename ft::is_ranked<Compare>::type() );
+        while ( rootptr != this->_null() )
         {
-            if ( node->_right != this->_null )
-                this->_begin_node = tree_min<T>( node->_right );
+            if ( this->_compare( _key( _value( rootptr ) ), key ) )
+            {
+                rank += tree_count( links_type(), rootptr->_left ) + 1;
+                rootptr = rootptr->_right;
+            }
             else
-                this->_begin_node = this->_begin_node->_parent;
+                rootptr = rootptr->_left;
         }
-        if ( original_track_node_colour == BLACK )
-            _tree_erase_fixup( replacement );
-        this->destroy_node( node );
-        --( this->_size );
+        return ( rank );
     }
 
-    template < typename T, typename Compare, typename Allocator>
-    typename red_black_tree<T, Compare, Allocator>::size_type red_black_tree<T, Compare, Allocator>::erase( const value_type& value)
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    template <typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename red_black_tree<T, Compare, Allocator, KeyOfValue>::iterator>::type
+    red_black_tree<T, Compare, Allocator, KeyOfValue>::find( const K& key )
     {
-        iterator find_return = this->find( value );
+        return ( iterator( this->_find_node( key ) ) );
+    }
 
-        if ( find_return == this->end() )
-            return ( 0 );
-        this->erase( find_return );
-        return ( 1 );
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    template <typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename red_black_tree<T, Compare, Allocator, KeyOfValue>::const_iterator>::type
+    red_black_tree<T, Compare, Allocator, KeyOfValue>::find( const K& key ) const
+    {
+        return ( const_iterator( this->_find_node( key ) ) );
+    }
+
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    template <typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename red_black_tree<T, Compare, Allocator, KeyOfValue>::iterator>::type
+    red_black_tree<T, Compare, Allocator, KeyOfValue>::lower_bound( const K& key )
+    {
+        return ( iterator( this->_lower_bound_node( key ) ) );
+    }
+
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    template <typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename red_black_tree<T, Compare, Allocator, KeyOfValue>::const_iterator>::type
+    red_black_tree<T, Compare, Allocator, KeyOfValue>::lower_bound( const K& key ) const
+    {
+        return ( const_iterator( this->_lower_bound_node( key ) ) );
+    }
+
+    // // for debugging purposes only  // comment in for usage of debug_print()
+    // template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    // void red_black_tree<T, Compare, Allocator, KeyOfValue>::debug_print() const
+    // {
+    //     _debug_print_recursive_inverted( this->_base._left, 0, false );
+    // }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::allocator_type red_black_tree<T, Compare, Allocator, KeyOfValue>::get_allocator() const
+    {
+        return ( this->_allocator );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void red_black_tree<T, Compare, Allocator, KeyOfValue>::destroy_node( base_ptr node )
+    {
+        if ( node != nullptr )
+        {
+            this->_allocator.destroy( &( _node( node )->_data ) );
+            this->_node_allocator.deallocate( _node( node ), 1 );
+        }
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::key_compare red_black_tree<T, Compare, Allocator, KeyOfValue>::key_comp() const
+    {
+        return ( this->_compare );
+    }
+
+    /* private */
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    inline typename red_black_tree<T, Compare, Allocator, KeyOfValue>::base_ptr red_black_tree<T, Compare, Allocator, KeyOfValue>::_null()
+    {
+        return ( links_type::null() );
     }
 
-    template < typename T, typename Compare, typename Allocator>
-    void red_black_tree<T, Compare, Allocator>::erase( iterator first, iterator last )
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    inline typename red_black_tree<T, Compare, Allocator, KeyOfValue>::base_ptr red_black_tree<T, Compare, Allocator, KeyOfValue>::_end_node() const
     {
-        while ( first != last )
-            this->erase( first++ );
+        return ( const_cast<base_ptr>( &this->_base ) );
     }
 
-    template < typename T, typename Compare, typename Allocator>
-    void red_black_tree<T, Compare, Allocator>::swap( red_black_tree& x )
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::base_ptr red_black_tree<T, Compare, Allocator, KeyOfValue>::_nth_node( size_type n ) const
     {
-        if ( this != &x )
+        base_ptr        rootptr = this->_base._left;
+
+        _ranked_only( typename ft::is_ranked<Compare>::type() );
+        if ( n >= this->_size )
+            return ( this->_end_node() );
+        for ( ; ; )
         {
-            ft::swap( this->_null, x._null );
-            ft::swap( this->_base._left, x._base._left );
-            ft::swap( this->_begin_node, x._begin_node );
-            ft::swap( this->_node_allocator, x._node_allocator );
-            ft::swap( this->_allocator, x._allocator );
-            ft::swap( this->_compare, x._compare );
-            ft::swap( this->_size, x._size );
-            if ( this->_size == 0 )
-            {
-                this->_begin_node = &this->_base;
-                this->_base._left = this->_null;
-            }
+            size_type   left_count = tree_count( links_type(), rootptr->_left );
+
+            if ( n < left_count )
+                rootptr = rootptr->_left;
+            else if ( n == left_count )
+                return ( rootptr );
             else
             {
-                this->_base._left->_parent = &this->_base;
-            }
-            if ( x._size == 0 )
-            {
-                x._begin_node = &x._base;
-                x._base._left = x._null;
+                n -= left_count + 1;
+                rootptr = rootptr->_right;
             }
-            else
-                x._base._left->_parent = &x._base;
         }
     }
 
-    template < typename T, typename Compare, typename Allocator>
-    void red_black_tree<T, Compare, Allocator>::clear()
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    inline void red_black_tree<T, Compare, Allocator, KeyOfValue>::_ranked_only( ft::true_type ) {}
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    inline typename red_black_tree<T, Compare, Allocator, KeyOfValue>::node_type_ptr red_black_tree<T, Compare, Allocator, KeyOfValue>::_node( base_ptr node )
     {
-        if ( this->_base._left != this->_null )
-        {
-            _clear( this->_base._left );
-            this->_base._left = this->_null;
-        }
-        this->_begin_node = &this->_base;
+        return ( static_cast<node_type_ptr>( node ) );
     }
 
-    template < typename T, typename Compare, typename Allocator>
-    typename red_black_tree<T, Compare, Allocator>::iterator red_black_tree<T, Compare, Allocator>::find( const value_type& value)
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    inline const typename red_black_tree<T, Compare, Allocator, KeyOfValue>::value_type& red_black_tree<T, Compare, Allocator, KeyOfValue>::_value( const_base_ptr node )
     {
-        node_type_ptr rootptr = this->_base._left;
-
-        while ( rootptr != this->_null )
-        {
-            if ( this->_compare( value, rootptr->_data ) )
-                rootptr = rootptr->_left;
-            else if ( this->_compare( rootptr->_data, value ) )
-                rootptr = rootptr->_right;
-            else
-                return ( iterator( rootptr ) );
-        }
-        return ( &this->_base );
+        return ( static_cast<const_node_type_ptr>( node )->_data );
     }
 
-    template < typename T, typename Compare, typename Allocator>
-    typename red_black_tree<T, Compare, Allocator>::const_iterator red_black_tree<T, Compare, Allocator>::find( const value_type& value) const
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    inline const typename red_black_tree<T, Compare, Allocator, KeyOfValue>::key_type& red_black_tree<T, Compare, Allocator, KeyOfValue>::_key( const value_type& value )
     {
-        const_node_type_ptr rootptr = this->_base._left;
-
-        while ( rootptr != this->_null )
-        {
-            if ( this->_compare( value, rootptr->_data ) )
-                rootptr = rootptr->_left;
-            else if ( this->_compare( rootptr->_data, value ) )
-                rootptr = rootptr->_right;
-            else
-                return ( const_iterator( rootptr ) );
-        }
-        return ( &this->_base );
+        return ( KeyOfValue()( value ) );
     }
 
-    template < typename T, typename Compare, typename Allocator>
-    typename red_black_tree<T, Compare, Allocator>::size_type red_black_tree<T, Compare, Allocator>::count( const value_type& value) const
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    template <typename K>
+    inline typename red_black_tree<T, Compare, Allocator, KeyOfValue>::base_ptr red_black_tree<T, Compare, Allocator, KeyOfValue>::_find_node( const K& key ) const
     {
-        return ( ( this->find( value ).base() == &this->_base ) ? 0 : 1 );
+        return ( tree_find( links_type(), this->_end_node(), key, KeyOfValue(), this->_compare ) );
     }
 
-    template < typename T, typename Compare, typename Allocator>
-    typename red_black_tree<T, Compare, Allocator>::iterator red_black_tree<T, Compare, Allocator>::lower_bound( const value_type& value)
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    template <typename K>
+    inline typename red_black_tree<T, Compare, Allocator, KeyOfValue>::base_ptr red_black_tree<T, Compare, Allocator, KeyOfValue>::_lower_bound_node( const K& key ) const
     {
-        node_type_ptr       rootptr = this->_base._left;
-        node_type_ptr       position = const_cast<node_type_ptr>( &this->_base );
+        return ( tree_lower_bound( links_type(), this->_end_node(), key, KeyOfValue(), this->_compare ) );
+    }
 
-        while ( rootptr != this->_null )
-        {
-            if ( !( this->_compare( rootptr->_data, value ) ) )
-            {
-                position = rootptr;
-                rootptr = rootptr->_left;
-            }
-            else
-                rootptr = rootptr->_right;
-        }
-        return ( iterator( position ) );
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    template <typename K>
+    inline typename red_black_tree<T, Compare, Allocator, KeyOfValue>::base_ptr red_black_tree<T, Compare, Allocator, KeyOfValue>::_upper_bound_node( const K& key ) const
+    {
+        return ( tree_upper_bound( links_type(), this->_end_node(), key, KeyOfValue(), this->_compare ) );
     }
 
-    template < typename T, typename Compare, typename Allocator>
-    typename red_black_tree<T, Compare, Allocator>::const_iterator red_black_tree<T, Compare, Allocator>::lower_bound( const value_type& value) const
+    // Keys are unique: one descent finds the equivalent node, the end of the
+    // range is its successor, which needs no further comparisons.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void red_black_tree<T, Compare, Allocator, KeyOfValue>::_equal_range_nodes( const key_type& key, base_ptr& first, base_ptr& last ) const
     {
-        const_node_type_ptr rootptr = this->_base._left;
-        const_node_type_ptr position = const_cast<const_node_type_ptr>( &this->_base );
+        base_ptr            rootptr = this->_base._left;
 
-        while ( rootptr != this->_null )
+        last = this->_end_node();
+        while ( rootptr != this->_null() )
         {
-            if ( !( this->_compare( rootptr->_data, value ) ) )
+            if ( this->_compare( key, _key( _value( rootptr ) ) ) )
             {
-                position = rootptr;
+                last = rootptr;
                 rootptr = rootptr->_left;
             }
-            else
+            else if ( this->_compare( _key( _value( rootptr ) ), key ) )
                 rootptr = rootptr->_right;
+            else
+            {
+                first = rootptr;
+                if ( rootptr->_right != this->_null() )
+                    last = tree_min( links_type(), rootptr->_right );
+                return ;
+            }
         }
-        return ( const_iterator( position ) );
+        first = last;
     }
 
-    template < typename T, typename Compare, typename Allocator>
-    typename red_black_tree<T, Compare, Allocator>::iterator red_black_tree<T, Compare, Allocator>::upper_bound( const value_type& value)
+    // lower_bound( lo ) and upper_bound( hi ) share the descent as long as a
+    // node is outside of [lo, hi], at the first node inside the two searches
+    // part: lo is looked for in its left, hi in its right subtree.
+    // For hi < lo the range is empty, both ends are lower_bound( lo ).
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void red_black_tree<T, Compare, Allocator, KeyOfValue>::_bounds_nodes( const key_type& lo, const key_type& hi, base_ptr& first, base_ptr& last ) const
     {
-        node_type_ptr       rootptr = this->_base._left;
-        node_type_ptr       position = const_cast<node_type_ptr>( &this->_base );
+        base_ptr            rootptr = this->_base._left;
+        base_ptr            node;
 
-        while ( rootptr != this->_null )
+        first = this->_end_node();
+        last = this->_end_node();
+        if ( this->_compare( hi, lo ) )
         {
-            if ( this->_compare( value, rootptr->_data ) )
+            first = this->_lower_bound_node( lo );
+            last = first;
+            return ;
+        }
+        while ( rootptr != this->_null() )
+        {
+            if ( this->_compare( _key( _value( rootptr ) ), lo ) )
+                rootptr = rootptr->_right;
+            else if ( this->_compare( hi, _key( _value( rootptr ) ) ) )
             {
-                position = rootptr;
+                first = rootptr;
+                last = rootptr;
                 rootptr = rootptr->_left;
             }
             else
-                rootptr = rootptr->_right;
+                break ;
         }
-        return ( iterator( position ) );
-    }
-
-    template < typename T, typename Compare, typename Allocator>
-    typename red_black_tree<T, Compare, Allocator>::const_iterator red_black_tree<T, Compare, Allocator>::upper_bound( const value_type& value) const
-    {
-        const_node_type_ptr rootptr = this->_base._left;
-        const_node_type_ptr position = const_cast<const_node_type_ptr>( &this->_base );
-
-        while ( rootptr != this->_null )
+        if ( rootptr == this->_null() )
+            return ;
+        first = rootptr;
+        for ( node = rootptr->_left; node != this->_null(); ) // lower_bound( lo )
         {
-            if ( this->_compare( value, rootptr->_data ) )
+            if ( !( this->_compare( _key( _value( node ) ), lo ) ) )
             {
-                position = rootptr;
-                rootptr = rootptr->_left;
+                first = node;
+                node = node->_left;
             }
             else
-                rootptr = rootptr->_right;
+                node = node->_right;
         }
-        return ( const_iterator( position ) );
-    }
-
-    template < typename T, typename Compare, typename Allocator>
-    ft::pair<typename red_black_tree<T, Compare, Allocator>::const_iterator,
-        typename red_black_tree<T, Compare, Allocator>::const_iterator> 
-        red_black_tree<T, Compare, Allocator>::equal_range( const value_type& k ) const
-    {
-        const_node_type_ptr                 rootptr = this->_base._left;
-        const_node_type_ptr                 position = const_cast<const_node_type_ptr>( &this->_base );
-
-        while ( rootptr != this->_null )
+        for ( node = rootptr->_right; node != this->_null(); ) // upper_bound( hi )
         {
-            if ( this->_compare( k, rootptr->_data ) )
+            if ( this->_compare( hi, _key( _value( node ) ) ) )
             {
-                position = rootptr;
-                rootptr = rootptr->_left;
+                last = node;
+                node = node->_left;
             }
-            else if ( this->_compare( rootptr->_data, k ) )
-                rootptr = rootptr->_right;
             else
-                return ( ft::make_pair( const_iterator( rootptr ), const_iterator( rootptr->_right != this->_null ? tree_min<value_type>( rootptr->_right) : position ) ) );
+                node = node->_right;
         }
-        return ( ft::make_pair( const_iterator( position ), const_iterator( position ) ) );
     }
 
-    template < typename T, typename Compare, typename Allocator>
-    ft::pair<typename red_black_tree<T, Compare, Allocator>::iterator,
-        typename red_black_tree<T, Compare, Allocator>::iterator> 
-        red_black_tree<T, Compare, Allocator>::equal_range( const value_type& k )
+    // Descends first and only allocates a node, if value is not yet part of the tree.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    ft::pair<typename red_black_tree<T, Compare, Allocator, KeyOfValue>::iterator, bool> red_black_tree<T, Compare, Allocator, KeyOfValue>::_insert( const value_type& value )
     {
-        node_type_ptr                       rootptr = this->_base._left;
-        node_type_ptr                       position = &this->_base;
+        base_ptr        parent;
+        bool            as_left_child;
+        base_ptr        found = this->_find_insert_position( _key( value ), parent, as_left_child );
 
-        while ( rootptr != this->_null )
-        {
-            if ( this->_compare( k, rootptr->_data ) )
-            {
-                position = rootptr;
-                rootptr = rootptr->_left;
-            }
-            else if ( this->_compare( rootptr->_data, k ) )
-                rootptr = rootptr->_right;
-            else
-                return ( ft::make_pair( iterator( rootptr ), iterator( rootptr->_right != this->_null ? tree_min<value_type>( rootptr->_right) : position ) ) );
-        }
-        return ( ft::make_pair( iterator( position ), iterator( position ) ) );
+        if ( found != this->_null() )
+            return ( ft::make_pair( this->_make_iter( found ), false ) );
+        return ( ft::make_pair( this->_make_iter( this->_insert_node_at( parent, as_left_child, this->_create_node( value ) ) ), true ) );
     }
 
-    // // for debugging purposes only  // comment in for usage of debug_print()
-    // template <typename T, typename Compare, typename Allocator>
-    // void red_black_tree<T, Compare, Allocator>::debug_print() const
-    // {
-    //     _debug_print_recursive_inverted( this->_base._left, 0, false );
-    // }
-
-    template <typename T, typename Compare, typename Allocator>
-    typename red_black_tree<T, Compare, Allocator>::allocator_type red_black_tree<T, Compare, Allocator>::get_allocator() const
+    // null(), if key is not yet part of the tree (see tree_find_insert_position())
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    inline typename red_black_tree<T, Compare, Allocator, KeyOfValue>::base_ptr
+    red_black_tree<T, Compare, Allocator, KeyOfValue>::_find_insert_position( const key_type& key, base_ptr& parent, bool& as_left_child ) const
     {
-        return ( this->_allocator );
+        return ( tree_find_insert_position( links_type(), this->_end_node(), key, KeyOfValue(), this->_compare, parent, as_left_child ) );
     }
 
-    template <typename T, typename Compare, typename Allocator>
-    void red_black_tree<T, Compare, Allocator>::destroy_node( node_type_ptr node )
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::base_ptr
+    red_black_tree<T, Compare, Allocator, KeyOfValue>::_insert_node_at( base_ptr parent, bool as_left_child, base_ptr new_node )
     {
-        if ( node != nullptr )
-        {
-            this->_allocator.destroy( &node->_data );
-            this->_node_allocator.deallocate( node, 1 );
-        }
+        tree_insert_leaf( links_type(), this->_end_node(), this->_begin_node, parent, as_left_child, new_node );
+        ++( this->_size );
+        return ( new_node );
     }
 
-    template <typename T, typename Compare, typename Allocator>
-    typename red_black_tree<T, Compare, Allocator>::value_compare red_black_tree<T, Compare, Allocator>::value_comp() const
+    // Already sorted input is appended to the right-most node with one
+    // comparison per element instead of a full descent (see tree_find_insert_position()).
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    template <typename InputIterator>
+    void red_black_tree<T, Compare, Allocator, KeyOfValue>::_insert_range( InputIterator first, InputIterator last, ft::input_iterator_tag )
     {
-        return ( this->_compare );
+        for ( ; first != last; ++first )
+            this->_insert( *( first ) );
     }
 
-    /* private */
-
-    template <typename T, typename Compare, typename Allocator>
-    void red_black_tree<T, Compare, Allocator>::_create_null()
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    template <typename ForwardIterator>
+    void red_black_tree<T, Compare, Allocator, KeyOfValue>::_insert_range( ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag )
     {
-        this->_null = this->_node_allocator.allocate( 1 );
-        this->_node_allocator.construct( this->_null, value_type() );
+        size_type   n = 0;
+
+        if ( this->_size == 0 && this->_is_sorted_unique( first, last, n ) )
+            this->_build_sorted( first, n );
+        else
+            this->_insert_range( first, last, ft::input_iterator_tag() );
     }
 
-    template <typename T, typename Compare, typename Allocator>
-    void red_black_tree<T, Compare, Allocator>::_init_root( node_type_ptr &new_node, node_type_ptr &position )
+    // A single pass range can not be counted before it is read: every element
+    // is appended to the right-most node instead, with one comparison each.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    template <typename InputIterator>
+    void red_black_tree<T, Compare, Allocator, KeyOfValue>::_insert_sorted_unique( InputIterator first, InputIterator last, ft::input_iterator_tag )
     {
-        this->_base._left = new_node;
-        this->_base._left->_parent = &this->_base;
-        this->_base._left->_left = this->_null;
-        this->_base._left->_right = this->_null;
-        position = this->_base._left;
-        this->_begin_node = this->_base._left;
+        this->_insert_range( first, last, ft::input_iterator_tag() );
     }
 
-    template <typename T, typename Compare, typename Allocator>
-    ft::pair<typename red_black_tree<T, Compare, Allocator>::iterator, bool> red_black_tree<T, Compare, Allocator>::_insert( node_type_ptr rootptr, const value_type& value )
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    template <typename ForwardIterator>
+    void red_black_tree<T, Compare, Allocator, KeyOfValue>::_insert_sorted_unique( ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag )
     {
-        node_type_ptr       position = &this->_base;
-        node_type_ptr       new_node = this->_create_node( value );
-        bool                insert_flag = true;
-
-        while ( rootptr != this->_null )
-        {
-            position = rootptr;
-            if ( this->_compare( new_node->_data, rootptr->_data ) )
-                rootptr = rootptr->_left;
-            else if ( this->_compare( rootptr->_data, new_node->_data ) )
-                rootptr = rootptr->_right;
-            else
-            {
-                insert_flag = false;
-                break ;
-            }
-        }
-        new_node->_parent = position;
-        if ( position == &this->_base ) // empty tree
-            this->_init_root( new_node, position );
-        else if ( this->_compare( new_node->_data, position->_data ) )
-        {
-            position->_left = new_node;
-            new_node->_parent = position;
-            position = position->_left;
-        }
-        else if ( this->_compare( position->_data, new_node->_data ) )
-        {
-            position->_right = new_node;
-            new_node->_parent = position;
-            position = position->_right;
-        }
+        if ( this->_size == 0 )
+            this->_build_sorted( first, static_cast<size_type>( ft::distance( first, last ) ) );
         else
-        {
-            this->destroy_node( new_node);
-            return ( ft::make_pair( this->_make_iter( position ), insert_flag ) );
-        }
-        if ( insert_flag == true )
-            ++( this->_size );
-        this->_base._left->_parent = &this->_base;
-        if ( ( position->_parent == this->_begin_node ) && ( position == position->_parent->_left ) )
-            this->_begin_node = position;
-        this->_tree_insert_fixup( position );
-        return ( ft::make_pair( this->_make_iter( position ), insert_flag ) );
+            this->_insert_range( first, last, ft::input_iterator_tag() );
     }
 
-    template < typename T, typename Compare, typename Allocator>
-    void red_black_tree<T, Compare, Allocator>::_transplant( node_type_ptr old_subtree, node_type_ptr new_subtree )
+    // Counts the elements in n. Stops at the first element out of order.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    template <typename ForwardIterator>
+    bool red_black_tree<T, Compare, Allocator, KeyOfValue>::_is_sorted_unique( ForwardIterator first, ForwardIterator last, size_type& n ) const
     {
-        if ( old_subtree->_parent == &this->_base )
+        ForwardIterator previous = first;
+
+        if ( first == last )
+            return ( true );
+        for ( n = 1, ++first; first != last; ++n, ++first, ++previous )
         {
-            this->_base._left = new_subtree;
-            this->_base._left->_parent = &this->_base;
+            if ( !( this->_compare( _key( *( previous ) ), _key( *( first ) ) ) ) )
+                return ( false );
         }
-        else if ( old_subtree == old_subtree->_parent->_left )
-            old_subtree->_parent->_left = new_subtree;
-        else
-            old_subtree->_parent->_right = new_subtree;
-        new_subtree->_parent = old_subtree->_parent;
+        return ( true );
     }
 
-    template < typename T, typename Compare, typename Allocator>
-    bool red_black_tree<T, Compare, Allocator>::_node_has_children( node_type_ptr& node)
+    // Builds a perfectly balanced tree from the n sorted, unique elements starting at first.
+    // All nodes are black, except for those on the lowest level of an incomplete tree,
+    // so every path from the root to a leaf passes the same number of black nodes.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    template <typename ForwardIterator>
+    void red_black_tree<T, Compare, Allocator, KeyOfValue>::_build_sorted( ForwardIterator first, size_type n )
     {
-        if ( node->_left == this->_null && node->_right == this->_null )
+        size_type   depth = 0;
+        size_type   red_depth;
+
+        if ( n == 0 )
+            return ;
+        while ( ( n >> ( depth + 1 ) ) != 0 )
+            ++depth;
+        red_depth = ( ( ( n + 1 ) & n ) == 0 ) ? depth + 1 : depth; // n + 1 a power of two: the tree is complete, no red level
+        ft::allocator_reserve( this->_node_allocator, n );
+        this->_base._left = this->_build_subtree( first, n, 0, red_depth );
+        this->_base._left->set_parent( this->_end_node() );
+        this->_begin_node = tree_min( links_type(), this->_base._left );
+        this->_base._right = tree_max( links_type(), this->_base._left );
+        this->_size = n;
+    }
+
+    // In-order: the nodes are allocated in key order, so a pool allocator hands out neighbouring slots.
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    template <typename ForwardIterator>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::base_ptr
+    red_black_tree<T, Compare, Allocator, KeyOfValue>::_build_subtree( ForwardIterator& first, size_type n, size_type depth, size_type red_depth )
+    {
+        if ( n == 0 )
+            return ( this->_null() );
+
+        size_type       left_size = ( n - 1 ) / 2;
+        base_ptr        left = this->_build_subtree( first, left_size, depth + 1, red_depth );
+        node_type_ptr   node = this->_create_node( *( first ) );
+
+        ++first;
+        node->set_colour( ( depth == red_depth ) ? RED : BLACK );
+        node->set_count( n );
+        node->_left = left;
+        if ( left != this->_null() )
+            left->set_parent( node );
+        node->_right = this->_build_subtree( first, n - 1 - left_size, depth + 1, red_depth );
+        if ( node->_right != this->_null() )
+            node->_right->set_parent( node );
+        return ( node );
+    }
+
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    bool red_black_tree<T, Compare, Allocator, KeyOfValue>::_node_has_children( base_ptr& node)
+    {
+        if ( node->_left == this->_null() && node->_right == this->_null() )
             return ( false );
         return ( true );
     }
     
-    template < typename T, typename Compare, typename Allocator>
-    typename red_black_tree<T, Compare, Allocator>::node_type_ptr 
-    red_black_tree<T, Compare, Allocator>::_clone_tree( const red_black_tree& other, const node_type_ptr& other_root )
-    {
-        if ( other_root == other._null )
-            return ( this->_null );
-        node_type_ptr copy_node = this->_create_node( other_root->_data );
-        copy_node->_left = this->_clone_tree( other, other_root->_left );
-        if ( copy_node->_left != this->_null )
-            copy_node->_left->_parent = copy_node;        
-        copy_node->_right = this->_clone_tree( other, other_root->_right );
-        if ( copy_node->_right != this->_null )
-            copy_node->_right->_parent = copy_node;
+    // Copies other in pre-order without recursion: the parent links of both
+    // trees lead back up, and a child of the copy that is still _null() marks
+    // the subtree that is copied next. The shape and the colours are kept, so
+    // no rebalancing is needed. All nodes are reserved up front, for allocators
+    // that can hand them out from one block (see ft::allocator_reserve).
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void red_black_tree<T, Compare, Allocator, KeyOfValue>::_clone_tree( const red_black_tree& other )
+    {
+        if ( other._base._left == other._null() )
+            return ;
+        ft::allocator_reserve( this->_node_allocator, other._size );
+        this->_base._left = this->_clone_subtree( other._base._left, other._begin_node, this->_begin_node );
+        this->_base._left->set_parent( this->_end_node() );
+        this->_base._right = tree_max( links_type(), this->_base._left );
+    }
+
+    // The copy of other_min, if it is part of the subtree, is stored in copy_min.
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::base_ptr
+    red_black_tree<T, Compare, Allocator, KeyOfValue>::_clone_subtree( const_base_ptr other_root, const_base_ptr other_min, base_ptr& copy_min )
+    {
+        const_base_ptr      other_node = other_root;
+        base_ptr            copy_root = this->_clone_node( other_node, this->_end_node() );
+        base_ptr            copy_node = copy_root;
+
+        if ( other_node == other_min )
+            copy_min = copy_node;
+        for ( ; ; )
+        {
+            if ( other_node->_left != this->_null() && copy_node->_left == this->_null() )
+            {
+                other_node = other_node->_left;
+                copy_node->_left = this->_clone_node( other_node, copy_node );
+                copy_node = copy_node->_left;
+                if ( other_node == other_min )
+                    copy_min = copy_node;
+            }
+            else if ( other_node->_right != this->_null() && copy_node->_right == this->_null() )
+            {
+                other_node = other_node->_right;
+                copy_node->_right = this->_clone_node( other_node, copy_node );
+                copy_node = copy_node->_right;
+            }
+            else if ( copy_node == copy_root )
+                break ;
+            else
+            {
+                other_node = other_node->get_parent();
+                copy_node = copy_node->get_parent();
+            }
+        }
+        return ( copy_root );
+    }
+
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    inline typename red_black_tree<T, Compare, Allocator, KeyOfValue>::base_ptr
+    red_black_tree<T, Compare, Allocator, KeyOfValue>::_clone_node( const_base_ptr other_node, base_ptr parent )
+    {
+        node_type_ptr copy_node = this->_create_node( _value( other_node ) );
+
+        copy_node->set_colour( other_node->get_colour() );
+        copy_node->set_count( static_cast<const_node_type_ptr>( other_node )->get_count() );
+        copy_node->set_parent( parent );
+        ++( this->_size );
         return ( copy_node );
     }
 
     // // for debugging purposes only  // comment in for usage of debug_print()
-    // template <typename T, typename Compare, typename Allocator>
-    // void red_black_tree<T, Compare, Allocator>::_debug_print_recursive_inverted( const node_type_ptr& rootptr, int level, bool is_right ) const
+    // template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    // void red_black_tree<T, Compare, Allocator, KeyOfValue>::_debug_print_recursive_inverted( const base_ptr& rootptr, int level, bool is_right ) const
     // {
     //     //INVERTED for better human readability
     //     if ( rootptr == nullptr )
@@ -1185,239 +2421,403 @@ namespace ft
     //     for ( int i = 0; i < level; i++ )
     //     std::cout << "\t";
 
-    //     if ( rootptr->_parent != &this->_base )
+    //     if ( rootptr->get_parent() != this->_end_node() )
     //         std::cout << ( is_right ? "┌──" : "└──" );
     //     else
     //         std::cout << "├──";
         
-    //     if ( rootptr->_colour == RED )
+    //     if ( rootptr->get_colour() == RED )
     //         std::cout << "\033[31m";
     //     else
     //         std::cout << "\033[30m";
-    //     if (rootptr == this->_null)
+    //     if (rootptr == this->_null())
     //         std::cout << " null\033[37m\n";
     //     else
-    //         std::cout << " " << rootptr->_data.first << " / " << rootptr->_data.second << "\033[37m\n";
+    //         std::cout << " " << _value( rootptr ).first << " / " << _value( rootptr ).second << "\033[37m\n";
 
     //     _debug_print_recursive_inverted( rootptr->_left, level + 1, false );
     // }
 
-    template <typename T, typename Compare, typename Allocator>
-    typename red_black_tree<T, Compare, Allocator>::node_type_ptr red_black_tree<T, Compare, Allocator>::_create_node( const value_type& value )
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::node_type_ptr red_black_tree<T, Compare, Allocator, KeyOfValue>::_create_node( const value_type& value )
     {
         node_type_ptr new_node = this->_node_allocator.allocate( 1 );
         this->_allocator.construct( &new_node->_data, value );
-        new_node->_colour = RED;
-        new_node->_parent = this->_null;
-        new_node->_left = this->_null;
-        new_node->_right = this->_null;
+        new_node->set_colour( RED );
+        new_node->set_count( 1 );
+        new_node->set_parent( this->_null() );
+        new_node->_left = this->_null();
+        new_node->_right = this->_null();
         return ( new_node );
     }
 
-    template < typename T, typename Compare, typename Allocator>
-    void red_black_tree<T, Compare, Allocator>::_clear( node_type_ptr& rootptr)
+    // If the node allocator holds no other nodes, it frees them all at once
+    // (see ft::allocator_purge), and for a trivially destructible value_type
+    // the walk over the nodes is skipped entirely.
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void red_black_tree<T, Compare, Allocator, KeyOfValue>::_clear()
     {
-        if ( rootptr != this->_null )
-        {
-            if ( rootptr->_left != this->_null )
-                _clear( rootptr->_left );
-            if  ( rootptr->_right != this->_null )
-                _clear( rootptr->_right );
-            destroy_node( rootptr );
-            rootptr = this->_null;
-        }
+        bool    purge = ft::allocator_can_purge( this->_node_allocator, this->_size );
+
+        if ( !purge || !ft::is_trivially_destructible<value_type>::value )
+            this->_destroy_subtree( this->_base._left, !purge );
+        if ( purge )
+            ft::allocator_purge( this->_node_allocator );
+        this->_base._left = this->_null();
         this->_size = 0;
     }
 
-    template <typename T, typename Compare, typename Allocator>
-    inline typename red_black_tree<T, Compare, Allocator>::iterator red_black_tree<T, Compare, Allocator>::_make_iter( node_type_ptr ptr )
+    // Tears a subtree down from the bottom without recursion: a leaf is
+    // unlinked from its parent and destroyed, then the walk goes back up.
+    // The subtree is hung below _base for the walk. Returns the number of nodes.
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::size_type
+    red_black_tree<T, Compare, Allocator, KeyOfValue>::_destroy_subtree( base_ptr root, bool deallocate )
     {
-        return ( iterator( ptr ) );
+        base_ptr        node = root;
+        base_ptr        parent;
+        size_type       n = 0;
+
+        if ( root == this->_null() )
+            return ( 0 );
+        this->_hang( root );
+        while ( node != this->_end_node() )
+        {
+            if ( node->_left != this->_null() )
+                node = node->_left;
+            else if ( node->_right != this->_null() )
+                node = node->_right;
+            else
+            {
+                parent = node->get_parent();
+                if ( parent->_left == node )
+                    parent->_left = this->_null();
+                else
+                    parent->_right = this->_null();
+                if ( !ft::is_trivially_destructible<value_type>::value )
+                    this->_allocator.destroy( &( _node( node )->_data ) );
+                if ( deallocate )
+                    this->_node_allocator.deallocate( _node( node ), 1 );
+                node = parent;
+                ++n;
+            }
+        }
+        return ( n );
     }
 
-    template <typename T, typename Compare, typename Allocator>
-    inline typename red_black_tree<T, Compare, Allocator>::const_iterator red_black_tree<T, Compare, Allocator>::_make_iter( const_node_type_ptr ptr ) const
+    /* split / join */
+
+    /*
+    ** The subtrees below work on are detached from the tree, each one is
+    ** passed around with its black height (the number of black nodes on every
+    ** path from its root down to _null(), not counting _null()), so no
+    ** operation has to walk a whole spine to find it. While one of them is
+    ** rebalanced it is hung below _base, so the rotations and fixups of
+    ** insert and erase can be reused. The callers save the root of the tree
+    ** first and set it again with _set_root() at the end.
+    **
+    ** _join( left, pivot, right ) needs every key in left to be less than
+    ** the key of pivot and every key in right to be greater. It walks down
+    ** the spine of the higher tree to a black node of the black height of
+    ** the lower one, puts pivot there as a red node with the lower tree as
+    ** its other child, and rebalances as if pivot had just been inserted.
+    ** This costs O(|difference of the black heights| + 1), so splitting a
+    ** tree (one join per node on the search path) stays O(log n).
+    */
+
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    inline typename red_black_tree<T, Compare, Allocator, KeyOfValue>::_subtree
+    red_black_tree<T, Compare, Allocator, KeyOfValue>::_make_subtree( base_ptr root, size_type height )
     {
-        return ( const_iterator( ptr ) );
+        _subtree    tree;
+
+        tree.root = root;
+        tree.height = height;
+        return ( tree );
     }
 
-    template < typename T, typename Compare, typename Allocator>
-    void red_black_tree<T, Compare, Allocator>::_left_rotate( node_type_ptr position )
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::_subtree red_black_tree<T, Compare, Allocator, KeyOfValue>::_whole() const
     {
-        node_type_ptr   right_node = position->_right;
+        base_ptr        node = this->_base._left;
+        size_type       height = 0;
 
-        position->_right = right_node->_left; // turn right_nodes’s left subtree into positions’s right subtree
-        if ( right_node->_left != this->_null )
-            right_node->_left->_parent = position;
-        right_node->_parent = position->_parent; // link position’s parent to right_node
-        if ( position->_parent == &this->_base )
-            this->_base._left = right_node;
-        else if ( position == position->_parent->_left )
-            position->_parent->_left = right_node;
-        else
-            position->_parent->_right = right_node;
-        right_node->_left = position; // put position on right_node’s left
-        position->_parent = right_node;
+        for ( ; node != this->_null(); node = node->_left )
+        {
+            if ( node->get_colour() == BLACK )
+                ++height;
+        }
+        return ( _make_subtree( this->_base._left, height ) );
     }
 
-    template < typename T, typename Compare, typename Allocator>
-    void red_black_tree<T, Compare, Allocator>::_right_rotate( node_type_ptr position )
+    // Hangs root below _base, to be rebalanced there. _begin_node and _base._right are not updated.
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    inline void red_black_tree<T, Compare, Allocator, KeyOfValue>::_hang( base_ptr root )
     {
-        node_type_ptr   left_node = position->_left;
+        this->_base._left = root;
+        if ( root != this->_null() )
+            root->set_parent( this->_end_node() );
+    }
 
-        position->_left = left_node->_right; // turn left_nodes’s right subtree into positions’s left subtree
-        if ( left_node->_right != this->_null )
-            left_node->_right->_parent = position;
-        left_node->_parent = position->_parent; // link position’s parent to left_node
-        if ( position->_parent == &this->_base )
-            this->_base._left = left_node;
-        else if ( position == position->_parent->_right )
-            position->_parent->_right = left_node;
+    // Makes root the root of the tree again, a red root is blackened.
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void red_black_tree<T, Compare, Allocator, KeyOfValue>::_set_root( base_ptr root )
+    {
+        this->_hang( root );
+        if ( root == this->_null() )
+        {
+            this->_begin_node = this->_end_node();
+            this->_base._right = this->_end_node();
+        }
         else
-            position->_parent->_left = left_node;
-        left_node->_right = position; // put position on left_node’s right
-        position->_parent = left_node;
+        {
+            root->set_colour( BLACK );
+            this->_begin_node = tree_min( links_type(), root );
+            this->_base._right = tree_max( links_type(), root );
+        }
     }
 
-    template < typename T, typename Compare, typename Allocator>
-    void red_black_tree<T, Compare, Allocator>::_tree_insert_fixup( node_type_ptr position )
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::_subtree
+    red_black_tree<T, Compare, Allocator, KeyOfValue>::_join( _subtree left, base_ptr pivot, _subtree right )
     {
-        while ( position->_parent->_colour == RED )
-        {
-            node_type_ptr   uncle = &this->_base; // same level as parent node
+        base_ptr        parent = this->_end_node();
+        base_ptr        node;
+        size_type       height;
+        size_type       added;
 
-            if ( position->_parent == position->_parent->_parent->_left )
+        if ( left.root->get_colour() == RED ) // both roots black, so pivot never gets a red child
+        {
+            left.root->set_colour( BLACK );
+            ++( left.height );
+        }
+        if ( right.root->get_colour() == RED )
+        {
+            right.root->set_colour( BLACK );
+            ++( right.height );
+        }
+        pivot->set_colour( RED );
+        if ( left.height >= right.height )
+        {
+            this->_hang( left.root );
+            for ( node = left.root, height = left.height; node->get_colour() == RED || height != right.height; node = node->_right )
             {
-                uncle = position->_parent->_parent->_right;
-                // 3 cases:
-                if ( uncle->_colour == RED ) // 1
-                {
-                    position->_parent->_colour = BLACK;
-                    uncle->_colour = BLACK;
-                    position->_parent->_parent->_colour = RED;
-                    position = position->_parent->_parent;
-                }
-                else
-                {
-                    if ( position == position->_parent->_right ) // 2
-                    {
-                        position = position->_parent;
-                        this->_left_rotate( position );
-                    }
-                    // 3
-                    position->_parent->_colour = BLACK;
-                    position->_parent->_parent->_colour = RED;
-                    this->_right_rotate( position->_parent->_parent );
-                }
+                if ( node->get_colour() == BLACK )
+                    --height;
+                parent = node;
             }
+            pivot->_left = node;
+            pivot->_right = right.root;
+            if ( parent == this->_end_node() )
+                this->_base._left = pivot;
             else
+                parent->_right = pivot;
+            added = tree_count( links_type(), right.root ) + 1;
+        }
+        else
+        {
+            this->_hang( right.root );
+            for ( node = right.root, height = right.height; node->get_colour() == RED || height != left.height; node = node->_left )
             {
-                uncle = position->_parent->_parent->_left;
-                // 3 cases:
-                if ( uncle->_colour == RED ) // 1
-                {
-                    position->_parent->_colour = BLACK;
-                    uncle->_colour = BLACK;
-                    position->_parent->_parent->_colour = RED;
-                    position = position->_parent->_parent;
-                }
-                else
-                {
-                    if ( position == position->_parent->_left ) // 2
-                    {
-                        position = position->_parent;
-                        this->_right_rotate( position );
-                    }
-                    // 3
-                    position->_parent->_colour = BLACK;
-                    position->_parent->_parent->_colour = RED;
-                    this->_left_rotate( position->_parent->_parent );
-                }
+                if ( node->get_colour() == BLACK )
+                    --height;
+                parent = node;
+            }
+            pivot->_left = left.root;
+            pivot->_right = node;
+            if ( parent == this->_end_node() )
+                this->_base._left = pivot;
+            else
+                parent->_left = pivot;
+            added = tree_count( links_type(), left.root ) + 1;
+        }
+        pivot->set_parent( parent );
+        if ( pivot->_left != this->_null() )
+            pivot->_left->set_parent( pivot );
+        if ( pivot->_right != this->_null() )
+            pivot->_right->set_parent( pivot );
+        if ( ft::is_ranked<Compare>::value )
+        {
+            links_type::set_count( pivot, tree_count( links_type(), pivot->_left ) + tree_count( links_type(), pivot->_right ) + 1 );
+            for ( ; parent != this->_end_node(); parent = parent->get_parent() )
+                links_type::set_count( parent, links_type::count( parent ) + added );
+        }
+        height = ( left.height > right.height ) ? left.height : right.height;
+        if ( tree_insert_fixup( links_type(), pivot, this->_end_node() ) )
+            ++height;
+        return ( _make_subtree( this->_base._left, height ) );
+    }
+
+    // _join() without a pivot: the largest node of left is taken out and used instead.
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::_subtree
+    red_black_tree<T, Compare, Allocator, KeyOfValue>::_join2( _subtree left, _subtree right )
+    {
+        base_ptr        pivot;
+
+        if ( left.root == this->_null() )
+            return ( right );
+        if ( right.root == this->_null() )
+            return ( left );
+        this->_hang( left.root );
+        pivot = tree_max( links_type(), left.root );
+        tree_unlink( links_type(), pivot, this->_end_node() );
+        return ( this->_join( this->_whole(), pivot, right ) );
+    }
+
+    // Splits tree into the nodes with a key less than key (left) and the others
+    // (right). With take_equal, a node with an equivalent key is left out of
+    // both and returned, otherwise nullptr is returned.
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::base_ptr
+    red_black_tree<T, Compare, Allocator, KeyOfValue>::_split( _subtree tree, const key_type& key, bool take_equal, _subtree& left, _subtree& right )
+    {
+        base_ptr        node = tree.root;
+        base_ptr        last = this->_end_node(); // last node on the search path
+        base_ptr        equal = nullptr;
+        base_ptr        parent;
+        size_type       height = tree.height; // black height of node
+        bool            black;
+
+        left = _make_subtree( this->_null(), 0 );
+        right = _make_subtree( this->_null(), 0 );
+        this->_hang( node );
+        while ( node != this->_null() ) // down: find the search path
+        {
+            if ( node->get_colour() == BLACK )
+                --height;
+            if ( take_equal && !this->_compare( _key( _value( node ) ), key ) && !this->_compare( key, _key( _value( node ) ) ) )
+            {
+                equal = node;
+                left = _make_subtree( node->_left, height );
+                right = _make_subtree( node->_right, height );
+                height += ( node->get_colour() == BLACK ) ? 1 : 0;
+                break ;
             }
+            last = node;
+            node = ( this->_compare( _key( _value( node ) ), key ) ) ? node->_right : node->_left;
+        }
+        node = ( equal != nullptr ) ? equal->get_parent() : last;
+        while ( node != this->_end_node() ) // up: join the halves the path passes
+        {
+            parent = node->get_parent();
+            black = ( node->get_colour() == BLACK ); // _join() recolours node
+            if ( this->_compare( _key( _value( node ) ), key ) )
+                left = this->_join( _make_subtree( node->_left, height ), node, left );
+            else
+                right = this->_join( right, node, _make_subtree( node->_right, height ) );
+            if ( black )
+                ++height;
+            node = parent;
         }
-        this->_base._left->_colour = BLACK;
+        return ( equal );
     }
 
-    template < typename T, typename Compare, typename Allocator>
-    void red_black_tree<T, Compare, Allocator>::_tree_erase_fixup( node_type_ptr position )
+    // [begin(), first), [first, last) and [last, end()) as three subtrees.
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void red_black_tree<T, Compare, Allocator, KeyOfValue>::_split_range( const_iterator first, const_iterator last, _subtree& left, _subtree& middle, _subtree& right )
     {
+        _subtree    rest;
 
-        while ( position != this->_base._left && position->_colour == BLACK )
+        if ( last == this->end() )
+        {
+            this->_split( this->_whole(), _key( *first ), false, left, middle );
+            right = _make_subtree( this->_null(), 0 );
+        }
+        else
         {
-            node_type_ptr   sibling = &this->_base; // same level as position
+            this->_split( this->_whole(), _key( *last ), false, rest, right );
+            this->_split( rest, _key( *first ), false, left, middle );
+        }
+    }
 
-            if ( position == position->_parent->_left )
-            {
-                sibling = position->_parent->_right;
-                if ( sibling->_colour == RED ) // 1
-                {
-                    sibling->_colour = BLACK;
-                    position->_parent->_colour = RED;
-                    this->_left_rotate( position->_parent );
-                    sibling = position->_parent->_right;
-                }
-                if ( sibling->_left->_colour == BLACK && sibling->_right->_colour == BLACK ) // 2
-                {
-                    sibling->_colour = RED;
-                    position = position->_parent;
-                }
-                else
-                {
-                    if ( sibling->_right->_colour == BLACK ) // 3
-                    {
-                        sibling->_left->_colour = BLACK;
-                        sibling->_colour = RED;
-                        this->_right_rotate( sibling );
-                        sibling = position->_parent->_right;
-                    }
-                    // 4
-                    sibling->_colour = position->_parent->_colour;
-                    position->_parent->_colour = BLACK;
-                    sibling->_right->_colour = BLACK;
-                    this->_left_rotate( position->_parent );
-                    position = this->_base._left;
-                }
-            }
-            else
-            {
-                sibling = position->_parent->_left;
-                if ( sibling->_colour == RED ) // 1
-                {
-                    sibling->_colour = BLACK;
-                    position->_parent->_colour = RED;
-                    this->_right_rotate( position->_parent );
-                    sibling = position->_parent->_left;
-                }
-                if ( sibling->_right->_colour == BLACK && sibling->_left->_colour == BLACK ) // 2
-                {
-                    sibling->_colour = RED;
-                    position = position->_parent;
-                }
-                else
-                {
-                    if ( sibling->_left->_colour == BLACK ) // 3
-                    {
-                        sibling->_right->_colour = BLACK;
-                        sibling->_colour = RED;
-                        this->_left_rotate( sibling );
-                        sibling = position->_parent->_left;
-                    }
-                    // 4
-                    sibling->_colour = position->_parent->_colour;
-                    position->_parent->_colour = BLACK;
-                    sibling->_left->_colour = BLACK;
-                    this->_right_rotate( position->_parent );
-                    position = this->_base._left;
-                }
-            }
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::_subtree
+    red_black_tree<T, Compare, Allocator, KeyOfValue>::_union( _subtree tree, const_base_ptr other )
+    {
+        _subtree        left;
+        _subtree        right;
+        base_ptr        pivot;
+        base_ptr        unused;
+
+        if ( other == this->_null() )
+            return ( tree );
+        if ( tree.root == this->_null() )
+        {
+            this->_hang( this->_clone_subtree( other, nullptr, unused ) );
+            return ( this->_whole() );
+        }
+        pivot = this->_split( tree, _key( _value( other ) ), true, left, right );
+        if ( pivot == nullptr )
+        {
+            pivot = this->_create_node( _value( other ) );
+            ++( this->_size );
+        }
+        left = this->_union( left, other->_left );
+        right = this->_union( right, other->_right );
+        return ( this->_join( left, pivot, right ) );
+    }
+
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::_subtree
+    red_black_tree<T, Compare, Allocator, KeyOfValue>::_intersection( _subtree tree, const_base_ptr other )
+    {
+        _subtree        left;
+        _subtree        right;
+        base_ptr        pivot;
+
+        if ( tree.root == this->_null() )
+            return ( tree );
+        if ( other == this->_null() )
+        {
+            this->_size -= this->_destroy_subtree( tree.root, true );
+            return ( _make_subtree( this->_null(), 0 ) );
+        }
+        pivot = this->_split( tree, _key( _value( other ) ), true, left, right );
+        left = this->_intersection( left, other->_left );
+        right = this->_intersection( right, other->_right );
+        if ( pivot == nullptr )
+            return ( this->_join2( left, right ) );
+        return ( this->_join( left, pivot, right ) );
+    }
+
+    template < typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    typename red_black_tree<T, Compare, Allocator, KeyOfValue>::_subtree
+    red_black_tree<T, Compare, Allocator, KeyOfValue>::_difference( _subtree tree, const_base_ptr other )
+    {
+        _subtree        left;
+        _subtree        right;
+        base_ptr        pivot;
+
+        if ( tree.root == this->_null() || other == this->_null() )
+            return ( tree );
+        pivot = this->_split( tree, _key( _value( other ) ), true, left, right );
+        if ( pivot != nullptr )
+        {
+            this->destroy_node( pivot );
+            --( this->_size );
         }
-        position->_colour = BLACK;
+        left = this->_difference( left, other->_left );
+        right = this->_difference( right, other->_right );
+        return ( this->_join2( left, right ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    inline typename red_black_tree<T, Compare, Allocator, KeyOfValue>::iterator red_black_tree<T, Compare, Allocator, KeyOfValue>::_make_iter( base_ptr ptr )
+    {
+        return ( iterator( ptr ) );
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    inline typename red_black_tree<T, Compare, Allocator, KeyOfValue>::const_iterator red_black_tree<T, Compare, Allocator, KeyOfValue>::_make_iter( const_base_ptr ptr ) const
+    {
+        return ( const_iterator( const_cast<base_ptr>( ptr ) ) );
     }
 
     /* red_black_tree non-member functions */
 
-    template <typename T, typename Compare, typename Allocator>
-    void swap( red_black_tree<T, Compare, Allocator>& lhs, red_black_tree<T, Compare, Allocator>& rhs )
+    template <typename T, typename Compare, typename Allocator, typename KeyOfValue>
+    void swap( red_black_tree<T, Compare, Allocator, KeyOfValue>& lhs, red_black_tree<T, Compare, Allocator, KeyOfValue>& rhs )
     {
         lhs.swap( rhs );
     }
@@ -241,4 +241,184 @@ namespace   ft
     // template <>
     // struct is_integral<const volatile unsigned long long>  : public true_type {}; // = C++11 Extension
 
+
+    /* -------------------- remove_const / remove_volatile ------------------ */
+
+    /*
+    ** (https://en.cppreference.com/w/cpp/types/remove_cv)
+    ** Provides the member typedef type which is the same as T,
+    ** except that its topmost cv-qualifiers are removed.
+    */
+
+    template <typename T>
+    struct remove_const                     { typedef T type; };
+
+    template <typename T>
+    struct remove_const<const T>            { typedef T type; };
+
+    template <typename T>
+    struct remove_volatile                  { typedef T type; };
+
+    template <typename T>
+    struct remove_volatile<volatile T>      { typedef T type; };
+
+    template <typename T>
+    struct remove_cv
+    {
+        typedef typename remove_volatile<typename remove_const<T>::type>::type type;
+    };
+
+
+    /* ------------------ is_floating_point / is_arithmetic ----------------- */
+
+    /*
+    ** (https://en.cppreference.com/w/cpp/types/is_floating_point)
+    ** Checks whether T is a floating-point type (float, double, long double),
+    ** including any cv-qualified variants.
+    ** (https://en.cppreference.com/w/cpp/types/is_arithmetic)
+    ** Checks whether T is an arithmetic type (that is, an integral type or a floating-point type).
+    */
+
+    template <typename T>
+    struct _is_floating_point               : public false_type {};
+
+    template <>
+    struct _is_floating_point<float>        : public true_type {};
+
+    template <>
+    struct _is_floating_point<double>       : public true_type {};
+
+    template <>
+    struct _is_floating_point<long double>  : public true_type {};
+
+    template <typename T>
+    struct is_floating_point                : public _is_floating_point<typename remove_cv<T>::type> {};
+
+    template <typename T>
+    struct is_arithmetic                    : public integral_constant<bool, ( is_integral<T>::value
+                                                                                || is_floating_point<T>::value )> {};
+
+
+    /* ------------------------------ is_pointer ---------------------------- */
+
+    /*
+    ** (https://en.cppreference.com/w/cpp/types/is_pointer)
+    ** Checks whether T is a pointer to object or function (but not a pointer to member),
+    ** including any cv-qualified variants.
+    */
+
+    template <typename T>
+    struct _is_pointer                      : public false_type {};
+
+    template <typename T>
+    struct _is_pointer<T*>                  : public true_type {};
+
+    template <typename T>
+    struct is_pointer                       : public _is_pointer<typename remove_cv<T>::type> {};
+
+
+    /* ---------------------------- is_transparent -------------------------- */
+
+    /*
+    ** Not part of any C++ standard.
+    ** true_type, if the comparison object Compare declares a nested type
+    ** 'is_transparent' (like ft::less<void>), meaning it can compare keys with
+    ** values of other types. Enables the heterogeneous lookup of map and set.
+    ** The unused parameter K allows to make the trait depend on the template
+    ** parameter of a member function template, as SFINAE requires.
+    */
+
+    template <typename Compare>
+    struct _has_is_transparent
+    {
+    private:
+        template <typename U>
+            static char _test( typename U::is_transparent* );
+        template <typename U>
+            static long _test( ... );
+
+    public:
+        static const bool value = ( sizeof( _test<Compare>( 0 ) ) == sizeof( char ) );
+    };
+
+    template <typename Compare, typename K = void>
+    struct is_transparent                   : public integral_constant<bool, _has_is_transparent<Compare>::value> {};
+
+
+    /* ------------------------------ is_ranked ----------------------------- */
+
+    /*
+    ** Not part of any C++ standard.
+    ** true_type, if the comparison object Compare declares a nested type
+    ** 'is_ranked' (like ft::ranked), which opts a map or set into order
+    ** statistics: its nodes then also store the size of their subtree.
+    */
+
+    template <typename Compare>
+    struct _has_is_ranked
+    {
+    private:
+        template <typename U>
+            static char _test( typename U::is_ranked* );
+        template <typename U>
+            static long _test( ... );
+
+    public:
+        static const bool value = ( sizeof( _test<Compare>( 0 ) ) == sizeof( char ) );
+    };
+
+    template <typename Compare>
+    struct is_ranked                        : public integral_constant<bool, _has_is_ranked<Compare>::value> {};
+
+
+    /* ----------------------- is_trivially_relocatable --------------------- */
+
+    /*
+    ** Not part of any C++ standard (compare P1144 / folly::IsRelocatable).
+    ** A type is trivially relocatable, if moving an object to a new address
+    ** and simply forgetting about the old one is equivalent to a bitwise copy.
+    ** Containers use this to move whole ranges with a single memcpy / memmove,
+    ** instead of copy constructing every element and destroying the original.
+    ** Arithmetic and pointer types qualify by default. Any other type
+    ** (e.g. a POD struct) may opt in by specializing this template:
+    **     template <> struct ft::is_trivially_relocatable<MyPod> : public ft::true_type {};
+    ** A type holding pointers into itself must never opt in.
+    */
+
+    template <typename T>
+    struct is_trivially_relocatable         : public integral_constant<bool, ( is_arithmetic<T>::value
+                                                                                || is_pointer<T>::value )> {};
+
+
+    /* ------------------- is_trivially_default_constructible --------------- */
+
+    /*
+    ** (https://cplusplus.com/reference/type_traits/is_trivially_default_constructible/)
+    ** C++98 can not detect this, so only arithmetic and pointer types qualify
+    ** by default. Default initializing such an object leaves it uninitialized,
+    ** which containers may use to skip zero-filling storage that is about to
+    ** be overwritten anyway. Other types may opt in by specializing:
+    **     template <> struct ft::is_trivially_default_constructible<MyPod> : public ft::true_type {};
+    */
+
+    template <typename T>
+    struct is_trivially_default_constructible : public integral_constant<bool, ( is_arithmetic<T>::value
+                                                                                || is_pointer<T>::value )> {};
+
+
+
+    /* ---------------------- is_trivially_destructible --------------------- */
+
+    /*
+    ** (https://cplusplus.com/reference/type_traits/is_trivially_destructible/)
+    ** C++98 can not detect this, so only arithmetic and pointer types qualify
+    ** by default. Containers may skip the destructor calls for such elements
+    ** when they free a whole range. Other types may opt in by specializing:
+    **     template <> struct ft::is_trivially_destructible<MyPod> : public ft::true_type {};
+    */
+
+    template <typename T>
+    struct is_trivially_destructible        : public integral_constant<bool, ( is_arithmetic<T>::value
+                                                                                || is_pointer<T>::value )> {};
+
 } // namespace  ft
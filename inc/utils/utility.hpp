@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include "./type_traits.hpp"
+
 namespace   ft
 {
 
@@ -108,6 +110,16 @@ namespace   ft
         return ( pair<T1, T2>( x, y ) );
     }
 
+    // a pair can be moved bitwise, if both of its members can
+    template <typename T1, typename T2>
+    struct is_trivially_relocatable<pair<T1, T2> > : public integral_constant<bool, ( is_trivially_relocatable<T1>::value
+                                                                                    && is_trivially_relocatable<T2>::value )> {};
+
+    // a pair needs no destructor call, if neither of its members does
+    template <typename T1, typename T2>
+    struct is_trivially_destructible<pair<T1, T2> > : public integral_constant<bool, ( is_trivially_destructible<T1>::value
+                                                                                     && is_trivially_destructible<T2>::value )> {};
+
 
     /* -------------------------------- swap -------------------------------- */
     
@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <cstring>
 #include <limits>
 #include <stdexcept>
 
@@ -60,6 +61,9 @@ namespace ft
         typedef std::size_t										size_type;
 
     private:
+        typedef typename ft::is_trivially_relocatable<value_type>::type    _relocatable; // true_type / false_type, selects the relocation strategy
+        typedef typename ft::is_trivially_default_constructible<value_type>::type  _default_init_is_noop; // true_type: default init leaves the element uninitialized
+
         allocator_type  _allocator;
         pointer         _begin;
         pointer         _end;
@@ -91,6 +95,7 @@ namespace ft
         size_type size() const;
         size_type max_size() const;
         void resize( size_type n, value_type val = value_type() );
+        void resize_default_init( size_type n ); // extension: new trivial elements stay uninitialized
         size_type capacity() const;
         bool empty() const;
         void reserve( size_type n );
@@ -119,6 +124,7 @@ namespace ft
                         typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = 0 ); // range version
         iterator erase( iterator position );
         iterator erase( iterator first, iterator last );
+        iterator unordered_erase( iterator position ); // extension: O(1), does not keep the order
         void swap( vector& x );
         void clear();
 
@@ -137,9 +143,32 @@ namespace ft
         pointer _vallocate(size_type n); // allocate space for n objects
         void _vdeallocate( size_type n ); // clears all objects from vector and deallocates space
         void _vconstruct_elements( const size_type& n, const value_type& val ); // constructs elements of type val
-        void _vconstruct_copies( const vector& other ); // constructs copies of elements of 'other'
         void _vdestruct_at_end( pointer _new_end );
         void _vresize_empty_vector( size_type n );
+        void _vconstruct_at_end( size_type n, const value_type& val ); // constructs n copies of val behind the last element
+        template <class ForwardIterator>
+            void _vconstruct_range_at_end( ForwardIterator first, ForwardIterator last ); // constructs copies of [first, last) behind the last element
+        void _vdefault_init_at_end( size_type n, ft::true_type ); // only moves the end
+        void _vdefault_init_at_end( size_type n, ft::false_type ); // value initializes n elements
+
+        // Relocation Helper Functions
+        void _vreallocate( size_type n ); // moves all elements into new storage for (at least) n objects
+        void _vadopt_storage( pointer new_begin, size_type new_capacity, pointer pos, size_type n ); // moves all elements into new_begin, skipping n slots at pos
+        void _vrelocate( pointer first, pointer last, pointer dest, ft::true_type ); // bitwise: one memcpy
+        void _vrelocate( pointer first, pointer last, pointer dest, ft::false_type ); // copy construct + destroy
+        void _vopen_gap( pointer pos, size_type n ); // relocatable only: shifts [pos, end) back by n, leaving n raw slots at pos
+
+        // Insert / Erase Helper Functions (capacity is already sufficient)
+        void _vinsert_fill( pointer pos, size_type n, const value_type& val, ft::true_type );
+        void _vinsert_fill( pointer pos, size_type n, const value_type& val, ft::false_type );
+        template <class ForwardIterator>
+            void _vinsert_copy( pointer pos, ForwardIterator first, ForwardIterator last, size_type n, ft::true_type );
+        template <class ForwardIterator>
+            void _vinsert_copy( pointer pos, ForwardIterator first, ForwardIterator last, size_type n, ft::false_type );
+        void _verase_range( pointer first, pointer last, ft::true_type );
+        void _verase_range( pointer first, pointer last, ft::false_type );
+        void _vreplace_with_last( pointer p, ft::true_type );
+        void _vreplace_with_last( pointer p, ft::false_type );
 
         // Assign Helper Functions
         template <class InputIterator>
@@ -183,10 +212,15 @@ namespace ft
         assign( first, last );
     }
 
+    // allocates exactly src.size(), the spare capacity of src is not copied
     template <typename T, typename Alloc>
     vector<T, Alloc>::vector( const vector& src )  : _allocator(src._allocator), _begin(nullptr), _end(nullptr), _capacity(0) // copy constructor
     {
-        *this = src;
+        if ( src._begin != src._end )
+        {
+            this->_begin = this->_end = this->_vallocate( src.size() );
+            this->_vconstruct_range_at_end( src._begin, src._end );
+        }
     }
 
     template <typename T, typename Alloc>
@@ -197,18 +231,33 @@ namespace ft
     }
 
 
+    // Reuses the existing storage, whenever it is big enough: live elements get assigned,
+    // missing ones constructed and surplus ones destroyed. Only if other.size() exceeds
+    // the capacity, new storage for exactly other.size() elements is allocated.
     template <typename T, typename Alloc>
     vector<T, Alloc>& vector<T, Alloc>::operator=( const vector<T, Alloc>& other ) // assignment operator
     {
         if ( this != &other )
         {
-            this->_vdeallocate( this->_capacity );
-            this->_capacity = 0;
-            this->_allocator = other._allocator;
-            size_type n = other.capacity();
-            this->_begin = this->_vallocate( n );
-            this->_end = this->_begin + other.size();
-            this->_vconstruct_copies( other );
+            size_type   n = other.size();
+
+            if ( n > this->_capacity )
+            {
+                this->_vdeallocate( this->_capacity );
+                this->_capacity = 0;
+                this->_allocator = other._allocator;
+                this->_begin = this->_end = this->_vallocate( n );
+                this->_vconstruct_range_at_end( other._begin, other._end );
+            }
+            else if ( n <= this->size() )
+                this->_vdestruct_at_end( ft::copy( other._begin, other._end, this->_begin ) );
+            else
+            {
+                pointer mid = other._begin + this->size();
+
+                ft::copy( other._begin, mid, this->_begin );
+                this->_vconstruct_range_at_end( mid, other._end );
+            }
         }
         return ( *this );
     }
@@ -295,8 +344,28 @@ namespace ft
         else
         {
             this->reserve( n );
-            for ( ; temp_size < n; ++temp_size )
-                this->push_back( val );
+            this->_vconstruct_at_end( n - temp_size, val );
+        }
+    }
+
+    // Not part of the standard.
+    // Like resize( n ), but if value_type is trivially default constructible
+    // (see ft::is_trivially_default_constructible) the new elements are left
+    // uninitialized instead of being zero-filled. Meant for buffers which are
+    // overwritten right away, e.g. by read(). Other types are value-initialized.
+    template <typename T, typename Alloc>
+    void vector<T, Alloc>::resize_default_init( size_type n )
+    {
+        size_type   temp_size = this->size();
+
+        if ( n == temp_size )
+            return ;
+        if ( n < temp_size )
+            this->_vdestruct_at_end(this->_begin + n);
+        else
+        {
+            this->reserve( n );
+            this->_vdefault_init_at_end( n - temp_size, _default_init_is_noop() );
         }
     }
 
@@ -319,17 +388,7 @@ namespace ft
     void vector<T, Alloc>::reserve( size_type n )
     {
         if ( n > this->capacity() )
-        {
-            size_type   temp_capacity = this->capacity();
-            size_type   temp_size = this->size();
-            pointer     temp_begin = this->_vallocate( n );
-
-            for ( size_type i = 0; i < temp_size; ++i )
-                this->_allocator.construct( temp_begin + i, this->_begin[i] );
-            this->_vdeallocate( temp_capacity );
-            this->_begin = temp_begin;
-            this->_end = this->_begin + temp_size;
-        }
+            this->_vreallocate( n );
     }
 
 
@@ -401,14 +460,31 @@ namespace ft
     template <typename T, typename Alloc>
     void vector<T, Alloc>::assign( size_type n, const value_type& val ) // fill version
     {
+        size_type   temp_size = this->size();
 
-        this->clear();
         if ( n > this->_capacity )
-            _vresize_empty_vector( n );
-        for ( size_type i = 0; i < n; ++i )
         {
-            this->_allocator.construct( this->_end, val );
-            ++this->_end;
+            // build the copies first: val might be an element of this vector
+            size_type   new_capacity = this->_vcalculate_size( n );
+            pointer     new_begin = this->_allocator.allocate( new_capacity );
+            pointer     new_end = new_begin;
+
+            for ( ; new_end != new_begin + n; ++new_end )
+                this->_allocator.construct( new_end, val );
+            this->_vdeallocate( this->_capacity );
+            this->_begin = new_begin;
+            this->_end = new_end;
+            this->_capacity = new_capacity;
+        }
+        else if ( n > temp_size )
+        {
+            ft::fill( this->_begin, this->_end, val );
+            this->_vconstruct_at_end( n - temp_size, val );
+        }
+        else
+        {
+            ft::fill( this->_begin, this->_begin + n, val );
+            this->_vdestruct_at_end( this->_begin + n );
         }
     }
 
@@ -416,8 +492,15 @@ namespace ft
     template <typename T, typename Alloc>
     void vector<T, Alloc>::push_back( const value_type& val )
     {
-        this->reserve( this->size() + 1 );
-        this->_allocator.construct( this->_end, val );
+        if ( this->size() == this->_capacity )
+        {
+            value_type  temp_val( val ); // val might be an element of this vector
+
+            this->reserve( this->size() + 1 );
+            this->_allocator.construct( this->_end, temp_val );
+        }
+        else
+            this->_allocator.construct( this->_end, val );
         ++this->_end;
     }
 
@@ -454,66 +537,47 @@ namespace ft
         return ( this->_make_iter( this->_begin + n ) );
     }
 
+    // Reallocates at most once. The elements behind position are moved
+    // straight into their final slots and the new elements are constructed only once.
     template <typename T, typename Alloc>
-    void vector<T, Alloc>::insert( iterator position, size_type n, const value_type& val ) // fill version // TASK: efficiency should be raised! (2x slower than std)
+    void vector<T, Alloc>::insert( iterator position, size_type n, const value_type& val ) // fill version
     {
         pointer pos = _vmake_pointer( position );
 
-        if ( n <= 0 )
+        if ( n == 0 )
             return ;
-        if ( pos == this->_end )
+        if ( n > this->_capacity - this->size() )
         {
-            for ( size_type i = 0; i < n; i++ )
-                push_back( val );
-        }
-        else
-        {
-            size_type       old_size = this->size();
-            size_type       distance = static_cast<size_type>( ft::distance( this->_begin, pos ) );
+            size_type   new_capacity = this->_vcalculate_size( this->size() + n );
+            pointer     new_begin = this->_allocator.allocate( new_capacity );
+            pointer     gap = new_begin + ( pos - this->_begin );
 
-            this->resize( old_size + n );
-
-            iterator    temp_first = this->begin() + distance;
-            iterator    temp_last = this->begin() + old_size;
-            iterator    new_position = this->begin() + old_size + n;
-
-            while ( temp_last != temp_first )
-		        *( --new_position ) = *( --temp_last );
-            for ( iterator it = temp_first; it != temp_first + n; ++it )
-            {
-                this->_allocator.destroy(it.base());
-                this->_allocator.construct(it.base(), val);
-            }
+            for ( size_type i = 0; i < n; ++i )
+                this->_allocator.construct( gap + i, val ); // before relocating, val might be an element of this vector
+            this->_vadopt_storage( new_begin, new_capacity, pos, n );
         }
+        else
+            this->_vinsert_fill( pos, n, val, _relocatable() );
     }
 
     template <typename T, typename Alloc>
     template <class InputIterator>
     void vector<T, Alloc>::insert( iterator position, InputIterator first, InputIterator last,
-                                    typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type * ) // range version // TASK: efficiency should be raised! (2x slower than std)
+                                    typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type * ) // range version
     {
         this->_insert_range( position, first, last, ft::iterator_category( first ) );
     }
 
     // (https://cplusplus.com/reference/vector/vector/erase/)
     // An invalid position or range causes undefined behavior.
+    // The tail is shifted down by assignment (or a single memmove for relocatable types),
+    // only the now surplus last slot gets destroyed.
     template <typename T, typename Alloc>
     typename vector<T, Alloc>::iterator vector<T, Alloc>::erase( iterator position )
     {
         pointer     p = this->_vmake_pointer( position );
 
-        if ( p == ( this->_end - 1 ) )
-            this->pop_back();
-        else
-        {
-            for ( pointer it = p; it != this->_end; ++it)
-            {
-                this->_allocator.destroy( it );
-                if ( ( it + 1 ) != this->_end )
-                    this->_allocator.construct( it, *( it + 1 ) );
-            }
-            --( this->_end );
-        }
+        this->_verase_range( p, p + 1, _relocatable() );
         return ( position );
     }
 
@@ -526,10 +590,26 @@ namespace ft
         pointer temp_last = this->_vmake_pointer( last );
 
         if ( first != last )
-            _vdestruct_at_end( ft::copy( temp_last, this->_end, temp_first ) );
+            this->_verase_range( temp_first, temp_last, _relocatable() );
         return ( first );
     }
 
+    // Not part of the C++98 standard.
+    // Removes the element at position in constant time, by moving the last element into its place.
+    // The order of the remaining elements is not preserved. Iterators, pointers and references
+    // pointing to position and to the last element are invalidated.
+    template <typename T, typename Alloc>
+    typename vector<T, Alloc>::iterator vector<T, Alloc>::unordered_erase( iterator position )
+    {
+        pointer     p = this->_vmake_pointer( position );
+
+        if ( p == ( this->_end - 1 ) )
+            this->pop_back();
+        else
+            this->_vreplace_with_last( p, _relocatable() );
+        return ( position );
+    }
+
 
     template <typename T, typename Alloc>
     void vector<T, Alloc>::swap( vector<T, Alloc>& x )
@@ -623,15 +703,6 @@ namespace ft
             this->_allocator.construct( this->_begin + i, val );
     }
 
-    template <typename T, typename Alloc>
-    void vector<T, Alloc>::_vconstruct_copies( const vector& other )
-    {
-        size_type temp_n = other.size();
-
-        for ( size_type i = 0; i < temp_n; ++i )
-            this->_allocator.construct( this->_begin + i, other[i] );
-    }
-
     template <typename T, typename Alloc>
     void vector<T, Alloc>::_vdestruct_at_end( pointer _new_end )
     {
@@ -656,6 +727,181 @@ namespace ft
         this->_end = this->_begin = temp_begin;
     }
 
+    template <typename T, typename Alloc>
+    void vector<T, Alloc>::_vconstruct_at_end( size_type n, const value_type& val )
+    {
+        for ( ; n > 0; --n, ++this->_end )
+            this->_allocator.construct( this->_end, val );
+    }
+
+    template <typename T, typename Alloc>
+    void vector<T, Alloc>::_vdefault_init_at_end( size_type n, ft::true_type )
+    {
+        this->_end += n;
+    }
+
+    template <typename T, typename Alloc>
+    void vector<T, Alloc>::_vdefault_init_at_end( size_type n, ft::false_type )
+    {
+        this->_vconstruct_at_end( n, value_type() );
+    }
+
+    template <typename T, typename Alloc>
+    template <class ForwardIterator>
+    void vector<T, Alloc>::_vconstruct_range_at_end( ForwardIterator first, ForwardIterator last )
+    {
+        for ( ; first != last; ++first, ++this->_end )
+            this->_allocator.construct( this->_end, *first );
+    }
+
+    template <typename T, typename Alloc>
+    void vector<T, Alloc>::_vreallocate( size_type n )
+    {
+        size_type   new_capacity = this->_vcalculate_size( n );
+
+        this->_vadopt_storage( this->_allocator.allocate( new_capacity ), new_capacity, this->_end, 0 );
+    }
+
+    // [begin, pos) is moved to the front of new_begin and [pos, end) behind the n slots
+    // following it, which the caller has filled already. The old storage is released.
+    template <typename T, typename Alloc>
+    void vector<T, Alloc>::_vadopt_storage( pointer new_begin, size_type new_capacity, pointer pos, size_type n )
+    {
+        size_type   old_size = this->size();
+
+        if ( this->_begin != nullptr )
+        {
+            this->_vrelocate( this->_begin, pos, new_begin, _relocatable() );
+            this->_vrelocate( pos, this->_end, new_begin + ( pos - this->_begin ) + n, _relocatable() );
+            this->_allocator.deallocate( this->_begin, this->_capacity );
+        }
+        this->_begin = new_begin;
+        this->_end = new_begin + old_size + n;
+        this->_capacity = new_capacity;
+    }
+
+    // [first, last) and dest never overlap. Afterwards dest holds the elements
+    // and [first, last) is raw memory again.
+    template <typename T, typename Alloc>
+    void vector<T, Alloc>::_vrelocate( pointer first, pointer last, pointer dest, ft::true_type )
+    {
+        if ( first != last )
+            std::memcpy( static_cast<void*>( dest ), static_cast<const void*>( first ), static_cast<size_type>( last - first ) * sizeof( value_type ) );
+    }
+
+    template <typename T, typename Alloc>
+    void vector<T, Alloc>::_vrelocate( pointer first, pointer last, pointer dest, ft::false_type )
+    {
+        for ( pointer it = first; it != last; ++it, ++dest )
+            this->_allocator.construct( dest, *it );
+        for ( ; first != last; ++first )
+            this->_allocator.destroy( first );
+    }
+
+    template <typename T, typename Alloc>
+    void vector<T, Alloc>::_vopen_gap( pointer pos, size_type n )
+    {
+        std::memmove( static_cast<void*>( pos + n ), static_cast<const void*>( pos ), static_cast<size_type>( this->_end - pos ) * sizeof( value_type ) );
+        this->_end += n;
+    }
+
+    template <typename T, typename Alloc>
+    void vector<T, Alloc>::_vinsert_fill( pointer pos, size_type n, const value_type& val, ft::true_type )
+    {
+        value_type  temp_val( val ); // val might be an element of the range about to be moved
+
+        this->_vopen_gap( pos, n );
+        for ( size_type i = 0; i < n; ++i )
+            this->_allocator.construct( pos + i, temp_val );
+    }
+
+    // The last n slots of the shifted range are raw memory and get copy constructed,
+    // everything else is already alive and gets assigned.
+    template <typename T, typename Alloc>
+    void vector<T, Alloc>::_vinsert_fill( pointer pos, size_type n, const value_type& val, ft::false_type )
+    {
+        value_type  temp_val( val ); // val might be an element of the range about to be shifted
+        pointer     old_end = this->_end;
+        size_type   elems_after = static_cast<size_type>( old_end - pos );
+
+        if ( elems_after > n )
+        {
+            this->_vconstruct_range_at_end( old_end - n, old_end );
+            ft::copy_backward( pos, old_end - n, old_end );
+            ft::fill( pos, pos + n, temp_val );
+        }
+        else
+        {
+            this->_vconstruct_at_end( n - elems_after, temp_val );
+            this->_vconstruct_range_at_end( pos, old_end );
+            ft::fill( pos, old_end, temp_val );
+        }
+    }
+
+    template <typename T, typename Alloc>
+    template <class ForwardIterator>
+    void vector<T, Alloc>::_vinsert_copy( pointer pos, ForwardIterator first, ForwardIterator last, size_type n, ft::true_type )
+    {
+        this->_vopen_gap( pos, n );
+        for ( ; first != last; ++first, ++pos )
+            this->_allocator.construct( pos, *first );
+    }
+
+    template <typename T, typename Alloc>
+    template <class ForwardIterator>
+    void vector<T, Alloc>::_vinsert_copy( pointer pos, ForwardIterator first, ForwardIterator last, size_type n, ft::false_type )
+    {
+        pointer     old_end = this->_end;
+        size_type   elems_after = static_cast<size_type>( old_end - pos );
+
+        if ( elems_after > n )
+        {
+            this->_vconstruct_range_at_end( old_end - n, old_end );
+            ft::copy_backward( pos, old_end - n, old_end );
+            ft::copy( first, last, pos );
+        }
+        else
+        {
+            ForwardIterator mid = first;
+
+            for ( size_type i = 0; i < elems_after; ++i )
+                ++mid;
+            this->_vconstruct_range_at_end( mid, last );
+            this->_vconstruct_range_at_end( pos, old_end );
+            ft::copy( first, mid, pos );
+        }
+    }
+
+    template <typename T, typename Alloc>
+    void vector<T, Alloc>::_verase_range( pointer first, pointer last, ft::true_type )
+    {
+        for ( pointer it = first; it != last; ++it )
+            this->_allocator.destroy( it );
+        std::memmove( static_cast<void*>( first ), static_cast<const void*>( last ), static_cast<size_type>( this->_end - last ) * sizeof( value_type ) );
+        this->_end -= ( last - first );
+    }
+
+    template <typename T, typename Alloc>
+    void vector<T, Alloc>::_verase_range( pointer first, pointer last, ft::false_type )
+    {
+        this->_vdestruct_at_end( ft::copy( last, this->_end, first ) );
+    }
+
+    template <typename T, typename Alloc>
+    void vector<T, Alloc>::_vreplace_with_last( pointer p, ft::true_type )
+    {
+        this->_allocator.destroy( p );
+        --this->_end;
+        std::memcpy( static_cast<void*>( p ), static_cast<const void*>( this->_end ), sizeof( value_type ) );
+    }
+
+    template <typename T, typename Alloc>
+    void vector<T, Alloc>::_vreplace_with_last( pointer p, ft::false_type )
+    {
+        *p = *( this->_end - 1 );
+        this->pop_back();
+    }
+
     template <typename T, typename Alloc>
     template <class InputIterator>
     void vector<T, Alloc>::_assign_range( InputIterator first, InputIterator last,
@@ -690,34 +936,21 @@ namespace ft
     {
         pointer         pos = this->_vmake_pointer( position );
         size_type       n = static_cast<size_type>( ft::distance( first, last ) );
-        size_type       distance = static_cast<size_type>( ft::distance( this->_begin, pos ) );
-        size_type       old_size = this->size();
 
-        if ( first == last )
+        if ( n == 0 )
             return ;
-        if ( position == this->end() )
-        {
-            for ( ; first != last; ++first )
-                this->push_back( *( first ) );
-        }
-        else
+        if ( n > this->_capacity - this->size() )
         {
-            this->resize( old_size + n );
-            iterator    temp_first = this->begin() + distance;
-            iterator    temp_last = this->begin() + old_size;
-            iterator    new_position = this->begin() + old_size + n;
+            size_type   new_capacity = this->_vcalculate_size( this->size() + n );
+            pointer     new_begin = this->_allocator.allocate( new_capacity );
+            pointer     gap = new_begin + ( pos - this->_begin );
 
-            while ( temp_last != temp_first )
-		        *( --new_position ) = *( --temp_last );
-
-            pos = this->_begin + distance;
-            for ( ; first != last; ++first )
-            {
-                this->_allocator.destroy(pos);
-                this->_allocator.construct(pos, *first);
-                ++pos;
-            }
+            for ( ; first != last; ++first, ++gap )
+                this->_allocator.construct( gap, *first );
+            this->_vadopt_storage( new_begin, new_capacity, pos, n );
         }
+        else
+            this->_vinsert_copy( pos, first, last, n, _relocatable() );
     }
 
    template <typename T, typename Alloc>
@@ -17,6 +17,10 @@
 #include <ctime>
 #include <string>
 #include <cstdlib>
+#include <deque>
+#include <algorithm>
+#include <sstream>
+#include <iterator>
 
 #define RESET   "\033[0m"
 #define GREEN   "\033[32m"
@@ -41,9 +45,25 @@ struct Buffer
     #include <vector>
     #include <map>
     #include <set>
+    #if __cplusplus >= 201103L
+        #include <unordered_map>
+        #include <unordered_set>
+        #define HAS_UNORDERED 1
+    #else
+        #define HAS_UNORDERED 0 // std::unordered_map and std::unordered_set need C++11
+    #endif
 
     #define FT "STD";
 
+    // the extensions are compared against the standard container with the same interface
+    #define compact_map map
+    #define compact_set set
+    #define btree_map map
+    #define btree_set set
+    #define flat_map map
+    #define flat_set set
+    #define frozen_set set
+
     namespace ft = std;
 
 #else
@@ -52,8 +72,18 @@ struct Buffer
     #include "./inc/vector.hpp"
     #include "./inc/map.hpp"
     #include "./inc/set.hpp"
+    #include "./inc/compact_map.hpp"
+    #include "./inc/compact_set.hpp"
+    #include "./inc/btree_map.hpp"
+    #include "./inc/btree_set.hpp"
+    #include "./inc/flat_map.hpp"
+    #include "./inc/flat_set.hpp"
+    #include "./inc/unordered_map.hpp"
+    #include "./inc/unordered_set.hpp"
+    #include "./inc/frozen_set.hpp"
 
     #define FT "FT";
+    #define HAS_UNORDERED 1
 
 #endif
 
@@ -77,6 +107,253 @@ public:
 	iterator end() { return this->c.end(); }
 };
 
+// A C++98 stand-in for std::to_string.
+inline std::string number_string(long n)
+{
+    std::ostringstream stream;
+
+    stream << n;
+    return stream.str();
+}
+
+// Prints a map element as key => value and a set element as it is.
+template <typename Key, typename T>
+void print_element(const ft::pair<const Key, T>& element) { std::cout << element.first << " => " << element.second; }
+
+template <typename T>
+void print_element(const T& element) { std::cout << element; }
+
+// Prints the element an insert with a hint returned, the size and the contents in order.
+template <typename Container>
+void print_hinted_insert(const Container& c, typename Container::const_iterator returned)
+{
+    std::cout << "returned: ";
+    print_element(*returned);
+    std::cout << ", size: " << c.size() << ", contents:";
+    for (typename Container::const_iterator it = c.begin(); it != c.end(); ++it)
+    {
+        std::cout << " ";
+        print_element(*it);
+    }
+    std::cout << std::endl;
+}
+
+// Unordered containers iterate in no particular order, so they are compared by their sorted contents.
+template <typename UnorderedMap>
+void print_sorted_map(const UnorderedMap& m)
+{
+    ft::vector<typename UnorderedMap::key_type> keys;
+    long checksum = 0;
+
+    for (typename UnorderedMap::const_iterator it = m.begin(); it != m.end(); ++it)
+        keys.push_back(it->first);
+    if (!keys.empty())
+        std::sort(&keys[0], &keys[0] + keys.size());
+    for (size_t i = 0; i < keys.size(); ++i)
+        checksum += static_cast<long>(i + 1) * (keys[i] + 7 * m.find(keys[i])->second);
+    std::cout << "size: " << m.size() << ", sorted checksum: " << checksum;
+    if (!keys.empty())
+        std::cout << ", first: " << keys[0] << " => " << m.find(keys[0])->second
+                  << ", last: " << keys[keys.size() - 1] << " => " << m.find(keys[keys.size() - 1])->second;
+    std::cout << std::endl;
+}
+
+template <typename UnorderedSet>
+void print_sorted_set(const UnorderedSet& s)
+{
+    ft::vector<typename UnorderedSet::key_type> contents;
+    long checksum = 0;
+
+    for (typename UnorderedSet::const_iterator it = s.begin(); it != s.end(); ++it)
+        contents.push_back(*it);
+    if (!contents.empty())
+        std::sort(&contents[0], &contents[0] + contents.size());
+    for (size_t i = 0; i < contents.size(); ++i)
+        checksum += static_cast<long>(i + 1) * contents[i];
+    std::cout << "size: " << s.size() << ", sorted checksum: " << checksum;
+    if (!contents.empty())
+        std::cout << ", first: " << contents[0] << ", last: " << contents[contents.size() - 1];
+    std::cout << std::endl;
+}
+
+// Prints a frozen set in both directions and probes every key from first_probe to last_probe.
+// A probe prints key:count/find/lower_bound/upper_bound/equal_range length, "e" standing for end().
+template <typename FrozenSet>
+void print_frozen_set(const FrozenSet& fs, int first_probe, int last_probe)
+{
+    typedef typename FrozenSet::const_iterator iterator;
+
+    std::cout << "size: " << fs.size() << ", empty: " << fs.empty() << std::endl;
+    std::cout << "forward:";
+    for (iterator it = fs.begin(); it != fs.end(); ++it)
+        std::cout << " " << *it;
+    std::cout << std::endl << "backward:";
+    for (iterator it = fs.end(); it != fs.begin();)
+        std::cout << " " << *--it;
+    std::cout << std::endl << "reverse:";
+    for (typename FrozenSet::const_reverse_iterator it = fs.rbegin(); it != fs.rend(); ++it)
+        std::cout << " " << *it;
+    std::cout << std::endl << "probes:";
+    for (int key = first_probe; key <= last_probe; ++key)
+    {
+        iterator found = fs.find(key);
+        iterator lower = fs.lower_bound(key);
+        iterator upper = fs.upper_bound(key);
+        ft::pair<iterator, iterator> range = fs.equal_range(key);
+
+        std::cout << " " << key << ":" << fs.count(key) << "/";
+        if (found == fs.end()) std::cout << "e"; else std::cout << *found;
+        std::cout << "/";
+        if (lower == fs.end()) std::cout << "e"; else std::cout << *lower;
+        std::cout << "/";
+        if (upper == fs.end()) std::cout << "e"; else std::cout << *upper;
+        std::cout << "/" << (range.first == lower && range.second == upper) << ft::distance(range.first, range.second);
+    }
+    std::cout << std::endl;
+}
+
+#if !STD
+
+// The key of a map element or of a set element, for the checks shared by ranked maps and sets.
+template <typename Key, typename T>
+const Key& element_key(const ft::pair<const Key, T>& element) { return element.first; }
+
+template <typename Key>
+const Key& element_key(const Key& element) { return element; }
+
+// Counts the elements of a ranked map or set where nth, rank and ft::distance disagree with the in-order position.
+template <typename Ranked>
+size_t count_rank_errors(const Ranked& c)
+{
+    size_t errors = 0;
+    size_t position = 0;
+
+    for (typename Ranked::const_iterator it = c.begin(); it != c.end(); ++it, ++position)
+    {
+        if (c.rank(element_key(*it)) != position || c.nth(c.rank(element_key(*it))) != it)
+            ++errors;
+        if (ft::distance(c.begin(), it) != static_cast<long>(position) || ft::distance(it, c.end()) != static_cast<long>(c.size() - position))
+            ++errors;
+    }
+    if (position != c.size() || c.nth(c.size()) != c.end() || ft::distance(c.begin(), c.end()) != static_cast<long>(c.size()))
+        ++errors;
+    return errors;
+}
+
+// A key that can only be looked up by its id with a transparent comparison: nothing converts an int into it.
+struct labelled_id
+{
+    int         id;
+    std::string label;
+};
+
+inline bool operator<(const labelled_id& lhs, const labelled_id& rhs) { return lhs.id < rhs.id; }
+inline bool operator<(const labelled_id& lhs, int rhs) { return lhs.id < rhs; }
+inline bool operator<(int lhs, const labelled_id& rhs) { return lhs < rhs.id; }
+
+// An iterator to the element at position n, found by walking from begin().
+template <typename Container>
+typename Container::iterator iterator_at(Container& c, size_t n)
+{
+    typename Container::iterator it = c.begin();
+
+    while (n--)
+        ++it;
+    return it;
+}
+
+// Extracts the positions [first, last) of c and checks both halves against a copy of the keys taken before.
+template <typename Container>
+void print_extract_range(Container c, size_t first, size_t last)
+{
+    ft::vector<typename Container::key_type> before;
+    ft::vector<typename Container::key_type> kept;
+    ft::vector<typename Container::key_type> moved;
+
+    for (typename Container::iterator it = c.begin(); it != c.end(); ++it)
+        before.push_back(element_key(*it));
+    Container extracted = c.extract_range(iterator_at(c, first), iterator_at(c, last));
+    for (typename Container::iterator it = c.begin(); it != c.end(); ++it)
+        kept.push_back(element_key(*it));
+    for (typename Container::iterator it = extracted.begin(); it != extracted.end(); ++it)
+        moved.push_back(element_key(*it));
+
+    bool ok = kept.size() == c.size() && moved.size() == extracted.size() && kept.size() + moved.size() == before.size()
+              && std::equal(before.begin(), before.begin() + first, kept.begin())
+              && std::equal(before.begin() + first, before.begin() + last, moved.begin())
+              && std::equal(before.begin() + last, before.end(), kept.begin() + first);
+
+    c.insert(extracted.begin(), extracted.end()); // both halves are still usable trees
+    extracted.clear();
+    kept.clear();
+    for (typename Container::iterator it = c.begin(); it != c.end(); ++it)
+        kept.push_back(element_key(*it));
+    ok = ok && kept.size() == before.size() && std::equal(before.begin(), before.end(), kept.begin()) && extracted.empty();
+    std::cout << "extract_range [" << first << ", " << last << ") of " << before.size() << ": extracted: " << moved.size()
+              << ", kept: " << before.size() - moved.size() << ", ok: " << ok << std::endl;
+}
+
+// Runs set_union, set_intersection and set_difference of a with b and compares them to the std algorithms.
+template <typename Set>
+void print_set_algebra(const Set& a, const Set& b)
+{
+    ft::vector<typename Set::value_type> expected;
+    Set result;
+    const char* names[] = {"union", "intersection", "difference"};
+
+    std::cout << a.size() << " with " << b.size() << ":";
+    for (int op = 0; op < 3; ++op)
+    {
+        expected.clear();
+        result = a;
+        if (op == 0)
+        {
+            std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+            result.set_union(b);
+        }
+        else if (op == 1)
+        {
+            std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+            result.set_intersection(b);
+        }
+        else
+        {
+            std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+            result.set_difference(b);
+        }
+
+        bool ok = result.size() == expected.size() && ft::distance(result.begin(), result.end()) == static_cast<long>(expected.size())
+                  && std::equal(expected.begin(), expected.end(), result.begin());
+
+        for (size_t i = 0; ok && i < expected.size(); ++i)
+            ok = result.count(expected[i]) == 1;
+        std::cout << " " << names[op] << ": " << result.size() << (ok ? "" : " (WRONG)");
+    }
+    std::cout << std::endl;
+}
+
+// Counts the (lo, hi) pairs in [first_key, last_key] where bounds( lo, hi ) differs from lower_bound( lo ) and
+// upper_bound( hi ), or from the empty range at lower_bound( lo ) for hi < lo.
+template <typename Container>
+size_t count_bounds_errors(const Container& c, int first_key, int last_key)
+{
+    size_t errors = 0;
+
+    for (int lo = first_key; lo <= last_key; ++lo)
+    {
+        for (int hi = first_key; hi <= last_key; ++hi)
+        {
+            ft::pair<typename Container::const_iterator, typename Container::const_iterator> range = c.bounds(lo, hi);
+
+            if (range.first != c.lower_bound(lo) || range.second != (hi < lo ? c.lower_bound(lo) : c.upper_bound(hi)))
+                ++errors;
+        }
+    }
+    return errors;
+}
+
+#endif
+
 int main()
 {
     std::cout << CYAN << "\n          ***************************" << std::endl;
@@ -904,6 +1181,87 @@ int main()
     // *itt > *c_itt = 0
     // itt > c_itt = 0
 
+#if !STD
+    /* ---------------------------------------------------------------------- */
+
+    // vector::unordered_erase (extension, ft only)
+    std::cout << "\n - vector::unordered_erase: " << std::endl;
+
+    ft::vector<std::string> swap_erase;
+
+    for (int i = 0; i < 6; ++i)
+        swap_erase.push_back(std::string(1, 'a' + i));
+    ft::vector<std::string>::iterator swap_it = swap_erase.unordered_erase(swap_erase.begin() + 1); // "f" takes the place of "b"
+    std::cout << "returned: " << *swap_it << ", contents:";
+    for (size_t i = 0; i < swap_erase.size(); ++i)
+        std::cout << " " << swap_erase[i];
+    swap_it = swap_erase.unordered_erase(swap_erase.end() - 1); // the last element itself
+    std::cout << std::endl << "erase last: returned end(): " << (swap_it == swap_erase.end()) << ", contents:";
+    for (size_t i = 0; i < swap_erase.size(); ++i)
+        std::cout << " " << swap_erase[i];
+    while (!swap_erase.empty())
+        swap_erase.unordered_erase(swap_erase.begin());
+    std::cout << std::endl << "erase begin() until empty: size: " << swap_erase.size() << ", capacity kept: " << (swap_erase.capacity() >= 6) << std::endl;
+
+    ft::vector<int> swap_erase_int;
+    long swap_erase_sum = 0;
+
+    for (int i = 0; i < 1000; ++i)
+        swap_erase_int.push_back(i);
+    for (ft::vector<int>::iterator it = swap_erase_int.begin(); it != swap_erase_int.end();)
+    {
+        if (*it % 3 == 0)
+            it = swap_erase_int.unordered_erase(it); // the moved-in element is checked next
+        else
+            ++it;
+    }
+    for (size_t i = 0; i < swap_erase_int.size(); ++i)
+        swap_erase_sum += swap_erase_int[i] % 3 == 0 ? -1000000 : swap_erase_int[i];
+    std::cout << "erase multiples of 3: size: " << swap_erase_int.size() << ", sum: " << swap_erase_sum << std::endl;
+
+    // Output: ***********************
+    // returned: f, contents: a f c d e
+    // erase last: returned end(): 1, contents: a f c d
+    // erase begin() until empty: size: 0, capacity kept: 1
+    // erase multiples of 3: size: 666, sum: 332667
+
+    /* ---------------------------------------------------------------------- */
+
+    // vector::resize_default_init (extension, ft only)
+    std::cout << "\n - vector::resize_default_init: " << std::endl;
+
+    ft::vector<int> raw_ints(3, 7);
+    long raw_sum = 0;
+
+    raw_ints.resize_default_init(1000); // the new ints stay uninitialized, so they are written before they are read
+    for (size_t i = 3; i < raw_ints.size(); ++i)
+        raw_ints[i] = static_cast<int>(i);
+    for (size_t i = 0; i < raw_ints.size(); ++i)
+        raw_sum += raw_ints[i];
+    std::cout << "grow: size: " << raw_ints.size() << ", capacity >= size: " << (raw_ints.capacity() >= raw_ints.size())
+              << ", kept: " << raw_ints[0] << " " << raw_ints[2] << ", sum: " << raw_sum << std::endl;
+    raw_ints.resize_default_init(2);
+    std::cout << "shrink: size: " << raw_ints.size() << ", kept: " << raw_ints[0] << " " << raw_ints[1] << std::endl;
+    raw_ints.resize_default_init(2);
+    std::cout << "same size: size: " << raw_ints.size() << std::endl;
+
+    ft::vector<std::string> raw_strings(2, "x");
+
+    raw_strings.resize_default_init(5); // a std::string is value-initialized
+    std::cout << "strings: size: " << raw_strings.size() << ", contents:";
+    for (size_t i = 0; i < raw_strings.size(); ++i)
+        std::cout << " \"" << raw_strings[i] << "\"";
+    raw_strings.resize_default_init(0);
+    std::cout << std::endl << "strings shrunk: empty: " << raw_strings.empty() << std::endl;
+
+    // Output: ***********************
+    // grow: size: 1000, capacity >= size: 1, kept: 7 7, sum: 499518
+    // shrink: size: 2, kept: 7 7
+    // same size: size: 2
+    // strings: size: 5, contents: "x" "x" "" "" ""
+    // strings shrunk: empty: 1
+#endif
+
     /* ---------------------------------------------------------------------- */
 
     // vector stress test from intra main
@@ -994,7 +1352,9 @@ int main()
 
     // Output: ***********************
     // test_map.size(): 1
-    // test_map.max_size(): 461168601842738790
+    // test_map.max_size(): 288230376151711743 (FT) / 230584300921369395 (STD)
+    //     expected to differ: ft::map keeps the colour in the parent pointer, so its
+    //     nodes take 32 instead of 40 bytes and max_size() is larger
     // test_map.size(): 2
     // test_map2.size(): 1
     // test_map2.size(): 2
@@ -1131,6 +1491,63 @@ int main()
 
     /* ---------------------------------------------------------------------- */
 
+    // map::insert with a hint
+    std::cout << "\n - map::insert with a hint: " << std::endl;
+
+    ft::map<int, char> hinted;
+
+    print_hinted_insert(hinted, hinted.insert(hinted.end(), ft::make_pair(50, 'a'))); // end() of an empty map
+    print_hinted_insert(hinted, hinted.insert(hinted.end(), ft::make_pair(70, 'b'))); // end(), after the last element
+    print_hinted_insert(hinted, hinted.insert(hinted.end(), ft::make_pair(60, 'c'))); // end(), but before the last element
+    print_hinted_insert(hinted, hinted.insert(hinted.begin(), ft::make_pair(10, 'd'))); // begin(), before the first element
+    print_hinted_insert(hinted, hinted.insert(hinted.find(50), ft::make_pair(40, 'e'))); // directly before the hint
+    print_hinted_insert(hinted, hinted.insert(hinted.find(50), ft::make_pair(55, 'f'))); // directly after the hint
+    print_hinted_insert(hinted, hinted.insert(hinted.begin(), ft::make_pair(65, 'g'))); // wrong hint, too far left
+    print_hinted_insert(hinted, hinted.insert(hinted.find(70), ft::make_pair(5, 'h'))); // wrong hint, too far right
+    print_hinted_insert(hinted, hinted.insert(hinted.find(40), ft::make_pair(40, 'i'))); // equal key at the hint
+    print_hinted_insert(hinted, hinted.insert(hinted.end(), ft::make_pair(10, 'j'))); // equal key, wrong hint
+
+    ft::map<int, int> hinted_big;
+    long hinted_checksum = 0;
+    long hinted_position = 0;
+
+    for (int i = 0; i < 5000; ++i)
+    {
+        int key = (i * 7919) % 5000;
+        ft::map<int, int>::iterator hint = hinted_big.lower_bound(key); // the element after key, or end()
+
+        if (i % 2 == 1 && hint != hinted_big.begin())
+            --hint; // the element before key
+        if (i % 7 == 3)
+            hint = hinted_big.begin(); // mostly wrong
+        if (hinted_big.insert(hint, ft::make_pair(key, i))->first != key)
+            std::cout << "wrong iterator returned for " << key << std::endl;
+    }
+    for (ft::map<int, int>::iterator it = hinted_big.begin(); it != hinted_big.end(); ++it)
+        hinted_checksum += ++hinted_position * (it->first + it->second);
+    for (int key = 0; key < 5000; key += 2)
+        hinted_big.erase(key);
+    hinted_position = 0;
+    for (ft::map<int, int>::reverse_iterator it = hinted_big.rbegin(); it != hinted_big.rend(); ++it)
+        ++hinted_position;
+    std::cout << "5000 hinted inserts: checksum: " << hinted_checksum << ", after erasing the even keys: size: " << hinted_big.size()
+              << ", reverse iteration: " << hinted_position << ", begin: " << hinted_big.begin()->first << ", rbegin: " << hinted_big.rbegin()->first << std::endl;
+
+    // Output: ***********************
+    // returned: 50 => a, size: 1, contents: 50 => a
+    // returned: 70 => b, size: 2, contents: 50 => a 70 => b
+    // returned: 60 => c, size: 3, contents: 50 => a 60 => c 70 => b
+    // returned: 10 => d, size: 4, contents: 10 => d 50 => a 60 => c 70 => b
+    // returned: 40 => e, size: 5, contents: 10 => d 40 => e 50 => a 60 => c 70 => b
+    // returned: 55 => f, size: 6, contents: 10 => d 40 => e 50 => a 55 => f 60 => c 70 => b
+    // returned: 65 => g, size: 7, contents: 10 => d 40 => e 50 => a 55 => f 60 => c 65 => g 70 => b
+    // returned: 5 => h, size: 8, contents: 5 => h 10 => d 40 => e 50 => a 55 => f 60 => c 65 => g 70 => b
+    // returned: 40 => e, size: 8, contents: 5 => h 10 => d 40 => e 50 => a 55 => f 60 => c 65 => g 70 => b
+    // returned: 10 => d, size: 8, contents: 5 => h 10 => d 40 => e 50 => a 55 => f 60 => c 65 => g 70 => b
+    // 5000 hinted inserts: checksum: 72956495000, after erasing the even keys: size: 2500, reverse iteration: 2500, begin: 1, rbegin: 4999
+
+    /* ---------------------------------------------------------------------- */
+
     // assignment operator with maps
     std::cout << "\n - assignment operator with maps: " << std::endl;
 
@@ -1151,6 +1568,278 @@ int main()
     // Size of kfirst: 0
     // Size of ksecond: 3
 
+#if !STD
+    /* ---------------------------------------------------------------------- */
+
+    // ranked map nth, rank & distance (extension, ft only)
+    std::cout << "\n - ranked map nth, rank & distance: " << std::endl;
+
+    typedef ft::map<int, int, ft::ranked<ft::less<int> > >  ranked_map;
+
+    ranked_map rmap;
+
+    for (int i = 0; i < 2000; ++i)
+        rmap[(i * 7919) % 2000] = i; // every key once, in shuffled order
+    std::cout << "after inserts: size: " << rmap.size() << ", errors: " << count_rank_errors(rmap) << std::endl;
+    std::cout << "nth(0): " << rmap.nth(0)->first << ", nth(1234): " << rmap.nth(1234)->first << ", rank(-5): " << rmap.rank(-5) << ", rank(5000): " << rmap.rank(5000) << std::endl;
+
+    for (int i = 0; i < 2000; ++i)
+        if ((i * 7919) % 2000 % 3 != 0)
+            rmap.erase((i * 7919) % 2000); // erases all over the tree, most of them rebalance
+    std::cout << "after erases: size: " << rmap.size() << ", errors: " << count_rank_errors(rmap) << std::endl;
+    std::cout << "nth(100): " << rmap.nth(100)->first << ", rank(301): " << rmap.rank(301) << ", rank(300): " << rmap.rank(300) << std::endl;
+
+    rmap.erase(rmap.nth(100), rmap.nth(400));
+    std::cout << "after range erase: size: " << rmap.size() << ", errors: " << count_rank_errors(rmap) << std::endl;
+    std::cout << "nth(99): " << rmap.nth(99)->first << ", nth(100): " << rmap.nth(100)->first << ", rank(1500): " << rmap.rank(1500) << std::endl;
+
+    while (rmap.size() > 1)
+        rmap.erase(rmap.nth(rmap.size() / 2));
+    std::cout << "down to one: nth(0): " << rmap.nth(0)->first << ", errors: " << count_rank_errors(rmap) << std::endl;
+    rmap.clear();
+    std::cout << "cleared: nth(0) == end(): " << (rmap.nth(0) == rmap.end()) << ", rank(0): " << rmap.rank(0) << ", errors: " << count_rank_errors(rmap) << std::endl;
+
+    // Output: ***********************
+    // after inserts: size: 2000, errors: 0
+    // nth(0): 0, nth(1234): 1234, rank(-5): 0, rank(5000): 2000
+    // after erases: size: 667, errors: 0
+    // nth(100): 300, rank(301): 101, rank(300): 100
+    // after range erase: size: 367, errors: 0
+    // nth(99): 297, nth(100): 1200, rank(1500): 200
+    // down to one: nth(0): 0, errors: 0
+    // cleared: nth(0) == end(): 1, rank(0): 0, errors: 0
+
+    /* ---------------------------------------------------------------------- */
+
+    // map extract_range (extension, ft only)
+    std::cout << "\n - map extract_range: " << std::endl;
+
+    ft::map<int, int> emap;
+    ranked_map remap;
+
+    for (int i = 0; i < 100; ++i)
+    {
+        emap[(i * 37) % 100 * 3] = i;
+        remap[(i * 37) % 100 * 3] = i;
+    }
+    print_extract_range(ft::map<int, int>(), 0, 0);
+    print_extract_range(emap, 0, 0);
+    print_extract_range(emap, 50, 50);
+    print_extract_range(emap, 0, 100);
+    print_extract_range(emap, 0, 30);
+    print_extract_range(emap, 70, 100);
+    print_extract_range(emap, 20, 60);
+    print_extract_range(remap, 0, 100);
+    print_extract_range(remap, 20, 60);
+    print_extract_range(remap, 99, 100);
+
+    ranked_map rextracted = remap.extract_range(remap.nth(10), remap.nth(90));
+    std::cout << "ranked: errors: " << count_rank_errors(remap) << ", extracted errors: " << count_rank_errors(rextracted) << std::endl;
+
+    // Output: ***********************
+    // extract_range [0, 0) of 0: extracted: 0, kept: 0, ok: 1
+    // extract_range [0, 0) of 100: extracted: 0, kept: 100, ok: 1
+    // extract_range [50, 50) of 100: extracted: 0, kept: 100, ok: 1
+    // extract_range [0, 100) of 100: extracted: 100, kept: 0, ok: 1
+    // extract_range [0, 30) of 100: extracted: 30, kept: 70, ok: 1
+    // extract_range [70, 100) of 100: extracted: 30, kept: 70, ok: 1
+    // extract_range [20, 60) of 100: extracted: 40, kept: 60, ok: 1
+    // extract_range [0, 100) of 100: extracted: 100, kept: 0, ok: 1
+    // extract_range [20, 60) of 100: extracted: 40, kept: 60, ok: 1
+    // extract_range [99, 100) of 100: extracted: 1, kept: 99, ok: 1
+    // ranked: errors: 0, extracted errors: 0
+
+    /* ---------------------------------------------------------------------- */
+
+    // map with ft::pool_allocator (extension, ft only)
+    std::cout << "\n - map with pool_allocator: " << std::endl;
+
+    typedef ft::map<int, int, ft::less<int>, ft::pool_allocator<ft::pair<const int, int> > >                  pool_map;
+    typedef ft::map<int, std::string, ft::less<int>, ft::pool_allocator<ft::pair<const int, std::string> > >  pool_string_map;
+
+    pool_map pmap;
+
+    for (int i = 0; i < 10000; ++i)
+        pmap[(i * 7919) % 10000] = i;
+    std::cout << "size: " << pmap.size() << ", in_use(): " << pmap.get_allocator().in_use() << std::endl;
+
+    pool_map pcopy(pmap); // shares the pool of pmap
+    pool_map passigned;
+
+    passigned = pmap; // keeps a pool of its own
+    std::cout << "copy: equal: " << (pcopy == pmap) << ", in_use(): " << pcopy.get_allocator().in_use()
+              << ", assigned: equal: " << (passigned == pmap) << ", in_use(): " << passigned.get_allocator().in_use() << std::endl;
+
+    pmap.clear();
+    std::cout << "clear(): in_use(): " << pmap.get_allocator().in_use() << ", release(): " << pmap.get_allocator().release()
+              << ", copy: " << pcopy.begin()->second << " ... " << pcopy.rbegin()->second << std::endl;
+    pcopy.clear();
+    std::cout << "clear() of the copy: in_use(): " << pmap.get_allocator().in_use() << ", release(): " << pmap.get_allocator().release() << std::endl;
+
+    for (int i = 0; i < 100; ++i)
+        pmap[i] = i;
+    pmap.clear();
+    pmap.get_allocator().purge();
+    for (int i = 0; i < 10; ++i)
+        pmap[i] = i * i;
+    std::cout << "after purge(): size: " << pmap.size() << ", in_use(): " << pmap.get_allocator().in_use() << ", pmap[9]: " << pmap[9] << std::endl;
+
+    pool_string_map pstrings;
+
+    for (int i = 0; i < 1000; ++i)
+        pstrings[i] = number_string(i * i);
+    pool_string_map pstrings_copy(pstrings);
+    std::cout << "string map: in_use(): " << pstrings.get_allocator().in_use() << ", copy[999]: " << pstrings_copy[999];
+    pstrings.clear();
+    pstrings_copy.clear();
+    std::cout << ", after clear(): in_use(): " << pstrings.get_allocator().in_use() << ", release(): " << pstrings.get_allocator().release() << std::endl;
+
+    // Output: ***********************
+    // size: 10000, in_use(): 10000
+    // copy: equal: 1, in_use(): 20000, assigned: equal: 1, in_use(): 10000
+    // clear(): in_use(): 10000, release(): 0, copy: 0 ... 2321
+    // clear() of the copy: in_use(): 0, release(): 1
+    // after purge(): size: 10, in_use(): 10, pmap[9]: 81
+    // string map: in_use(): 2000, copy[999]: 998001, after clear(): in_use(): 0, release(): 1
+
+    /* ---------------------------------------------------------------------- */
+
+    // map from sorted unique ranges (extension, ft only)
+    std::cout << "\n - map from sorted unique ranges: " << std::endl;
+
+    ft::vector<ft::pair<int, int> > sorted_pairs;
+    size_t sorted_mismatches = 0;
+
+    for (int i = 0; i < 1000; ++i)
+        sorted_pairs.push_back(ft::make_pair(i * 2, i));
+    for (size_t n = 0; n <= 70; ++n)
+    {
+        ft::map<int, int> built(ft::sorted_unique, sorted_pairs.begin(), sorted_pairs.begin() + n);
+        ft::map<int, int> inserted(sorted_pairs.begin(), sorted_pairs.begin() + n);
+
+        if (built != inserted)
+            ++sorted_mismatches;
+        for (int key = 0; key < static_cast<int>(n) * 2; key += 3)
+        {
+            built.erase(key); // the built tree has to stay balanced under erase and insert
+            inserted.erase(key);
+            built[key + 1] = key;
+            inserted[key + 1] = key;
+        }
+        if (built != inserted || built.size() != inserted.size())
+            ++sorted_mismatches;
+    }
+    std::cout << "sizes 0 to 70, mismatches against insert: " << sorted_mismatches << std::endl;
+
+    ft::map<int, int> sorted_map(ft::sorted_unique, sorted_pairs.begin(), sorted_pairs.end());
+
+    std::cout << "constructor: size: " << sorted_map.size() << ", begin: " << sorted_map.begin()->first
+              << ", rbegin: " << sorted_map.rbegin()->first << ", find(1000): " << sorted_map.find(1000)->second << std::endl;
+
+    ft::map<int, int> sorted_into;
+
+    sorted_into.insert(ft::sorted_unique, sorted_pairs.begin(), sorted_pairs.begin() + 500); // into an empty map
+    sorted_into.insert(ft::sorted_unique, sorted_pairs.begin() + 250, sorted_pairs.end()); // overlaps the keys already in the map
+    std::cout << "insert: size: " << sorted_into.size() << ", equal to the constructed map: " << (sorted_into == sorted_map) << std::endl;
+
+    // Output: ***********************
+    // sizes 0 to 70, mismatches against insert: 0
+    // constructor: size: 1000, begin: 0, rbegin: 1998, find(1000): 500
+    // insert: size: 1000, equal to the constructed map: 1
+
+    /* ---------------------------------------------------------------------- */
+
+    // map heterogeneous find & lower_bound with ft::less<void> (extension, ft only)
+    std::cout << "\n - map heterogeneous lookup: " << std::endl;
+
+    ft::map<std::string, int, ft::less<void> > fruit_prices;
+    const char* pear = "pear";
+
+    fruit_prices["apple"] = 3;
+    fruit_prices["cherry"] = 12;
+    fruit_prices["pear"] = 4;
+    fruit_prices["plum"] = 6;
+
+    const ft::map<std::string, int, ft::less<void> >& const_prices = fruit_prices;
+
+    std::cout << "find(pear): " << fruit_prices.find(pear)->second << ", find(\"kiwi\") == end(): " << (fruit_prices.find("kiwi") == fruit_prices.end())
+              << ", const find(\"plum\"): " << const_prices.find("plum")->second << std::endl;
+    std::cout << "lower_bound(\"b\"): " << fruit_prices.lower_bound("b")->first << ", lower_bound(\"pear\"): " << fruit_prices.lower_bound("pear")->first
+              << ", const lower_bound(\"pz\") == end(): " << (const_prices.lower_bound("pz") == const_prices.end()) << std::endl;
+    fruit_prices.find("cherry")->second = 10;
+    std::cout << "after find(\"cherry\")->second = 10: " << fruit_prices["cherry"] << std::endl;
+
+    // Output: ***********************
+    // find(pear): 4, find("kiwi") == end(): 1, const find("plum"): 6
+    // lower_bound("b"): cherry, lower_bound("pear"): pear, const lower_bound("pz") == end(): 1
+    // after find("cherry")->second = 10: 10
+
+    /* ---------------------------------------------------------------------- */
+
+    // map::try_insert & map::insert_or_assign (extension, ft only)
+    std::cout << "\n - map::try_insert & map::insert_or_assign: " << std::endl;
+
+    ft::map<int, std::string> colours;
+    ft::pair<ft::map<int, std::string>::iterator, bool> colour_result;
+
+    colour_result = colours.try_insert(1, "red");
+    std::cout << "try_insert(1, red): " << colour_result.first->first << " => " << colour_result.first->second << ", inserted: " << colour_result.second << std::endl;
+    colour_result = colours.try_insert(1, "blue");
+    std::cout << "try_insert(1, blue): " << colour_result.first->first << " => " << colour_result.first->second << ", inserted: " << colour_result.second << std::endl;
+    colour_result = colours.insert_or_assign(1, "green");
+    std::cout << "insert_or_assign(1, green): " << colour_result.first->first << " => " << colour_result.first->second << ", inserted: " << colour_result.second << std::endl;
+    colour_result = colours.insert_or_assign(2, "yellow");
+    std::cout << "insert_or_assign(2, yellow): " << colour_result.first->first << " => " << colour_result.first->second << ", inserted: " << colour_result.second << std::endl;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        colours.try_insert(i % 100, "first");
+        colours.insert_or_assign(i % 50, number_string(i));
+    }
+    std::cout << "size: " << colours.size() << ", [1]: " << colours[1] << ", [49]: " << colours[49] << ", [50]: " << colours[50]
+              << ", [99]: " << colours[99] << std::endl;
+
+    // Output: ***********************
+    // try_insert(1, red): 1 => red, inserted: 1
+    // try_insert(1, blue): 1 => red, inserted: 0
+    // insert_or_assign(1, green): 1 => green, inserted: 0
+    // insert_or_assign(2, yellow): 2 => yellow, inserted: 1
+    // size: 100, [1]: 951, [49]: 999, [50]: first, [99]: first
+
+    /* ---------------------------------------------------------------------- */
+
+    // map::bounds (extension, ft only)
+    std::cout << "\n - map::bounds: " << std::endl;
+
+    ft::map<int, int> bounded;
+
+    std::cout << "empty map: errors: " << count_bounds_errors(bounded, -2, 2) << std::endl;
+    for (int i = 0; i < 100; ++i)
+        bounded[(i * 37) % 100 * 3] = i;
+    std::cout << "keys 0, 3, ..., 297: errors: " << count_bounds_errors(bounded, -2, 300) << std::endl;
+
+    ft::pair<ft::map<int, int>::iterator, ft::map<int, int>::iterator> bounded_range = bounded.bounds(10, 20);
+
+    std::cout << "bounds(10, 20):";
+    for (ft::map<int, int>::iterator it = bounded_range.first; it != bounded_range.second; ++it)
+        std::cout << " " << it->first;
+    bounded_range = bounded.bounds(12, 12);
+    std::cout << std::endl << "bounds(12, 12): " << bounded_range.first->first << ", distance: " << ft::distance(bounded_range.first, bounded_range.second);
+    bounded_range = bounded.bounds(20, 10);
+    std::cout << std::endl << "bounds(20, 10): empty: " << (bounded_range.first == bounded_range.second) << ", at: " << bounded_range.first->first << std::endl;
+    bounded_range = bounded.bounds(280, 1000);
+    bounded.erase(bounded_range.first, bounded_range.second);
+    std::cout << "after erase(bounds(280, 1000)): size: " << bounded.size() << ", rbegin: " << bounded.rbegin()->first << std::endl;
+
+    // Output: ***********************
+    // empty map: errors: 0
+    // keys 0, 3, ..., 297: errors: 0
+    // bounds(10, 20): 12 15 18
+    // bounds(12, 12): 12, distance: 1
+    // bounds(20, 10): empty: 1, at: 21
+    // after erase(bounds(280, 1000)): size: 94, rbegin: 279
+#endif
+
     /* ---------------------------------------------------------------------- */
     
     // insert & erase big map
@@ -1207,7 +1896,8 @@ int main()
 
     // Output: ***********************
     // test_set.size(): 1
-    // test_set.max_size(): 576460752303423487
+    // test_set.max_size(): 288230376151711743 (FT) / 230584300921369395 (STD)
+    //     expected to differ, like test_map.max_size()
     // test_set.size(): 2
     // test_set2.size(): 1
     // test_set2.size(): 2
@@ -1344,6 +2034,63 @@ int main()
 
     /* ---------------------------------------------------------------------- */
 
+    // set::insert with a hint
+    std::cout << "\n - set::insert with a hint: " << std::endl;
+
+    ft::set<int> hinted_set;
+
+    print_hinted_insert(hinted_set, hinted_set.insert(hinted_set.end(), 50)); // end() of an empty set
+    print_hinted_insert(hinted_set, hinted_set.insert(hinted_set.end(), 70)); // end(), after the last element
+    print_hinted_insert(hinted_set, hinted_set.insert(hinted_set.end(), 60)); // end(), but before the last element
+    print_hinted_insert(hinted_set, hinted_set.insert(hinted_set.begin(), 10)); // begin(), before the first element
+    print_hinted_insert(hinted_set, hinted_set.insert(hinted_set.find(50), 40)); // directly before the hint
+    print_hinted_insert(hinted_set, hinted_set.insert(hinted_set.find(50), 55)); // directly after the hint
+    print_hinted_insert(hinted_set, hinted_set.insert(hinted_set.begin(), 65)); // wrong hint, too far left
+    print_hinted_insert(hinted_set, hinted_set.insert(hinted_set.find(70), 5)); // wrong hint, too far right
+    print_hinted_insert(hinted_set, hinted_set.insert(hinted_set.find(40), 40)); // equal value at the hint
+    print_hinted_insert(hinted_set, hinted_set.insert(hinted_set.end(), 10)); // equal value, wrong hint
+
+    ft::set<int> hinted_big_set;
+    long hinted_set_checksum = 0;
+    long hinted_set_position = 0;
+
+    for (int i = 0; i < 5000; ++i)
+    {
+        int value = (i * 7919) % 5000;
+        ft::set<int>::iterator hint = hinted_big_set.lower_bound(value); // the element after value, or end()
+
+        if (i % 2 == 1 && hint != hinted_big_set.begin())
+            --hint; // the element before value
+        if (i % 7 == 3)
+            hint = hinted_big_set.begin(); // mostly wrong
+        if (*hinted_big_set.insert(hint, value) != value)
+            std::cout << "wrong iterator returned for " << value << std::endl;
+    }
+    for (ft::set<int>::iterator it = hinted_big_set.begin(); it != hinted_big_set.end(); ++it)
+        hinted_set_checksum += ++hinted_set_position * *it;
+    for (int value = 0; value < 5000; value += 2)
+        hinted_big_set.erase(value);
+    hinted_set_position = 0;
+    for (ft::set<int>::reverse_iterator it = hinted_big_set.rbegin(); it != hinted_big_set.rend(); ++it)
+        ++hinted_set_position;
+    std::cout << "5000 hinted inserts: checksum: " << hinted_set_checksum << ", after erasing the even values: size: " << hinted_big_set.size()
+              << ", reverse iteration: " << hinted_set_position << ", begin: " << *hinted_big_set.begin() << ", rbegin: " << *hinted_big_set.rbegin() << std::endl;
+
+    // Output: ***********************
+    // returned: 50, size: 1, contents: 50
+    // returned: 70, size: 2, contents: 50 70
+    // returned: 60, size: 3, contents: 50 60 70
+    // returned: 10, size: 4, contents: 10 50 60 70
+    // returned: 40, size: 5, contents: 10 40 50 60 70
+    // returned: 55, size: 6, contents: 10 40 50 55 60 70
+    // returned: 65, size: 7, contents: 10 40 50 55 60 65 70
+    // returned: 5, size: 8, contents: 5 10 40 50 55 60 65 70
+    // returned: 40, size: 8, contents: 5 10 40 50 55 60 65 70
+    // returned: 10, size: 8, contents: 5 10 40 50 55 60 65 70
+    // 5000 hinted inserts: checksum: 41666665000, after erasing the even values: size: 2500, reverse iteration: 2500, begin: 1, rbegin: 4999
+
+    /* ---------------------------------------------------------------------- */
+
     // assignment operator with sets
     std::cout << "\n - assignment operator with sets: " << std::endl;
 
@@ -1364,6 +2111,281 @@ int main()
     // Size of sfirst: 0
     // Size of ssecond: 3
 
+#if !STD
+    /* ---------------------------------------------------------------------- */
+
+    // ranked set nth, rank & distance (extension, ft only)
+    std::cout << "\n - ranked set nth, rank & distance: " << std::endl;
+
+    typedef ft::set<int, ft::ranked<ft::less<int> > >       ranked_set;
+
+    ranked_set rset;
+
+    for (int i = 0; i < 3000; ++i)
+        rset.insert((i * 7919) % 3000 * 2); // even keys only, in shuffled order
+    std::cout << "after inserts: size: " << rset.size() << ", errors: " << count_rank_errors(rset) << std::endl;
+    std::cout << "rank(1001): " << rset.rank(1001) << ", *nth(rank(1001)): " << *rset.nth(rset.rank(1001)) << std::endl;
+
+    for (int i = 0; i < 3000; i += 2)
+        rset.erase(rset.nth(i / 2)); // every other element, from the left to the right
+    std::cout << "after erases: size: " << rset.size() << ", errors: " << count_rank_errors(rset) << std::endl;
+    std::cout << "nth(0): " << *rset.nth(0) << ", nth(1499): " << *rset.nth(1499) << ", nth(1500) == end(): " << (rset.nth(1500) == rset.end()) << std::endl;
+
+    for (int key = 5998; key >= 0; key -= 4)
+        rset.erase(key); // everything again, from the right to the left
+    std::cout << "after all erases: size: " << rset.size() << ", errors: " << count_rank_errors(rset) << std::endl;
+
+    // Output: ***********************
+    // after inserts: size: 3000, errors: 0
+    // rank(1001): 501, *nth(rank(1001)): 1002
+    // after erases: size: 1500, errors: 0
+    // nth(0): 2, nth(1499): 5998, nth(1500) == end(): 1
+    // after all erases: size: 0, errors: 0
+
+    /* ---------------------------------------------------------------------- */
+
+    // set extract_range (extension, ft only)
+    std::cout << "\n - set extract_range: " << std::endl;
+
+    ft::set<int> eset;
+
+    for (int i = 0; i < 1000; ++i)
+        eset.insert((i * 7919) % 1000);
+    print_extract_range(ft::set<int>(), 0, 0);
+    print_extract_range(eset, 0, 0);
+    print_extract_range(eset, 1000, 1000);
+    print_extract_range(eset, 0, 1000);
+    print_extract_range(eset, 0, 1);
+    print_extract_range(eset, 0, 500);
+    print_extract_range(eset, 500, 1000);
+    print_extract_range(eset, 333, 334);
+    print_extract_range(eset, 100, 900);
+
+    // Output: ***********************
+    // extract_range [0, 0) of 0: extracted: 0, kept: 0, ok: 1
+    // extract_range [0, 0) of 1000: extracted: 0, kept: 1000, ok: 1
+    // extract_range [1000, 1000) of 1000: extracted: 0, kept: 1000, ok: 1
+    // extract_range [0, 1000) of 1000: extracted: 1000, kept: 0, ok: 1
+    // extract_range [0, 1) of 1000: extracted: 1, kept: 999, ok: 1
+    // extract_range [0, 500) of 1000: extracted: 500, kept: 500, ok: 1
+    // extract_range [500, 1000) of 1000: extracted: 500, kept: 500, ok: 1
+    // extract_range [333, 334) of 1000: extracted: 1, kept: 999, ok: 1
+    // extract_range [100, 900) of 1000: extracted: 800, kept: 200, ok: 1
+
+    /* ---------------------------------------------------------------------- */
+
+    // set_union, set_intersection & set_difference (extension, ft only)
+    std::cout << "\n - set_union, set_intersection & set_difference: " << std::endl;
+
+    ft::set<int> no_keys;
+    ft::set<int> evens;
+    ft::set<int> odds;
+    ft::set<int> threes;
+    ft::set<int> low_keys;
+    ft::set<int> high_keys;
+    ft::set<int> many_keys;
+    ft::set<int> few_keys;
+
+    for (int i = 0; i < 100; ++i)
+    {
+        evens.insert(i * 2);
+        odds.insert(i * 2 + 1);
+        threes.insert(i * 3);
+        low_keys.insert(i);
+        high_keys.insert(i + 1000);
+    }
+    srand(7);
+    for (int i = 0; i < 5000; ++i)
+        many_keys.insert(std::rand() % 20000);
+    for (int i = 0; i < 50; ++i)
+        few_keys.insert(std::rand() % 20000);
+    print_set_algebra(no_keys, no_keys);
+    print_set_algebra(no_keys, evens);
+    print_set_algebra(evens, no_keys);
+    print_set_algebra(evens, evens);
+    print_set_algebra(evens, odds);
+    print_set_algebra(evens, threes);
+    print_set_algebra(low_keys, high_keys);
+    print_set_algebra(high_keys, low_keys);
+    print_set_algebra(low_keys, evens);
+    print_set_algebra(many_keys, few_keys);
+    print_set_algebra(few_keys, many_keys);
+
+    ft::set<int> self_union(evens);
+    ft::set<int> self_intersection(evens);
+    ft::set<int> self_difference(evens);
+
+    self_union.set_union(self_union);
+    self_intersection.set_intersection(self_intersection);
+    self_difference.set_difference(self_difference);
+    std::cout << "with itself: union: " << self_union.size() << ", intersection: " << self_intersection.size()
+              << ", difference: " << self_difference.size() << std::endl;
+
+    ranked_set ranked_many(many_keys.begin(), many_keys.end());
+    ranked_set ranked_threes(threes.begin(), threes.end());
+
+    print_set_algebra(ranked_many, ranked_threes);
+    ranked_many.set_union(ranked_threes);
+    std::cout << "ranked union errors: " << count_rank_errors(ranked_many);
+    ranked_many.set_difference(ranked_threes);
+    std::cout << ", difference errors: " << count_rank_errors(ranked_many);
+    ranked_many.set_intersection(ranked_set(few_keys.begin(), few_keys.end()));
+    std::cout << ", intersection errors: " << count_rank_errors(ranked_many) << std::endl;
+
+    // Output: ***********************
+    // 0 with 0: union: 0 intersection: 0 difference: 0
+    // 0 with 100: union: 100 intersection: 0 difference: 0
+    // 100 with 0: union: 100 intersection: 0 difference: 100
+    // 100 with 100: union: 100 intersection: 100 difference: 0
+    // 100 with 100: union: 200 intersection: 0 difference: 100
+    // 100 with 100: union: 166 intersection: 34 difference: 66
+    // 100 with 100: union: 200 intersection: 0 difference: 100
+    // 100 with 100: union: 200 intersection: 0 difference: 100
+    // 100 with 100: union: 150 intersection: 50 difference: 50
+    // 4446 with 50: union: 4487 intersection: 9 difference: 4437
+    // 50 with 4446: union: 4487 intersection: 9 difference: 41
+    // with itself: union: 100, intersection: 100, difference: 0
+    // 4446 with 100: union: 4524 intersection: 22 difference: 4424
+    // ranked union errors: 0, difference errors: 0, intersection errors: 0
+
+    /* ---------------------------------------------------------------------- */
+
+    // set with ft::pool_allocator (extension, ft only)
+    std::cout << "\n - set with pool_allocator: " << std::endl;
+
+    typedef ft::set<std::string, ft::less<std::string>, ft::pool_allocator<std::string> >  pool_set;
+
+    pool_set pset;
+
+    for (int i = 0; i < 5000; ++i)
+        pset.insert(number_string((i * 7919) % 5000));
+    pool_set pset_copy(pset);
+    pool_set pset_assigned;
+
+    pset_assigned = pset;
+    std::cout << "size: " << pset.size() << ", in_use(): " << pset.get_allocator().in_use()
+              << ", assigned in_use(): " << pset_assigned.get_allocator().in_use()
+              << ", equal: " << (pset == pset_copy && pset == pset_assigned) << std::endl;
+
+    pset.clear();
+    std::cout << "clear(): in_use(): " << pset.get_allocator().in_use() << ", release(): " << pset.get_allocator().release()
+              << ", copy: " << *pset_copy.begin() << " ... " << *pset_copy.rbegin() << std::endl;
+    pset_copy.clear();
+    pset_assigned.clear();
+    std::cout << "clear() of both copies: in_use(): " << pset.get_allocator().in_use() << ", release(): " << pset.get_allocator().release()
+              << ", assigned in_use(): " << pset_assigned.get_allocator().in_use() << std::endl;
+
+    pset_assigned.get_allocator().purge();
+    pset_assigned.insert("after purge");
+    std::cout << "after purge(): " << *pset_assigned.begin() << ", in_use(): " << pset_assigned.get_allocator().in_use() << std::endl;
+
+    // Output: ***********************
+    // size: 5000, in_use(): 10000, assigned in_use(): 5000, equal: 1
+    // clear(): in_use(): 5000, release(): 0, copy: 0 ... 999
+    // clear() of both copies: in_use(): 0, release(): 1, assigned in_use(): 0
+    // after purge(): after purge, in_use(): 1
+
+    /* ---------------------------------------------------------------------- */
+
+    // set from sorted unique ranges (extension, ft only)
+    std::cout << "\n - set from sorted unique ranges: " << std::endl;
+
+    ft::vector<int> sorted_values;
+
+    for (int i = 0; i < 100; ++i)
+        sorted_values.push_back(i * 5);
+
+    ft::set<int> sorted_set(ft::sorted_unique, sorted_values.begin(), sorted_values.end());
+
+    sorted_set.erase(50);
+    sorted_set.insert(51);
+    std::cout << "constructor: size: " << sorted_set.size() << ", count(50): " << sorted_set.count(50)
+              << ", count(51): " << sorted_set.count(51) << ", rbegin: " << *sorted_set.rbegin() << std::endl;
+
+    std::istringstream sorted_stream("1 2 3 5 8 13 21 34 55 89");
+    ft::set<int> streamed_set(ft::sorted_unique, std::istream_iterator<int>(sorted_stream), std::istream_iterator<int>()); // single pass
+
+    std::cout << "input iterator constructor: size: " << streamed_set.size() << ", contents:";
+    for (ft::set<int>::iterator it = streamed_set.begin(); it != streamed_set.end(); ++it)
+        std::cout << " " << *it;
+
+    std::istringstream more_stream("0 4 8 100");
+
+    streamed_set.insert(ft::sorted_unique, std::istream_iterator<int>(more_stream), std::istream_iterator<int>());
+    std::cout << std::endl << "input iterator insert: size: " << streamed_set.size() << ", contents:";
+    for (ft::set<int>::iterator it = streamed_set.begin(); it != streamed_set.end(); ++it)
+        std::cout << " " << *it;
+    std::cout << std::endl;
+
+    // Output: ***********************
+    // constructor: size: 100, count(50): 0, count(51): 1, rbegin: 495
+    // input iterator constructor: size: 10, contents: 1 2 3 5 8 13 21 34 55 89
+    // input iterator insert: size: 13, contents: 0 1 2 3 4 5 8 13 21 34 55 89 100
+
+    /* ---------------------------------------------------------------------- */
+
+    // set heterogeneous find & lower_bound with ft::less<void> (extension, ft only)
+    std::cout << "\n - set heterogeneous lookup: " << std::endl;
+
+    ft::set<labelled_id, ft::less<void> > labelled;
+
+    for (int i = 0; i < 10; ++i)
+    {
+        labelled_id element;
+
+        element.id = i * 10;
+        element.label = "id " + number_string(i * 10);
+        labelled.insert(element);
+    }
+    std::cout << "find(40): " << labelled.find(40)->label << ", find(45) == end(): " << (labelled.find(45) == labelled.end())
+              << ", lower_bound(45): " << labelled.lower_bound(45)->label << ", lower_bound(-5): " << labelled.lower_bound(-5)->label
+              << ", lower_bound(95) == end(): " << (labelled.lower_bound(95) == labelled.end()) << std::endl;
+
+    ft::set<std::string, ft::less<void> > words_by_string;
+
+    words_by_string.insert("beta");
+    words_by_string.insert("alpha");
+    words_by_string.insert("gamma");
+    std::cout << "find(\"beta\"): " << *words_by_string.find("beta") << ", lower_bound(\"c\"): " << *words_by_string.lower_bound("c") << std::endl;
+
+    // Output: ***********************
+    // find(40): id 40, find(45) == end(): 1, lower_bound(45): id 50, lower_bound(-5): id 0, lower_bound(95) == end(): 1
+    // find("beta"): beta, lower_bound("c"): gamma
+
+    /* ---------------------------------------------------------------------- */
+
+    // set::bounds (extension, ft only)
+    std::cout << "\n - set::bounds: " << std::endl;
+
+    ft::set<int> bounded_set;
+    ranked_set ranked_bounded_set;
+
+    for (int i = 0; i < 60; ++i)
+    {
+        bounded_set.insert((i * 7) % 60 * 5);
+        ranked_bounded_set.insert((i * 7) % 60 * 5);
+    }
+    std::cout << "keys 0, 5, ..., 295: errors: " << count_bounds_errors(bounded_set, -3, 300)
+              << ", ranked errors: " << count_bounds_errors(ranked_bounded_set, -3, 300) << std::endl;
+
+    ft::pair<ft::set<int>::iterator, ft::set<int>::iterator> bounded_set_range = bounded_set.bounds(-100, 12);
+
+    std::cout << "bounds(-100, 12):";
+    for (ft::set<int>::iterator it = bounded_set_range.first; it != bounded_set_range.second; ++it)
+        std::cout << " " << *it;
+    bounded_set_range = bounded_set.bounds(296, 400);
+    std::cout << std::endl << "bounds(296, 400) empty: " << (bounded_set_range.first == bounded_set_range.second)
+              << ", at end(): " << (bounded_set_range.first == bounded_set.end()) << std::endl;
+    std::cout << "ranked: rank of bounds(100, 200): " << ranked_bounded_set.rank(*ranked_bounded_set.bounds(100, 200).first)
+              << ", size of bounds(100, 200): " << ft::distance(ranked_bounded_set.bounds(100, 200).first, ranked_bounded_set.bounds(100, 200).second) << std::endl;
+
+    // Output: ***********************
+    // keys 0, 5, ..., 295: errors: 0, ranked errors: 0
+    // bounds(-100, 12): 0 5 10
+    // bounds(296, 400) empty: 1, at end(): 1
+    // ranked: rank of bounds(100, 200): 20, size of bounds(100, 200): 21
+#endif
+
     /* ---------------------------------------------------------------------- */
     
     // insert & erase big set
@@ -1393,6 +2415,1423 @@ int main()
 
 
 
+    /* ############################ COMPACT MAP ############################# */
+
+    std::cout << GREEN << "\n          ***************************" << std::endl;
+    std::cout          <<   "          *       COMPACT MAP       *" << std::endl;
+    std::cout          <<   "          ***************************" << RESET << std::endl;
+
+    /* ---------------------------------------------------------------------- */
+
+    // compact_map insert & erase
+    std::cout << "\n - compact_map insert & erase: " << std::endl;
+
+    ft::compact_map<int, int> test_compact_map;
+
+    for (int i = 0; i < 100; ++i)
+        test_compact_map.insert(ft::make_pair((i * 37) % 100, i));
+    std::cout << "insert existing key: " << test_compact_map.insert(ft::make_pair(37, 0)).second << std::endl;
+    std::cout << "test_compact_map.size(): " << test_compact_map.size() << std::endl;
+    std::cout << "erase(50): " << test_compact_map.erase(50) << std::endl;
+    std::cout << "erase(50): " << test_compact_map.erase(50) << std::endl;
+    test_compact_map.erase(test_compact_map.begin());
+    test_compact_map.erase(test_compact_map.find(10), test_compact_map.find(90));
+    std::cout << "test_compact_map.size(): " << test_compact_map.size() << std::endl;
+    for (ft::compact_map<int, int>::iterator it = test_compact_map.begin(); it != test_compact_map.end(); ++it)
+        std::cout << it->first << " => " << it->second << std::endl;
+    for (int i = 200; i < 300; ++i)
+        test_compact_map[i] = i; // reuses the slots of the erased elements
+    std::cout << "after refill: size: " << test_compact_map.size() << ", rbegin: " << test_compact_map.rbegin()->first << std::endl;
+
+    // Output: ***********************
+    // insert existing key: 0
+    // test_compact_map.size(): 100
+    // erase(50): 1
+    // erase(50): 0
+    // test_compact_map.size(): 19
+    // 1 => 73
+    // 2 => 46
+    // 3 => 19
+    // 4 => 92
+    // 5 => 65
+    // 6 => 38
+    // 7 => 11
+    // 8 => 84
+    // 9 => 57
+    // 90 => 70
+    // 91 => 43
+    // 92 => 16
+    // 93 => 89
+    // 94 => 62
+    // 95 => 35
+    // 96 => 8
+    // 97 => 81
+    // 98 => 54
+    // 99 => 27
+    // after refill: size: 119, rbegin: 299
+
+    /* ---------------------------------------------------------------------- */
+
+    // compact_map::insert with a hint
+    std::cout << "\n - compact_map::insert with a hint: " << std::endl;
+
+    ft::compact_map<int, char> compact_hinted;
+
+    print_hinted_insert(compact_hinted, compact_hinted.insert(compact_hinted.end(), ft::make_pair(50, 'a'))); // end() of an empty map
+    print_hinted_insert(compact_hinted, compact_hinted.insert(compact_hinted.end(), ft::make_pair(70, 'b'))); // end(), after the last element
+    print_hinted_insert(compact_hinted, compact_hinted.insert(compact_hinted.end(), ft::make_pair(60, 'c'))); // end(), but before the last element
+    print_hinted_insert(compact_hinted, compact_hinted.insert(compact_hinted.begin(), ft::make_pair(10, 'd'))); // begin(), before the first element
+    print_hinted_insert(compact_hinted, compact_hinted.insert(compact_hinted.find(50), ft::make_pair(40, 'e'))); // directly before the hint
+    print_hinted_insert(compact_hinted, compact_hinted.insert(compact_hinted.find(50), ft::make_pair(55, 'f'))); // directly after the hint
+    print_hinted_insert(compact_hinted, compact_hinted.insert(compact_hinted.begin(), ft::make_pair(65, 'g'))); // wrong hint
+    print_hinted_insert(compact_hinted, compact_hinted.insert(compact_hinted.find(40), ft::make_pair(40, 'i'))); // equal key at the hint
+
+    ft::compact_map<int, int> compact_hinted_big;
+    long compact_hinted_checksum = 0;
+    long compact_hinted_position = 0;
+
+    for (int i = 0; i < 5000; ++i)
+    {
+        int key = (i * 7919) % 5000;
+        ft::compact_map<int, int>::iterator hint = compact_hinted_big.lower_bound(key);
+
+        if (i % 2 == 1 && hint != compact_hinted_big.begin())
+            --hint;
+        if (i % 7 == 3)
+            hint = compact_hinted_big.begin();
+        if (compact_hinted_big.insert(hint, ft::make_pair(key, i))->first != key)
+            std::cout << "wrong iterator returned for " << key << std::endl;
+    }
+    for (ft::compact_map<int, int>::iterator it = compact_hinted_big.begin(); it != compact_hinted_big.end(); ++it)
+        compact_hinted_checksum += ++compact_hinted_position * (it->first + it->second);
+    std::cout << "5000 hinted inserts: size: " << compact_hinted_big.size() << ", checksum: " << compact_hinted_checksum << std::endl;
+
+    // Output: ***********************
+    // returned: 50 => a, size: 1, contents: 50 => a
+    // returned: 70 => b, size: 2, contents: 50 => a 70 => b
+    // returned: 60 => c, size: 3, contents: 50 => a 60 => c 70 => b
+    // returned: 10 => d, size: 4, contents: 10 => d 50 => a 60 => c 70 => b
+    // returned: 40 => e, size: 5, contents: 10 => d 40 => e 50 => a 60 => c 70 => b
+    // returned: 55 => f, size: 6, contents: 10 => d 40 => e 50 => a 55 => f 60 => c 70 => b
+    // returned: 65 => g, size: 7, contents: 10 => d 40 => e 50 => a 55 => f 60 => c 65 => g 70 => b
+    // returned: 40 => e, size: 7, contents: 10 => d 40 => e 50 => a 55 => f 60 => c 65 => g 70 => b
+    // 5000 hinted inserts: size: 5000, checksum: 72956495000
+
+    /* ---------------------------------------------------------------------- */
+
+    // compact_map find, count & bounds
+    std::cout << "\n - compact_map find, count & bounds: " << std::endl;
+
+    ft::compact_map<int, int> compact_bounds;
+
+    for (int i = 0; i < 1000; i += 10)
+        compact_bounds[i] = i / 10;
+
+    std::cout << "find(500): " << compact_bounds.find(500)->second << ", find(505) == end(): " << (compact_bounds.find(505) == compact_bounds.end()) << std::endl;
+    std::cout << "count(500): " << compact_bounds.count(500) << ", count(505): " << compact_bounds.count(505) << std::endl;
+    std::cout << "lower_bound(-5): " << compact_bounds.lower_bound(-5)->first << std::endl;
+    std::cout << "lower_bound(505): " << compact_bounds.lower_bound(505)->first << std::endl;
+    std::cout << "upper_bound(500): " << compact_bounds.upper_bound(500)->first << std::endl;
+    std::cout << "lower_bound(995) == end(): " << (compact_bounds.lower_bound(995) == compact_bounds.end()) << std::endl;
+    std::cout << "upper_bound(990) == end(): " << (compact_bounds.upper_bound(990) == compact_bounds.end()) << std::endl;
+
+    ft::pair<ft::compact_map<int, int>::iterator, ft::compact_map<int, int>::iterator> cret = compact_bounds.equal_range(250);
+    std::cout << "equal_range(250): " << cret.first->first << " " << cret.second->first << std::endl;
+    cret = compact_bounds.equal_range(255);
+    std::cout << "equal_range(255): " << cret.first->first << " " << cret.second->first << std::endl;
+
+    // Output: ***********************
+    // find(500): 50, find(505) == end(): 1
+    // count(500): 1, count(505): 0
+    // lower_bound(-5): 0
+    // lower_bound(505): 510
+    // upper_bound(500): 510
+    // lower_bound(995) == end(): 1
+    // upper_bound(990) == end(): 1
+    // equal_range(250): 250 260
+    // equal_range(255): 260 260
+
+    /* ---------------------------------------------------------------------- */
+
+    // compact_map iterators both ways
+    std::cout << "\n - compact_map iterators both ways: " << std::endl;
+
+    int compact_sum = 0;
+    for (ft::compact_map<int, int>::iterator it = compact_bounds.begin(); it != compact_bounds.end(); ++it)
+        compact_sum += it->second;
+    std::cout << "forward sum: " << compact_sum << std::endl;
+
+    ft::compact_map<int, int>::iterator cmap_back = compact_bounds.end();
+    for (int i = 0; i < 3; ++i)
+        std::cout << (--cmap_back)->first << " ";
+    std::cout << std::endl;
+
+    for (ft::compact_map<int, int>::reverse_iterator rit = compact_bounds.rbegin(); rit != compact_bounds.rend(); ++rit)
+        if (rit->first % 250 == 0)
+            std::cout << rit->first << " ";
+    std::cout << std::endl;
+
+    const ft::compact_map<int, int> const_compact_map(compact_bounds);
+    ft::compact_map<int, int>::const_reverse_iterator ccrit = const_compact_map.rbegin();
+    std::cout << "const rbegin: " << ccrit->first << ", const begin: " << const_compact_map.begin()->first << std::endl;
+
+    // Output: ***********************
+    // forward sum: 4950
+    // 990 980 970
+    // 750 500 250 0
+    // const rbegin: 990, const begin: 0
+
+    /* ---------------------------------------------------------------------- */
+
+    // compact_map copy, assignment & swap
+    std::cout << "\n - compact_map copy, assignment & swap: " << std::endl;
+
+    ft::compact_map<char, int> cfirst;
+    ft::compact_map<char, int> csecond;
+
+    cfirst['x'] = 8;
+    cfirst['y'] = 16;
+    cfirst['z'] = 32;
+
+    ft::compact_map<char, int> cthird(cfirst);
+    csecond = cfirst;
+    cfirst = ft::compact_map<char, int>();
+    cthird['w'] = 4;
+
+    std::cout << "Size of cfirst: " << cfirst.size() << '\n';
+    std::cout << "Size of csecond: " << csecond.size() << '\n';
+    std::cout << "Size of cthird: " << cthird.size() << '\n';
+
+    csecond.swap(cthird);
+    std::cout << "after swap csecond: ";
+    for (ft::compact_map<char, int>::iterator it = csecond.begin(); it != csecond.end(); ++it)
+        std::cout << it->first << " => " << it->second << " ";
+    std::cout << "\nafter swap cthird: ";
+    for (ft::compact_map<char, int>::iterator it = cthird.begin(); it != cthird.end(); ++it)
+        std::cout << it->first << " => " << it->second << " ";
+    std::cout << std::endl;
+
+    // Output: ***********************
+    // Size of cfirst: 0
+    // Size of csecond: 3
+    // Size of cthird: 4
+    // after swap csecond: w => 4 x => 8 y => 16 z => 32
+    // after swap cthird: x => 8 y => 16 z => 32
+
+    /* ---------------------------------------------------------------------- */
+
+    // compact_map growth with std::string values (copied element by element, not by memcpy)
+    std::cout << "\n - compact_map growth with std::string values: " << std::endl;
+
+    ft::compact_map<int, std::string> compact_strings;
+
+    for (int i = 0; i < 3000; ++i)
+        compact_strings[(i * 7919) % 3000] = "value " + number_string(i);
+    for (int i = 0; i < 3000; i += 3)
+        compact_strings.erase(i);
+    for (int i = 3000; i < 4000; ++i)
+        compact_strings.insert(ft::make_pair(i, std::string(i % 50, 'x')));
+
+    ft::compact_map<int, std::string> compact_strings_copy(compact_strings);
+    size_t compact_strings_length = 0;
+
+    for (ft::compact_map<int, std::string>::iterator it = compact_strings_copy.begin(); it != compact_strings_copy.end(); ++it)
+        compact_strings_length += it->second.size();
+    std::cout << "size: " << compact_strings.size() << ", total length: " << compact_strings_length << ", [1]: " << compact_strings[1]
+              << ", [2999]: " << compact_strings[2999] << ", equal to the copy: " << (compact_strings == compact_strings_copy) << std::endl;
+
+    // Output: ***********************
+    // size: 3000, total length: 43762, [1]: value 1679, [2999]: value 1321, equal to the copy: 1
+
+#if !STD
+    /* ---------------------------------------------------------------------- */
+
+    // compact_map::reserve & compact_map::capacity (extension, ft only)
+    std::cout << "\n - compact_map::reserve & compact_map::capacity: " << std::endl;
+
+    ft::compact_map<int, std::string> compact_reserved;
+
+    compact_reserved.reserve(1000);
+    std::cout << "reserve(1000): size: " << compact_reserved.size() << ", capacity() >= 1000: " << (compact_reserved.capacity() >= 1000) << std::endl;
+
+    size_t reserved_capacity = compact_reserved.capacity();
+
+    compact_reserved[0] = "first";
+
+    const std::string* reserved_first = &compact_reserved.begin()->second;
+    ft::compact_map<int, std::string>::iterator reserved_it = compact_reserved.begin();
+
+    for (int i = 1; i < 1000; ++i)
+        compact_reserved[i] = number_string(i);
+    std::cout << "after 1000 inserts: capacity unchanged: " << (compact_reserved.capacity() == reserved_capacity)
+              << ", element not moved: " << (reserved_first == &compact_reserved.begin()->second) << ", iterator still valid: " << reserved_it->second << std::endl;
+    compact_reserved.clear();
+    std::cout << "clear(): size: " << compact_reserved.size() << ", capacity kept: " << (compact_reserved.capacity() == reserved_capacity) << std::endl;
+    compact_reserved.reserve(10);
+    std::cout << "reserve(10) keeps the larger capacity: " << (compact_reserved.capacity() == reserved_capacity) << std::endl;
+    for (int i = 0; i < 5000; ++i)
+        compact_reserved[i] = number_string(i * 2);
+    std::cout << "grown past it: size: " << compact_reserved.size() << ", capacity() >= size(): " << (compact_reserved.capacity() >= compact_reserved.size())
+              << ", [4999]: " << compact_reserved[4999] << std::endl;
+
+    // Output: ***********************
+    // reserve(1000): size: 0, capacity() >= 1000: 1
+    // after 1000 inserts: capacity unchanged: 1, element not moved: 1, iterator still valid: first
+    // clear(): size: 0, capacity kept: 1
+    // reserve(10) keeps the larger capacity: 1
+    // grown past it: size: 5000, capacity() >= size(): 1, [4999]: 9998
+#endif
+
+    /* ---------------------------------------------------------------------- */
+
+    // insert & erase big compact_map
+    std::cout << "\n - insert & erase big compact_map: " << std::endl;
+
+    ft::compact_map<int, int> cmap;
+    srand(5);
+    for (size_t i = 0; i < 1000000; ++i)
+        cmap.insert(ft::make_pair(std::rand() % 1000000, static_cast<int>(i)));
+    std::cout << "test_compact_map cmap.size() = " << cmap.size() << std::endl;
+    ft::compact_map<int, int> cmap2(cmap);
+    std::cout << "test_compact_map cmap2.size() = " << cmap2.size() << std::endl;
+    ft::compact_map<int, int> cmap3(cmap2.begin(), cmap2.end());
+    std::cout << "test_compact_map cmap3.size() = " << cmap3.size() << std::endl;
+    for (int i = 0; i < 1000000; i += 2)
+        cmap2.erase(i);
+    std::cout << "test_compact_map cmap2.size() = " << cmap2.size() << std::endl;
+    std::cout << "test_compact_map cmap2 first / last: " << cmap2.begin()->second << " / " << cmap2.rbegin()->second << std::endl;
+    cmap.erase(cmap.begin(), cmap.end());
+    std::cout << "test_compact_map cmap.size() = " << cmap.size() << std::endl;
+
+    std::cout << GREEN << "\n --------------------------------------------- " << RESET << std::endl;
+
+    // Output: ***********************
+    // test_compact_map cmap.size() = 632151
+    // test_compact_map cmap2.size() = 632151
+    // test_compact_map cmap3.size() = 632151
+    // test_compact_map cmap2.size() = 316502
+    // test_compact_map cmap2 first / last: 83827 / 187331
+    // test_compact_map cmap.size() = 0
+
+
+    /* ############################ COMPACT SET ############################# */
+
+    std::cout << GREEN << "\n          ***************************" << std::endl;
+    std::cout          <<   "          *       COMPACT SET       *" << std::endl;
+    std::cout          <<   "          ***************************" << RESET << std::endl;
+
+    /* ---------------------------------------------------------------------- */
+
+    // compact_set insert & erase
+    std::cout << "\n - compact_set insert & erase: " << std::endl;
+
+    ft::compact_set<int> test_compact_set;
+
+    for (int i = 0; i < 100; ++i)
+        test_compact_set.insert((i * 37) % 100);
+    std::cout << "insert existing value: " << test_compact_set.insert(37).second << std::endl;
+    std::cout << "erase(50): " << test_compact_set.erase(50) << ", erase(50): " << test_compact_set.erase(50) << std::endl;
+    test_compact_set.erase(test_compact_set.begin());
+    test_compact_set.erase(test_compact_set.find(10), test_compact_set.find(90));
+    std::cout << "test_compact_set.size(): " << test_compact_set.size() << ", contents:";
+    for (ft::compact_set<int>::iterator it = test_compact_set.begin(); it != test_compact_set.end(); ++it)
+        std::cout << " " << *it;
+    std::cout << std::endl;
+
+    // Output: ***********************
+    // insert existing value: 0
+    // erase(50): 1, erase(50): 0
+    // test_compact_set.size(): 19, contents: 1 2 3 4 5 6 7 8 9 90 91 92 93 94 95 96 97 98 99
+
+    /* ---------------------------------------------------------------------- */
+
+    // compact_set::insert with a hint
+    std::cout << "\n - compact_set::insert with a hint: " << std::endl;
+
+    ft::compact_set<int> compact_hinted_set;
+
+    print_hinted_insert(compact_hinted_set, compact_hinted_set.insert(compact_hinted_set.end(), 50)); // end() of an empty set
+    print_hinted_insert(compact_hinted_set, compact_hinted_set.insert(compact_hinted_set.end(), 70)); // end(), after the last element
+    print_hinted_insert(compact_hinted_set, compact_hinted_set.insert(compact_hinted_set.end(), 60)); // end(), but before the last element
+    print_hinted_insert(compact_hinted_set, compact_hinted_set.insert(compact_hinted_set.begin(), 10)); // begin(), before the first element
+    print_hinted_insert(compact_hinted_set, compact_hinted_set.insert(compact_hinted_set.find(50), 40)); // directly before the hint
+    print_hinted_insert(compact_hinted_set, compact_hinted_set.insert(compact_hinted_set.find(50), 55)); // directly after the hint
+    print_hinted_insert(compact_hinted_set, compact_hinted_set.insert(compact_hinted_set.find(70), 5)); // wrong hint
+    print_hinted_insert(compact_hinted_set, compact_hinted_set.insert(compact_hinted_set.end(), 10)); // equal value, wrong hint
+
+    // Output: ***********************
+    // returned: 50, size: 1, contents: 50
+    // returned: 70, size: 2, contents: 50 70
+    // returned: 60, size: 3, contents: 50 60 70
+    // returned: 10, size: 4, contents: 10 50 60 70
+    // returned: 40, size: 5, contents: 10 40 50 60 70
+    // returned: 55, size: 6, contents: 10 40 50 55 60 70
+    // returned: 5, size: 7, contents: 5 10 40 50 55 60 70
+    // returned: 10, size: 7, contents: 5 10 40 50 55 60 70
+
+    /* ---------------------------------------------------------------------- */
+
+    // compact_set find, bounds & iterators both ways
+    std::cout << "\n - compact_set find, bounds & iterators both ways: " << std::endl;
+
+    ft::compact_set<int> compact_set_bounds;
+
+    for (int i = 0; i < 1000; i += 10)
+        compact_set_bounds.insert(i);
+    std::cout << "find(500): " << *compact_set_bounds.find(500) << ", count(505): " << compact_set_bounds.count(505)
+              << ", lower_bound(505): " << *compact_set_bounds.lower_bound(505) << ", upper_bound(500): " << *compact_set_bounds.upper_bound(500)
+              << ", upper_bound(990) == end(): " << (compact_set_bounds.upper_bound(990) == compact_set_bounds.end()) << std::endl;
+
+    ft::pair<ft::compact_set<int>::iterator, ft::compact_set<int>::iterator> csret = compact_set_bounds.equal_range(255);
+    std::cout << "equal_range(255): " << *csret.first << " " << *csret.second << std::endl;
+
+    ft::compact_set<int>::iterator cset_back = compact_set_bounds.end();
+    for (int i = 0; i < 3; ++i)
+        std::cout << *--cset_back << " ";
+    for (ft::compact_set<int>::reverse_iterator rit = compact_set_bounds.rbegin(); rit != compact_set_bounds.rend(); ++rit)
+        if (*rit % 250 == 0)
+            std::cout << *rit << " ";
+    std::cout << std::endl;
+
+    // Output: ***********************
+    // find(500): 500, count(505): 0, lower_bound(505): 510, upper_bound(500): 510, upper_bound(990) == end(): 1
+    // equal_range(255): 260 260
+    // 990 980 970 750 500 250 0
+
+    /* ---------------------------------------------------------------------- */
+
+    // compact_set copy, assignment & swap
+    std::cout << "\n - compact_set copy, assignment & swap: " << std::endl;
+
+    ft::compact_set<char> csfirst;
+    ft::compact_set<char> cssecond;
+
+    csfirst.insert('x');
+    csfirst.insert('y');
+    csfirst.insert('z');
+
+    ft::compact_set<char> csthird(csfirst);
+    cssecond = csfirst;
+    csfirst = ft::compact_set<char>();
+    csthird.insert('w');
+    cssecond.swap(csthird);
+
+    std::cout << "Size of csfirst: " << csfirst.size() << ", cssecond: " << cssecond.size() << ", csthird: " << csthird.size() << std::endl;
+    std::cout << "cssecond.begin(): " << *cssecond.begin() << ", csthird.rbegin(): " << *csthird.rbegin() << std::endl;
+
+    // Output: ***********************
+    // Size of csfirst: 0, cssecond: 4, csthird: 3
+    // cssecond.begin(): w, csthird.rbegin(): z
+
+    /* ---------------------------------------------------------------------- */
+
+    // compact_set growth with std::string values (copied element by element, not by memcpy)
+    std::cout << "\n - compact_set growth with std::string values: " << std::endl;
+
+    ft::compact_set<std::string> compact_words;
+
+    for (int i = 0; i < 2000; ++i)
+        compact_words.insert("word " + number_string((i * 7919) % 2000));
+    for (int i = 0; i < 2000; i += 2)
+        compact_words.erase("word " + number_string(i));
+    for (int i = 0; i < 500; ++i)
+        compact_words.insert(std::string(20 + i % 30, 'a' + i % 26));
+
+    ft::compact_set<std::string> compact_words_copy;
+    size_t compact_words_length = 0;
+
+    compact_words_copy = compact_words;
+    for (ft::compact_set<std::string>::reverse_iterator it = compact_words_copy.rbegin(); it != compact_words_copy.rend(); ++it)
+        compact_words_length += it->size();
+    std::cout << "size: " << compact_words.size() << ", total length: " << compact_words_length << ", begin: " << compact_words.begin()->substr(0, 5)
+              << ", rbegin: " << *compact_words.rbegin() << ", equal to the copy: " << (compact_words == compact_words_copy) << std::endl;
+
+    // Output: ***********************
+    // size: 1390, total length: 21900, begin: aaaaa, rbegin: zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz, equal to the copy: 1
+
+#if !STD
+    /* ---------------------------------------------------------------------- */
+
+    // compact_set::reserve & compact_set::capacity (extension, ft only)
+    std::cout << "\n - compact_set::reserve & compact_set::capacity: " << std::endl;
+
+    ft::compact_set<int> compact_reserved_set;
+
+    compact_reserved_set.reserve(500);
+    std::cout << "reserve(500): capacity() >= 500: " << (compact_reserved_set.capacity() >= 500) << std::endl;
+
+    size_t reserved_set_capacity = compact_reserved_set.capacity();
+
+    for (int i = 0; i < 500; ++i)
+        compact_reserved_set.insert(i * 3);
+    std::cout << "after 500 inserts: capacity unchanged: " << (compact_reserved_set.capacity() == reserved_set_capacity) << std::endl;
+    compact_reserved_set.insert(10000);
+    std::cout << "one more: capacity() grew: " << (compact_reserved_set.capacity() > reserved_set_capacity)
+              << ", size: " << compact_reserved_set.size() << ", rbegin: " << *compact_reserved_set.rbegin() << std::endl;
+
+    // Output: ***********************
+    // reserve(500): capacity() >= 500: 1
+    // after 500 inserts: capacity unchanged: 1
+    // one more: capacity() grew: 1, size: 501, rbegin: 10000
+#endif
+
+    std::cout << GREEN << "\n --------------------------------------------- " << RESET << std::endl;
+
+
+
+
+    /* ############################# BTREE MAP ############################## */
+
+    std::cout << GREEN << "\n          ***************************" << std::endl;
+    std::cout          <<   "          *        BTREE MAP        *" << std::endl;
+    std::cout          <<   "          ***************************" << RESET << std::endl;
+
+    /* ---------------------------------------------------------------------- */
+
+    // btree_map insert & erase
+    std::cout << "\n - btree_map insert & erase: " << std::endl;
+
+    ft::btree_map<int, int> test_btree_map;
+
+    for (int i = 0; i < 100; ++i)
+        test_btree_map.insert(ft::make_pair((i * 37) % 100, i));
+    std::cout << "insert existing key: " << test_btree_map.insert(ft::make_pair(37, 0)).second << std::endl;
+    std::cout << "test_btree_map.size(): " << test_btree_map.size() << std::endl;
+    std::cout << "erase(50): " << test_btree_map.erase(50) << std::endl;
+    std::cout << "erase(50): " << test_btree_map.erase(50) << std::endl;
+    test_btree_map.erase(test_btree_map.begin());
+    test_btree_map.erase(test_btree_map.find(10), test_btree_map.find(90));
+    std::cout << "test_btree_map.size(): " << test_btree_map.size() << std::endl;
+    for (ft::btree_map<int, int>::iterator it = test_btree_map.begin(); it != test_btree_map.end(); ++it)
+        std::cout << it->first << " => " << it->second << std::endl;
+
+    // Output: ***********************
+    // insert existing key: 0
+    // test_btree_map.size(): 100
+    // erase(50): 1
+    // erase(50): 0
+    // test_btree_map.size(): 19
+    // 1 => 73
+    // 2 => 46
+    // ...
+    // 9 => 57
+    // 90 => 70
+    // ...
+    // 99 => 27
+
+    /* ---------------------------------------------------------------------- */
+
+    // btree_map::find & btree_map::count
+    std::cout << "\n - btree_map::find & btree_map::count: " << std::endl;
+
+    ft::btree_map<char, int> bmymap;
+
+    bmymap['a'] = 50;
+    bmymap['b'] = 100;
+    bmymap['c'] = 150;
+    bmymap['d'] = 200;
+
+    ft::btree_map<char, int>::iterator bmit = bmymap.find('b');
+    if (bmit != bmymap.end())
+        bmymap.erase(bmit);
+
+    std::cout << "elements in bmymap:" << '\n';
+    std::cout << "a => " << bmymap.find('a')->second << '\n';
+    std::cout << "c => " << bmymap.find('c')->second << '\n';
+    std::cout << "d => " << bmymap.find('d')->second << '\n';
+    std::cout << "find('b') == end(): " << (bmymap.find('b') == bmymap.end()) << '\n';
+    std::cout << "count('a'): " << bmymap.count('a') << ", count('b'): " << bmymap.count('b') << '\n';
+
+    // Output: ***********************
+    // elements in bmymap:
+    // a => 50
+    // c => 150
+    // d => 200
+    // find('b') == end(): 1
+    // count('a'): 1, count('b'): 0
+
+    /* ---------------------------------------------------------------------- */
+
+    // btree_map bounds
+    std::cout << "\n - btree_map bounds: " << std::endl;
+
+    ft::btree_map<int, int> btree_bounds;
+
+    for (int i = 0; i < 1000; i += 10)
+        btree_bounds[i] = i / 10;
+
+    std::cout << "lower_bound(-5): " << btree_bounds.lower_bound(-5)->first << std::endl;
+    std::cout << "lower_bound(500): " << btree_bounds.lower_bound(500)->first << std::endl;
+    std::cout << "lower_bound(505): " << btree_bounds.lower_bound(505)->first << std::endl;
+    std::cout << "upper_bound(500): " << btree_bounds.upper_bound(500)->first << std::endl;
+    std::cout << "lower_bound(995) == end(): " << (btree_bounds.lower_bound(995) == btree_bounds.end()) << std::endl;
+    std::cout << "upper_bound(990) == end(): " << (btree_bounds.upper_bound(990) == btree_bounds.end()) << std::endl;
+
+    ft::pair<ft::btree_map<int, int>::iterator, ft::btree_map<int, int>::iterator> bret = btree_bounds.equal_range(250);
+    std::cout << "equal_range(250): " << bret.first->first << " " << bret.second->first << std::endl;
+    bret = btree_bounds.equal_range(255);
+    std::cout << "equal_range(255): " << bret.first->first << " " << bret.second->first << std::endl;
+
+    // Output: ***********************
+    // lower_bound(-5): 0
+    // lower_bound(500): 500
+    // lower_bound(505): 510
+    // upper_bound(500): 510
+    // lower_bound(995) == end(): 1
+    // upper_bound(990) == end(): 1
+    // equal_range(250): 250 260
+    // equal_range(255): 260 260
+
+    /* ---------------------------------------------------------------------- */
+
+    // btree_map iterators both ways
+    std::cout << "\n - btree_map iterators both ways: " << std::endl;
+
+    int btree_sum = 0;
+    for (ft::btree_map<int, int>::iterator it = btree_bounds.begin(); it != btree_bounds.end(); ++it)
+        btree_sum += it->second;
+    std::cout << "forward sum: " << btree_sum << std::endl;
+
+    ft::btree_map<int, int>::iterator bmap_back = btree_bounds.end();
+    for (int i = 0; i < 3; ++i)
+        std::cout << (--bmap_back)->first << " ";
+    std::cout << std::endl;
+
+    for (ft::btree_map<int, int>::reverse_iterator rit = btree_bounds.rbegin(); rit != btree_bounds.rend(); ++rit)
+        if (rit->first % 250 == 0)
+            std::cout << rit->first << " ";
+    std::cout << std::endl;
+
+    const ft::btree_map<int, int> const_btree_map(btree_bounds);
+    ft::btree_map<int, int>::const_reverse_iterator crit = const_btree_map.rbegin();
+    std::cout << "const rbegin: " << crit->first << ", const begin: " << const_btree_map.begin()->first << std::endl;
+
+    // Output: ***********************
+    // forward sum: 4950
+    // 990 980 970
+    // 750 500 250 0
+    // const rbegin: 990, const begin: 0
+
+    /* ---------------------------------------------------------------------- */
+
+    // btree_map copy, assignment & swap
+    std::cout << "\n - btree_map copy, assignment & swap: " << std::endl;
+
+    ft::btree_map<char, int> bfirst;
+    ft::btree_map<char, int> bsecond;
+
+    bfirst['x'] = 8;
+    bfirst['y'] = 16;
+    bfirst['z'] = 32;
+
+    ft::btree_map<char, int> bthird(bfirst);
+    bsecond = bfirst;
+    bfirst = ft::btree_map<char, int>();
+    bthird['w'] = 4;
+
+    std::cout << "Size of bfirst: " << bfirst.size() << '\n';
+    std::cout << "Size of bsecond: " << bsecond.size() << '\n';
+    std::cout << "Size of bthird: " << bthird.size() << '\n';
+
+    bsecond.swap(bthird);
+    std::cout << "after swap bsecond: ";
+    for (ft::btree_map<char, int>::iterator it = bsecond.begin(); it != bsecond.end(); ++it)
+        std::cout << it->first << " => " << it->second << " ";
+    std::cout << "\nafter swap bthird: ";
+    for (ft::btree_map<char, int>::iterator it = bthird.begin(); it != bthird.end(); ++it)
+        std::cout << it->first << " => " << it->second << " ";
+    std::cout << std::endl;
+
+    // Output: ***********************
+    // Size of bfirst: 0
+    // Size of bsecond: 3
+    // Size of bthird: 4
+    // after swap bsecond: w => 4 x => 8 y => 16 z => 32
+    // after swap bthird: x => 8 y => 16 z => 32
+
+    /* ---------------------------------------------------------------------- */
+
+    // insert & erase big btree_map
+    std::cout << "\n - insert & erase big btree_map: " << std::endl;
+
+    ft::btree_map<int, std::string> bmap;
+    srand(5);
+    for (size_t i = 0; i < 1000000; ++i)
+        bmap.insert(ft::make_pair<int, std::string>(std::rand() % 1000000, "performance: " + number_string(i)));
+    std::cout << "test_btree_map bmap.size() = " << bmap.size() << std::endl;
+    ft::btree_map<int, std::string> bmap2(bmap);
+    std::cout << "test_btree_map bmap2.size() = " << bmap2.size() << std::endl;
+    ft::btree_map<int, std::string> bmap3(bmap2.begin(), bmap2.end());
+    std::cout << "test_btree_map bmap3.size() = " << bmap3.size() << std::endl;
+    for (int i = 0; i < 1000000; i += 2)
+        bmap2.erase(i);
+    std::cout << "test_btree_map bmap2.size() = " << bmap2.size() << std::endl;
+    std::cout << "test_btree_map bmap2 first / last: " << bmap2.begin()->second << " / " << bmap2.rbegin()->second << std::endl;
+    bmap.erase(bmap.begin(), bmap.end());
+    std::cout << "test_btree_map bmap.size() = " << bmap.size() << std::endl;
+
+    std::cout << GREEN << "\n --------------------------------------------- " << RESET << std::endl;
+
+    // Output: ***********************
+    // test_btree_map bmap.size() = 632151
+    // test_btree_map bmap2.size() = 632151
+    // test_btree_map bmap3.size() = 632151
+    // test_btree_map bmap2.size() = 316502
+    // test_btree_map bmap2 first / last: performance: 83827 / performance: 187331
+    // test_btree_map bmap.size() = 0
+
+
+    /* ############################# BTREE SET ############################## */
+
+    std::cout << GREEN << "\n          ***************************" << std::endl;
+    std::cout          <<   "          *        BTREE SET        *" << std::endl;
+    std::cout          <<   "          ***************************" << RESET << std::endl;
+
+    /* ---------------------------------------------------------------------- */
+
+    // btree_set insert & erase
+    std::cout << "\n - btree_set insert & erase: " << std::endl;
+
+    ft::btree_set<int> test_btree_set;
+
+    for (int i = 0; i < 100; ++i)
+        test_btree_set.insert((i * 37) % 100);
+    std::cout << "insert existing key: " << test_btree_set.insert(37).second << std::endl;
+    std::cout << "test_btree_set.size(): " << test_btree_set.size() << std::endl;
+    std::cout << "erase(50): " << test_btree_set.erase(50) << std::endl;
+    std::cout << "erase(50): " << test_btree_set.erase(50) << std::endl;
+    test_btree_set.erase(test_btree_set.begin());
+    test_btree_set.erase(test_btree_set.find(10), test_btree_set.find(90));
+    std::cout << "test_btree_set.size(): " << test_btree_set.size() << std::endl;
+    for (ft::btree_set<int>::iterator it = test_btree_set.begin(); it != test_btree_set.end(); ++it)
+        std::cout << *it << " ";
+    std::cout << std::endl;
+
+    // Output: ***********************
+    // insert existing key: 0
+    // test_btree_set.size(): 100
+    // erase(50): 1
+    // erase(50): 0
+    // test_btree_set.size(): 19
+    // 1 2 3 4 5 6 7 8 9 90 91 92 93 94 95 96 97 98 99
+
+    /* ---------------------------------------------------------------------- */
+
+    // btree_set::find & btree_set::count
+    std::cout << "\n - btree_set::find & btree_set::count: " << std::endl;
+
+    ft::btree_set<int> bmyset;
+
+    bmyset.insert(50);
+    bmyset.insert(100);
+    bmyset.insert(150);
+    bmyset.insert(200);
+
+    ft::btree_set<int>::iterator bsit = bmyset.find(100);
+    if (bsit != bmyset.end())
+        bmyset.erase(bsit);
+
+    std::cout << "elements in bmyset:" << '\n';
+    std::cout << "50 => " << *bmyset.find(50) << '\n';
+    std::cout << "150 => " << *bmyset.find(150) << '\n';
+    std::cout << "200 => " << *bmyset.find(200) << '\n';
+    std::cout << "find(100) == end(): " << (bmyset.find(100) == bmyset.end()) << '\n';
+    std::cout << "count(50): " << bmyset.count(50) << ", count(100): " << bmyset.count(100) << '\n';
+
+    // Output: ***********************
+    // elements in bmyset:
+    // 50 => 50
+    // 150 => 150
+    // 200 => 200
+    // find(100) == end(): 1
+    // count(50): 1, count(100): 0
+
+    /* ---------------------------------------------------------------------- */
+
+    // btree_set bounds
+    std::cout << "\n - btree_set bounds: " << std::endl;
+
+    ft::btree_set<int> btree_set_bounds;
+
+    for (int i = 0; i < 1000; i += 10)
+        btree_set_bounds.insert(i);
+
+    std::cout << "lower_bound(-5): " << *btree_set_bounds.lower_bound(-5) << std::endl;
+    std::cout << "lower_bound(500): " << *btree_set_bounds.lower_bound(500) << std::endl;
+    std::cout << "lower_bound(505): " << *btree_set_bounds.lower_bound(505) << std::endl;
+    std::cout << "upper_bound(500): " << *btree_set_bounds.upper_bound(500) << std::endl;
+    std::cout << "lower_bound(995) == end(): " << (btree_set_bounds.lower_bound(995) == btree_set_bounds.end()) << std::endl;
+    std::cout << "upper_bound(990) == end(): " << (btree_set_bounds.upper_bound(990) == btree_set_bounds.end()) << std::endl;
+
+    ft::pair<ft::btree_set<int>::iterator, ft::btree_set<int>::iterator> bsret = btree_set_bounds.equal_range(250);
+    std::cout << "equal_range(250): " << *bsret.first << " " << *bsret.second << std::endl;
+    bsret = btree_set_bounds.equal_range(255);
+    std::cout << "equal_range(255): " << *bsret.first << " " << *bsret.second << std::endl;
+
+    // Output: ***********************
+    // lower_bound(-5): 0
+    // lower_bound(500): 500
+    // lower_bound(505): 510
+    // upper_bound(500): 510
+    // lower_bound(995) == end(): 1
+    // upper_bound(990) == end(): 1
+    // equal_range(250): 250 260
+    // equal_range(255): 260 260
+
+    /* ---------------------------------------------------------------------- */
+
+    // btree_set iterators both ways
+    std::cout << "\n - btree_set iterators both ways: " << std::endl;
+
+    int btree_set_sum = 0;
+    for (ft::btree_set<int>::iterator it = btree_set_bounds.begin(); it != btree_set_bounds.end(); ++it)
+        btree_set_sum += *it;
+    std::cout << "forward sum: " << btree_set_sum << std::endl;
+
+    ft::btree_set<int>::iterator bset_back = btree_set_bounds.end();
+    for (int i = 0; i < 3; ++i)
+        std::cout << *(--bset_back) << " ";
+    std::cout << std::endl;
+
+    for (ft::btree_set<int>::reverse_iterator rit = btree_set_bounds.rbegin(); rit != btree_set_bounds.rend(); ++rit)
+        if (*rit % 250 == 0)
+            std::cout << *rit << " ";
+    std::cout << std::endl;
+
+    // Output: ***********************
+    // forward sum: 49500
+    // 990 980 970
+    // 750 500 250 0
+
+    /* ---------------------------------------------------------------------- */
+
+    // btree_set copy, assignment & swap
+    std::cout << "\n - btree_set copy, assignment & swap: " << std::endl;
+
+    ft::btree_set<char> bsfirst;
+    ft::btree_set<char> bssecond;
+
+    bsfirst.insert('x');
+    bsfirst.insert('y');
+    bsfirst.insert('z');
+
+    ft::btree_set<char> bsthird(bsfirst);
+    bssecond = bsfirst;
+    bsfirst = ft::btree_set<char>();
+    bsthird.insert('w');
+
+    std::cout << "Size of bsfirst: " << bsfirst.size() << '\n';
+    std::cout << "Size of bssecond: " << bssecond.size() << '\n';
+    std::cout << "Size of bsthird: " << bsthird.size() << '\n';
+
+    bssecond.swap(bsthird);
+    std::cout << "after swap bssecond: ";
+    for (ft::btree_set<char>::iterator it = bssecond.begin(); it != bssecond.end(); ++it)
+        std::cout << *it << " ";
+    std::cout << "\nafter swap bsthird: ";
+    for (ft::btree_set<char>::iterator it = bsthird.begin(); it != bsthird.end(); ++it)
+        std::cout << *it << " ";
+    std::cout << std::endl;
+
+    // Output: ***********************
+    // Size of bsfirst: 0
+    // Size of bssecond: 3
+    // Size of bsthird: 4
+    // after swap bssecond: w x y z
+    // after swap bsthird: x y z
+
+    /* ---------------------------------------------------------------------- */
+
+    // insert & erase big btree_set
+    std::cout << "\n - insert & erase big btree_set: " << std::endl;
+
+    ft::btree_set<int> bset;
+    srand(5);
+    for (size_t i = 0; i < 1000000; ++i)
+        bset.insert(std::rand() % 1000000);
+    std::cout << "test_btree_set bset.size() = " << bset.size() << std::endl;
+    ft::btree_set<int> bset2(bset);
+    std::cout << "test_btree_set bset2.size() = " << bset2.size() << std::endl;
+    ft::btree_set<int> bset3(bset2.begin(), bset2.end());
+    std::cout << "test_btree_set bset3.size() = " << bset3.size() << std::endl;
+    for (int i = 0; i < 1000000; i += 2)
+        bset2.erase(i);
+    std::cout << "test_btree_set bset2.size() = " << bset2.size() << std::endl;
+    std::cout << "test_btree_set bset2 first / last: " << *bset2.begin() << " / " << *bset2.rbegin() << std::endl;
+    bset.erase(bset.begin(), bset.end());
+    std::cout << "test_btree_set bset.size() = " << bset.size() << std::endl;
+
+    // Output: ***********************
+    // test_btree_set bset.size() = 632151
+    // test_btree_set bset2.size() = 632151
+    // test_btree_set bset3.size() = 632151
+    // test_btree_set bset2.size() = 316502
+    // test_btree_set bset2 first / last: 3 / 999999
+    // test_btree_set bset.size() = 0
+
+    std::cout << GREEN << "\n --------------------------------------------- " << RESET << std::endl;
+
+
+
+
+    /* ############################# FLAT MAP ############################### */
+
+    std::cout << GREEN << "\n          ***************************" << std::endl;
+    std::cout          <<   "          *        FLAT MAP         *" << std::endl;
+    std::cout          <<   "          ***************************" << RESET << std::endl;
+
+    /* ---------------------------------------------------------------------- */
+
+    // flat_map insert, erase & find
+    std::cout << "\n - flat_map insert, erase & find: " << std::endl;
+
+    ft::flat_map<char, int> fmymap;
+
+    fmymap.insert(ft::make_pair('c', 150));
+    fmymap.insert(ft::make_pair('a', 50));
+    fmymap['d'] = 200;
+    fmymap['b'] = 100;
+    std::cout << "insert existing key: " << fmymap.insert(ft::make_pair('a', 0)).second << std::endl;
+    fmymap.erase(fmymap.find('b'));
+    std::cout << "erase('x'): " << fmymap.erase('x') << std::endl;
+    for (ft::flat_map<char, int>::iterator it = fmymap.begin(); it != fmymap.end(); ++it)
+        std::cout << it->first << " => " << it->second << std::endl;
+    std::cout << "count('b'): " << fmymap.count('b') << ", lower_bound('b'): " << fmymap.lower_bound('b')->first << ", upper_bound('c'): " << fmymap.upper_bound('c')->first << std::endl;
+
+    // Output: ***********************
+    // insert existing key: 0
+    // erase('x'): 0
+    // a => 50
+    // c => 150
+    // d => 200
+    // count('b'): 0, lower_bound('b'): c, upper_bound('c'): d
+
+    /* ---------------------------------------------------------------------- */
+
+    // flat_map batch insert (unsorted, with duplicates)
+    std::cout << "\n - flat_map batch insert (unsorted, with duplicates): " << std::endl;
+
+    ft::pair<int, int> small_batch[] = { ft::make_pair(5, 1), ft::make_pair(2, 2), ft::make_pair(5, 3), ft::make_pair(1, 4), ft::make_pair(2, 5) };
+    ft::flat_map<int, int> fbatch(small_batch, small_batch + 5);
+
+    for (ft::flat_map<int, int>::iterator it = fbatch.begin(); it != fbatch.end(); ++it)
+        std::cout << it->first << " => " << it->second << std::endl;
+
+    ft::vector<ft::pair<int, int> > big_batch;
+    for (int i = 0; i < 300; ++i)
+        big_batch.push_back(ft::make_pair((i * 7919) % 200, i)); // each key 1 or 2 times
+    fbatch.insert(big_batch.begin(), big_batch.end()); // 1, 2 and 5 are already stored
+    std::cout << "fbatch.size(): " << fbatch.size() << std::endl;
+
+    long fbatch_sum = 0;
+    for (ft::flat_map<int, int>::iterator it = fbatch.begin(); it != fbatch.end(); ++it)
+        fbatch_sum += it->second;
+    std::cout << "sum of values: " << fbatch_sum << std::endl;
+    for (ft::flat_map<int, int>::reverse_iterator rit = fbatch.rbegin(); rit != fbatch.rend(); ++rit)
+        if (rit->first % 40 == 0 || rit->first < 6)
+            std::cout << rit->first << " => " << rit->second << " ";
+    std::cout << std::endl;
+
+    // Output: ***********************
+    // 1 => 4
+    // 2 => 2
+    // 5 => 1
+    // fbatch.size(): 200
+    // sum of values: 19475
+    // 160 => 40 120 => 80 80 => 120 40 => 160 5 => 1 4 => 116 3 => 37 2 => 2 1 => 4 0 => 0
+
+    /* ---------------------------------------------------------------------- */
+
+    // flat_map copy, assignment & swap
+    std::cout << "\n - flat_map copy, assignment & swap: " << std::endl;
+
+    ft::flat_map<char, int> ffirst;
+    ft::flat_map<char, int> fsecond;
+
+    ffirst['x'] = 8;
+    ffirst['y'] = 16;
+    ffirst['z'] = 32;
+
+    ft::flat_map<char, int> fthird(ffirst);
+    fsecond = ffirst;
+    ffirst = ft::flat_map<char, int>();
+    fthird['w'] = 4;
+    fsecond.swap(fthird);
+
+    std::cout << "Size of ffirst: " << ffirst.size() << '\n';
+    std::cout << "Size of fsecond: " << fsecond.size() << '\n';
+    std::cout << "Size of fthird: " << fthird.size() << '\n';
+    std::cout << "fsecond.begin(): " << fsecond.begin()->first << ", fthird.rbegin(): " << fthird.rbegin()->first << '\n';
+
+    // Output: ***********************
+    // Size of ffirst: 0
+    // Size of fsecond: 4
+    // Size of fthird: 3
+    // fsecond.begin(): w, fthird.rbegin(): z
+
+    std::cout << GREEN << "\n --------------------------------------------- " << RESET << std::endl;
+
+
+    /* ############################# FLAT SET ############################### */
+
+    std::cout << GREEN << "\n          ***************************" << std::endl;
+    std::cout          <<   "          *        FLAT SET         *" << std::endl;
+    std::cout          <<   "          ***************************" << RESET << std::endl;
+
+    /* ---------------------------------------------------------------------- */
+
+    // flat_set insert, erase & find
+    std::cout << "\n - flat_set insert, erase & find: " << std::endl;
+
+    ft::flat_set<int> fmyset;
+
+    fmyset.insert(150);
+    fmyset.insert(50);
+    fmyset.insert(200);
+    fmyset.insert(100);
+    std::cout << "insert existing key: " << fmyset.insert(50).second << std::endl;
+    fmyset.erase(fmyset.find(100));
+    std::cout << "erase(7): " << fmyset.erase(7) << std::endl;
+    for (ft::flat_set<int>::iterator it = fmyset.begin(); it != fmyset.end(); ++it)
+        std::cout << *it << std::endl;
+    std::cout << "count(100): " << fmyset.count(100) << ", lower_bound(100): " << *fmyset.lower_bound(100) << ", upper_bound(150): " << *fmyset.upper_bound(150) << std::endl;
+
+    // Output: ***********************
+    // insert existing key: 0
+    // erase(7): 0
+    // 50
+    // 150
+    // 200
+    // count(100): 0, lower_bound(100): 150, upper_bound(150): 200
+
+    /* ---------------------------------------------------------------------- */
+
+    // flat_set batch insert (unsorted, with duplicates)
+    std::cout << "\n - flat_set batch insert (unsorted, with duplicates): " << std::endl;
+
+    int small_set_batch[] = { 5, 2, 5, 1, 2 };
+    ft::flat_set<int> fsbatch(small_set_batch, small_set_batch + 5);
+
+    for (ft::flat_set<int>::iterator it = fsbatch.begin(); it != fsbatch.end(); ++it)
+        std::cout << *it << " ";
+    std::cout << std::endl;
+
+    ft::vector<int> big_set_batch;
+    for (int i = 0; i < 300; ++i)
+        big_set_batch.push_back((i * 7919) % 200);
+    fsbatch.insert(big_set_batch.begin(), big_set_batch.end());
+    fsbatch.insert(big_set_batch.rbegin(), big_set_batch.rend()); // every element is already stored
+    std::cout << "fsbatch.size(): " << fsbatch.size() << std::endl;
+
+    int fsbatch_expected = 0;
+    bool fsbatch_sorted = true;
+    for (ft::flat_set<int>::iterator it = fsbatch.begin(); it != fsbatch.end(); ++it)
+        fsbatch_sorted = fsbatch_sorted && *it == fsbatch_expected++;
+    std::cout << "0 to 199 in order: " << fsbatch_sorted << std::endl;
+
+    // Output: ***********************
+    // 1 2 5
+    // fsbatch.size(): 200
+    // 0 to 199 in order: 1
+
+    /* ---------------------------------------------------------------------- */
+
+    // flat_set copy, assignment & swap
+    std::cout << "\n - flat_set copy, assignment & swap: " << std::endl;
+
+    ft::flat_set<char> fsfirst;
+    ft::flat_set<char> fssecond;
+
+    fsfirst.insert('x');
+    fsfirst.insert('y');
+    fsfirst.insert('z');
+
+    ft::flat_set<char> fsthird(fsfirst);
+    fssecond = fsfirst;
+    fsfirst = ft::flat_set<char>();
+    fsthird.insert('w');
+    fssecond.swap(fsthird);
+
+    std::cout << "Size of fsfirst: " << fsfirst.size() << '\n';
+    std::cout << "Size of fssecond: " << fssecond.size() << '\n';
+    std::cout << "Size of fsthird: " << fsthird.size() << '\n';
+    std::cout << "fssecond.begin(): " << *fssecond.begin() << ", fsthird.rbegin(): " << *fsthird.rbegin() << '\n';
+
+    // Output: ***********************
+    // Size of fsfirst: 0
+    // Size of fssecond: 4
+    // Size of fsthird: 3
+    // fssecond.begin(): w, fsthird.rbegin(): z
+
+    std::cout << GREEN << "\n --------------------------------------------- " << RESET << std::endl;
+
+
+
+
+#if HAS_UNORDERED
+    /* ########################### UNORDERED MAP ############################ */
+
+    std::cout << GREEN << "\n          ***************************" << std::endl;
+    std::cout          <<   "          *      UNORDERED MAP      *" << std::endl;
+    std::cout          <<   "          ***************************" << RESET << std::endl;
+
+    /* ---------------------------------------------------------------------- */
+
+    // unordered_map insert, find & erase
+    std::cout << "\n - unordered_map insert, find & erase: " << std::endl;
+
+    ft::unordered_map<int, int> test_umap;
+
+    for (int i = 0; i < 10; ++i)
+        test_umap.insert(ft::make_pair(i * 11, i));
+    test_umap[5] = 50;
+    std::cout << "insert existing key: " << test_umap.insert(ft::make_pair(11, 0)).second << std::endl;
+    std::cout << "find(33): " << test_umap.find(33)->second << ", find(34) == end(): " << (test_umap.find(34) == test_umap.end()) << std::endl;
+    std::cout << "count(44): " << test_umap.count(44) << ", erase(44): " << test_umap.erase(44) << ", count(44): " << test_umap.count(44) << std::endl;
+    test_umap.erase(test_umap.find(0));
+    print_sorted_map(test_umap);
+
+    // Output: ***********************
+    // insert existing key: 0
+    // find(33): 3, find(34) == end(): 1
+    // count(44): 1, erase(44): 1, count(44): 0
+    // size: 9, sorted checksum: 5305, first: 5 => 50, last: 99 => 9
+
+    /* ---------------------------------------------------------------------- */
+
+    // unordered_map with a small max_load_factor
+    std::cout << "\n - unordered_map with a small max_load_factor: " << std::endl;
+
+    ft::unordered_map<int, int> umap_sparse;
+
+    for (int i = 0; i < 5; ++i)
+        umap_sparse[i] = i;
+    for (int i = 0; i < 5; ++i)
+        umap_sparse.erase(i); // only deleted slots are left
+    umap_sparse.max_load_factor(0.01f);
+    for (int i = 0; i < 1000; ++i)
+        umap_sparse[i * 3] = i;
+    std::cout << "load_factor() <= max_load_factor(): " << (umap_sparse.load_factor() <= umap_sparse.max_load_factor()) << std::endl;
+    print_sorted_map(umap_sparse);
+
+    // Output: ***********************
+    // load_factor() <= max_load_factor(): 1
+    // size: 1000, sorted checksum: 3333330000, first: 0 => 0, last: 2997 => 999
+
+    /* ---------------------------------------------------------------------- */
+
+    // unordered_map insert & erase churn
+    std::cout << "\n - unordered_map insert & erase churn: " << std::endl;
+
+    ft::unordered_map<int, int> umap_churn;
+
+    for (int round = 0; round < 20; ++round)
+    {
+        for (int i = 0; i < 500; ++i)
+            umap_churn[round * 500 + i] = round;
+        for (int i = 0; i < 500; ++i)
+            if (i % 5 != 0)
+                umap_churn.erase(round * 500 + i); // leaves deleted slots behind
+    }
+    std::cout << "count(0): " << umap_churn.count(0) << ", count(1): " << umap_churn.count(1) << ", count(9995): " << umap_churn.count(9995) << std::endl;
+    print_sorted_map(umap_churn);
+    umap_churn.erase(umap_churn.begin(), umap_churn.end());
+    for (int i = 0; i < 100; ++i)
+        umap_churn.insert(ft::make_pair(i, -i));
+    print_sorted_map(umap_churn);
+
+    // Output: ***********************
+    // count(0): 1, count(1): 0, count(9995): 1
+    // size: 2000, sorted checksum: 13512946500, first: 0 => 0, last: 9995 => 19
+    // size: 100, sorted checksum: -1999800, first: 0 => 0, last: 99 => -99
+
+    /* ---------------------------------------------------------------------- */
+
+    // unordered_map reserve, rehash & max_load_factor
+    std::cout << "\n - unordered_map reserve, rehash & max_load_factor: " << std::endl;
+
+    ft::unordered_map<int, int> umap_grow;
+
+    for (int i = 0; i < 300; ++i)
+        umap_grow[i * 7] = i;
+    umap_grow.reserve(5000);
+    std::cout << "after reserve(5000): ";
+    print_sorted_map(umap_grow);
+    umap_grow.rehash(10); // less than needed for size()
+    std::cout << "after rehash(10): ";
+    print_sorted_map(umap_grow);
+    umap_grow.rehash(4096);
+    std::cout << "after rehash(4096): ";
+    print_sorted_map(umap_grow);
+    umap_grow.max_load_factor(0.25f);
+    std::cout << "after max_load_factor(0.25): load_factor() <= max_load_factor(): " << (umap_grow.load_factor() <= umap_grow.max_load_factor()) << std::endl;
+    print_sorted_map(umap_grow);
+    for (int i = 0; i < 300; ++i)
+        umap_grow.erase(i * 14);
+    umap_grow.max_load_factor(1.0f);
+    for (int i = 0; i < 1000; ++i)
+        umap_grow.insert(ft::make_pair(i, i));
+    std::cout << "after erase, max_load_factor(1) and insert: ";
+    print_sorted_map(umap_grow);
+
+    // Output: ***********************
+    // after reserve(5000): size: 300, sorted checksum: 125998600, first: 0 => 0, last: 2093 => 299
+    // after rehash(10): size: 300, sorted checksum: 125998600, first: 0 => 0, last: 2093 => 299
+    // after rehash(4096): size: 300, sorted checksum: 125998600, first: 0 => 0, last: 2093 => 299
+    // after max_load_factor(0.25): load_factor() <= max_load_factor(): 1
+    // size: 300, sorted checksum: 125998600, first: 0 => 0, last: 2093 => 299
+    // after erase, max_load_factor(1) and insert: size: 1079, sorted checksum: 2781511404, first: 0 => 0, last: 2093 => 299
+
+    /* ---------------------------------------------------------------------- */
+
+    // unordered_map copy, assignment & swap
+    std::cout << "\n - unordered_map copy, assignment & swap: " << std::endl;
+
+    ft::unordered_map<int, int> ufirst(umap_churn);
+    ft::unordered_map<int, int> usecond;
+
+    usecond = umap_grow;
+    ufirst.swap(usecond);
+    umap_grow.clear();
+    print_sorted_map(ufirst);
+    print_sorted_map(usecond);
+    print_sorted_map(umap_grow);
+
+    // Output: ***********************
+    // size: 1079, sorted checksum: 2781511404, first: 0 => 0, last: 2093 => 299
+    // size: 100, sorted checksum: -1999800, first: 0 => 0, last: 99 => -99
+    // size: 0, sorted checksum: 0
+
+    std::cout << GREEN << "\n --------------------------------------------- " << RESET << std::endl;
+
+
+    /* ########################### UNORDERED SET ############################ */
+
+    std::cout << GREEN << "\n          ***************************" << std::endl;
+    std::cout          <<   "          *      UNORDERED SET      *" << std::endl;
+    std::cout          <<   "          ***************************" << RESET << std::endl;
+
+    /* ---------------------------------------------------------------------- */
+
+    // unordered_set insert, find & erase
+    std::cout << "\n - unordered_set insert, find & erase: " << std::endl;
+
+    ft::unordered_set<int> test_uset;
+
+    for (int i = 0; i < 10; ++i)
+        test_uset.insert(i * 11);
+    std::cout << "insert existing key: " << test_uset.insert(11).second << std::endl;
+    std::cout << "find(33): " << *test_uset.find(33) << ", find(34) == end(): " << (test_uset.find(34) == test_uset.end()) << std::endl;
+    std::cout << "count(44): " << test_uset.count(44) << ", erase(44): " << test_uset.erase(44) << ", count(44): " << test_uset.count(44) << std::endl;
+    test_uset.erase(test_uset.find(0));
+    print_sorted_set(test_uset);
+
+    // Output: ***********************
+    // insert existing key: 0
+    // find(33): 33, find(34) == end(): 1
+    // count(44): 1, erase(44): 1, count(44): 0
+    // size: 8, sorted checksum: 2574, first: 11, last: 99
+
+    /* ---------------------------------------------------------------------- */
+
+    // unordered_set with a small max_load_factor
+    std::cout << "\n - unordered_set with a small max_load_factor: " << std::endl;
+
+    ft::unordered_set<int> uset_sparse;
+
+    for (int i = 0; i < 5; ++i)
+        uset_sparse.insert(i);
+    for (int i = 0; i < 5; ++i)
+        uset_sparse.erase(i); // only deleted slots are left
+    uset_sparse.max_load_factor(0.01f);
+    for (int i = 0; i < 1000; ++i)
+        uset_sparse.insert(i * 3);
+    std::cout << "load_factor() <= max_load_factor(): " << (uset_sparse.load_factor() <= uset_sparse.max_load_factor()) << std::endl;
+    print_sorted_set(uset_sparse);
+
+    // Output: ***********************
+    // load_factor() <= max_load_factor(): 1
+    // size: 1000, sorted checksum: 999999000, first: 0, last: 2997
+
+    /* ---------------------------------------------------------------------- */
+
+    // unordered_set insert & erase churn
+    std::cout << "\n - unordered_set insert & erase churn: " << std::endl;
+
+    ft::unordered_set<int> uset_churn;
+
+    for (int round = 0; round < 20; ++round)
+    {
+        for (int i = 0; i < 500; ++i)
+            uset_churn.insert(round * 500 + i);
+        for (int i = 0; i < 500; ++i)
+            if (i % 5 != 0)
+                uset_churn.erase(round * 500 + i); // leaves deleted slots behind
+    }
+    std::cout << "count(0): " << uset_churn.count(0) << ", count(1): " << uset_churn.count(1) << ", count(9995): " << uset_churn.count(9995) << std::endl;
+    print_sorted_set(uset_churn);
+
+    // Output: ***********************
+    // count(0): 1, count(1): 0, count(9995): 1
+    // size: 2000, sorted checksum: 13333330000, first: 0, last: 9995
+
+    /* ---------------------------------------------------------------------- */
+
+    // unordered_set reserve, rehash & max_load_factor
+    std::cout << "\n - unordered_set reserve, rehash & max_load_factor: " << std::endl;
+
+    ft::unordered_set<int> uset_grow;
+
+    for (int i = 0; i < 300; ++i)
+        uset_grow.insert(i * 7);
+    uset_grow.reserve(5000);
+    std::cout << "after reserve(5000): ";
+    print_sorted_set(uset_grow);
+    uset_grow.rehash(10);
+    std::cout << "after rehash(10): ";
+    print_sorted_set(uset_grow);
+    uset_grow.max_load_factor(0.25f);
+    std::cout << "after max_load_factor(0.25): ";
+    print_sorted_set(uset_grow);
+    for (int i = 0; i < 1000; ++i)
+        uset_grow.insert(i);
+    std::cout << "after insert: ";
+    print_sorted_set(uset_grow);
+
+    // Output: ***********************
+    // after reserve(5000): size: 300, sorted checksum: 62999300, first: 0, last: 2093
+    // after rehash(10): size: 300, sorted checksum: 62999300, first: 0, last: 2093
+    // after max_load_factor(0.25): size: 300, sorted checksum: 62999300, first: 0, last: 2093
+    // after insert: size: 1157, sorted checksum: 597656787, first: 0, last: 2093
+
+    std::cout << GREEN << "\n --------------------------------------------- " << RESET << std::endl;
+#endif
+
+
+    /* ############################ FROZEN SET ############################## */
+
+    std::cout << GREEN << "\n          ***************************" << std::endl;
+    std::cout          <<   "          *       FROZEN SET        *" << std::endl;
+    std::cout          <<   "          ***************************" << RESET << std::endl;
+
+    /* ---------------------------------------------------------------------- */
+
+    // frozen_set of 0, 1, 2^k - 1, 2^k and 2^k + 1 elements, from set::freeze() and from a sorted range
+    std::cout << "\n - frozen_set sizes, probes & iteration: " << std::endl;
+
+    int frozen_sizes[] = {0, 1, 7, 8, 9, 15, 16, 17};
+
+    for (size_t i = 0; i < sizeof(frozen_sizes) / sizeof(frozen_sizes[0]); ++i)
+    {
+        ft::set<int> odd_keys;
+
+        for (int key = 0; key < frozen_sizes[i]; ++key)
+            odd_keys.insert(2 * key + 1);
+#if STD
+        ft::frozen_set<int> from_set(odd_keys);
+#else
+        ft::frozen_set<int> from_set = odd_keys.freeze();
+#endif
+        ft::frozen_set<int> from_range(odd_keys.begin(), odd_keys.end());
+
+        // even probes fall below, between and above the odd keys
+        print_frozen_set(from_set, 0, 2 * frozen_sizes[i]);
+        std::cout << "range constructor equal: " << ft::equal(from_set.begin(), from_set.end(), from_range.begin()) << std::endl;
+    }
+
+    // Output: ***********************
+    // size: 0, empty: 1
+    // forward:
+    // backward:
+    // reverse:
+    // probes: 0:0/e/e/e/10
+    // range constructor equal: 1
+    // size: 1, empty: 0
+    // forward: 1
+    // backward: 1
+    // reverse: 1
+    // probes: 0:0/e/1/1/10 1:1/1/1/e/11 2:0/e/e/e/10
+    // range constructor equal: 1
+    // size: 7, empty: 0
+    // forward: 1 3 5 7 9 11 13
+    // backward: 13 11 9 7 5 3 1
+    // reverse: 13 11 9 7 5 3 1
+    // probes: 0:0/e/1/1/10 1:1/1/1/3/11 2:0/e/3/3/10 ... 12:0/e/13/13/10 13:1/13/13/e/11 14:0/e/e/e/10
+    // range constructor equal: 1
+    // (the same pattern for 8, 9, 15, 16 and 17 elements)
+
+    /* ---------------------------------------------------------------------- */
+
+    // frozen_set of a set after erases, with std::string values
+    std::cout << "\n - frozen_set of a set after erases: " << std::endl;
+
+    ft::set<std::string> words;
+    const char* word_list[] = {"kiwi", "apple", "mango", "fig", "banana", "cherry", "lime", "date", "grape", "pear", "plum"};
+
+    for (size_t i = 0; i < sizeof(word_list) / sizeof(word_list[0]); ++i)
+        words.insert(word_list[i]);
+    words.erase("fig");
+    words.erase("plum");
+#if STD
+    ft::frozen_set<std::string> frozen_words(words);
+#else
+    ft::frozen_set<std::string> frozen_words = words.freeze();
+#endif
+    words.insert("zucchini"); // the frozen copy does not follow the set
+    std::cout << "size: " << frozen_words.size() << ", set size: " << words.size() << std::endl;
+    std::cout << "count(\"apple\"): " << frozen_words.count("apple") << ", count(\"fig\"): " << frozen_words.count("fig")
+              << ", count(\"zucchini\"): " << frozen_words.count("zucchini") << std::endl;
+    std::cout << "lower_bound(\"a\"): " << *frozen_words.lower_bound("a") << ", lower_bound(\"fig\"): " << *frozen_words.lower_bound("fig")
+              << ", upper_bound(\"lime\"): " << *frozen_words.upper_bound("lime")
+              << ", upper_bound(\"pear\") == end(): " << (frozen_words.upper_bound("pear") == frozen_words.end()) << std::endl;
+    std::cout << "forward:";
+    for (ft::frozen_set<std::string>::const_iterator it = frozen_words.begin(); it != frozen_words.end(); ++it)
+        std::cout << " " << *it;
+    std::cout << std::endl << "reverse:";
+    for (ft::frozen_set<std::string>::const_reverse_iterator it = frozen_words.rbegin(); it != frozen_words.rend(); ++it)
+        std::cout << " " << *it;
+    std::cout << std::endl;
+
+    // Output: ***********************
+    // size: 9, set size: 10
+    // count("apple"): 1, count("fig"): 0, count("zucchini"): 0
+    // lower_bound("a"): apple, lower_bound("fig"): grape, upper_bound("lime"): mango, upper_bound("pear") == end(): 1
+    // forward: apple banana cherry date grape kiwi lime mango pear
+    // reverse: pear mango lime kiwi grape date cherry banana apple
+
+    /* ---------------------------------------------------------------------- */
+
+    // frozen_set copy, assignment & swap
+    std::cout << "\n - frozen_set copy, assignment & swap: " << std::endl;
+
+    ft::set<int> big_keys;
+
+    for (int key = 0; key < 1000; ++key)
+        big_keys.insert((key * 7919) % 1000 * 3);
+    ft::frozen_set<int> frozen_big(big_keys.begin(), big_keys.end());
+    ft::frozen_set<int> frozen_copy(frozen_big);
+    ft::frozen_set<int> frozen_other;
+    long frozen_hits = 0;
+
+    frozen_other = frozen_copy;
+    frozen_copy = ft::frozen_set<int>();
+    frozen_copy.swap(frozen_other);
+    for (int key = -1; key <= 3000; ++key)
+        frozen_hits += frozen_copy.count(key) * key + (frozen_copy.lower_bound(key) == frozen_copy.end() ? -1 : *frozen_copy.lower_bound(key));
+    std::cout << "size: " << frozen_copy.size() << ", other size: " << frozen_other.size() << ", big size: " << frozen_big.size() << std::endl;
+    std::cout << "probe checksum: " << frozen_hits << ", equal to the set: " << ft::equal(big_keys.begin(), big_keys.end(), frozen_copy.begin()) << std::endl;
+    std::cout << "distance(begin, end): " << ft::distance(frozen_copy.begin(), frozen_copy.end()) << std::endl;
+
+    // Output: ***********************
+    // size: 1000, other size: 0, big size: 1000
+    // probe checksum: 5993997, equal to the set: 1
+    // distance(begin, end): 1000
+
+    std::cout << GREEN << "\n --------------------------------------------- " << RESET << std::endl;
+
+
+
+
     std::cout << "\n !!!!!!!!!!!!!!!!! FINISHED !!!!!!!!!!!!!!!!!! " << std::endl;
 
     return (0);